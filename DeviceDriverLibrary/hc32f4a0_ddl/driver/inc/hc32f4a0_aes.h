@@ -7,6 +7,8 @@
    Change Logs:
    Date             Author          Notes
    2020-06-12       Heqb         First version
+   2026-10-17       Heqb         1. Add CBC/CTR/CFB mode context and GCM functions
+                                 2. Add non-blocking AES job functions
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -80,6 +82,58 @@ extern "C"
 /*******************************************************************************
  * Global type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup AES_Global_Types AES Global Types
+ * @{
+ */
+
+/**
+ * @brief AES block cipher mode context structure definition
+ * @note  The key registers are only reloaded when another context (or
+ *        AES_Encrypt()/AES_Decrypt()) used the AES unit in between, so
+ *        consecutive calls on one context do not rewrite the key.
+ */
+typedef struct
+{
+    uint32_t u32Mode;                   /*!< Block cipher mode.
+                                             This parameter can be a value of @ref AES_Cipher_Mode */
+    uint32_t u32KeySize;                /*!< Key size, a value of @ref AES_KEY_SIZE */
+    uint8_t  au8Key[32U];               /*!< Copy of the key */
+    uint8_t  au8Iv[16U];                /*!< Chaining value: the IV for CBC and CFB, the counter block for CTR */
+    uint8_t  au8Stream[16U];            /*!< Key stream block of CTR and CFB mode */
+    uint8_t  u8KeyLength;               /*!< Length of the key in bytes */
+    uint8_t  u8StreamPos;               /*!< Number of au8Stream bytes already used */
+} stc_aes_ctx_t;
+
+/**
+ * @brief AES-GCM context structure definition
+ */
+typedef struct
+{
+    stc_aes_ctx_t stcAes;               /*!< Block cipher context which holds the key */
+    uint64_t      au64HL[16U];          /*!< GHASH multiplication table of H, low 64 bits */
+    uint64_t      au64HH[16U];          /*!< GHASH multiplication table of H, high 64 bits */
+} stc_aes_gcm_ctx_t;
+
+/**
+ * @brief AES job structure definition, see AES_JobEncrypt()
+ */
+typedef struct
+{
+    stc_aes_ctx_t       *pstcCtx;       /*!< Context of the job */
+    const uint8_t       *pu8Input;      /*!< Buffer of the input data */
+    uint8_t             *pu8Output;     /*!< Buffer of the output data */
+    uint32_t            u32Size;        /*!< Length of the data in bytes */
+    uint32_t            u32Index;       /*!< Number of bytes done */
+    uint32_t            u32Dir;         /*!< Encryption or decryption, for internal use */
+    uint32_t            u32PollCnt;     /*!< Number of AES_JobProcess() calls spent on the current block */
+    func_ptr_t          pfnCpltCallback;/*!< Called when the job is over, may be NULL */
+    __IO en_result_t    enResult;       /*!< OperationInProgress while running, then Ok or the error code */
+} stc_aes_job_t;
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Global pre-processor symbols/macros ('#define')
@@ -102,6 +156,18 @@ extern "C"
  * @}
  */
 
+/**
+ * @defgroup AES_Cipher_Mode AES Block Cipher Mode
+ * @{
+ */
+#define AES_MODE_ECB                  (0UL)
+#define AES_MODE_CBC                  (1UL)
+#define AES_MODE_CTR                  (2UL)
+#define AES_MODE_CFB                  (3UL)     /*!< 128-bit cipher feedback */
+/**
+ * @}
+ */
+
 /**
  * @defgroup AES_KEY_SIZE AES Key Size
  * @{
@@ -139,6 +205,52 @@ en_result_t AES_Decrypt(uint8_t au8Ciphertext[],
                         const uint8_t *pu8Key,
                         uint8_t u8KeyLength,
                         uint8_t au8Plaintext[]);
+
+en_result_t AES_CtxInit(stc_aes_ctx_t *pstcCtx,
+                        uint32_t u32Mode,
+                        const uint8_t *pu8Key,
+                        uint8_t u8KeyLength,
+                        const uint8_t au8Iv[]);
+en_result_t AES_CtxSetIv(stc_aes_ctx_t *pstcCtx, const uint8_t au8Iv[]);
+en_result_t AES_CtxEncrypt(stc_aes_ctx_t *pstcCtx,
+                           const uint8_t au8Plaintext[],
+                           uint32_t u32Size,
+                           uint8_t au8Ciphertext[]);
+en_result_t AES_CtxDecrypt(stc_aes_ctx_t *pstcCtx,
+                           const uint8_t au8Ciphertext[],
+                           uint32_t u32Size,
+                           uint8_t au8Plaintext[]);
+
+en_result_t AES_GCM_Init(stc_aes_gcm_ctx_t *pstcCtx,
+                         const uint8_t *pu8Key,
+                         uint8_t u8KeyLength);
+en_result_t AES_GCM_Encrypt(stc_aes_gcm_ctx_t *pstcCtx,
+                            const uint8_t au8Iv[], uint32_t u32IvLength,
+                            const uint8_t au8Aad[], uint32_t u32AadLength,
+                            const uint8_t au8Plaintext[], uint32_t u32Size,
+                            uint8_t au8Ciphertext[],
+                            uint8_t au8Tag[], uint32_t u32TagLength);
+en_result_t AES_GCM_Decrypt(stc_aes_gcm_ctx_t *pstcCtx,
+                            const uint8_t au8Iv[], uint32_t u32IvLength,
+                            const uint8_t au8Aad[], uint32_t u32AadLength,
+                            const uint8_t au8Ciphertext[], uint32_t u32Size,
+                            uint8_t au8Plaintext[],
+                            const uint8_t au8Tag[], uint32_t u32TagLength);
+
+en_result_t AES_JobEncrypt(stc_aes_job_t *pstcJob,
+                           stc_aes_ctx_t *pstcCtx,
+                           const uint8_t au8Plaintext[],
+                           uint32_t u32Size,
+                           uint8_t au8Ciphertext[],
+                           func_ptr_t pfnCallback);
+en_result_t AES_JobDecrypt(stc_aes_job_t *pstcJob,
+                           stc_aes_ctx_t *pstcCtx,
+                           const uint8_t au8Ciphertext[],
+                           uint32_t u32Size,
+                           uint8_t au8Plaintext[],
+                           func_ptr_t pfnCallback);
+en_result_t AES_JobProcess(stc_aes_job_t *pstcJob);
+en_result_t AES_JobAbort(stc_aes_job_t *pstcJob);
 /**
  * @}
  */
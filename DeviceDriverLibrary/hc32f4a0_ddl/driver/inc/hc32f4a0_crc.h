@@ -7,6 +7,9 @@
    Change Logs:
    Date             Author          Notes
    2020-06-12       Heqb            First version
+   2026-10-17       Heqb            Add CRC context functions and DMA feed
+   2026-10-17       Heqb            The CRC DMA channel is claimed through DMA_ChClaim() and started
+                                    by the DMA software trigger owner
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -64,6 +67,7 @@ extern "C"
  ******************************************************************************/
 #include "hc32_common.h"
 #include "ddl_config.h"
+#include "hc32f4a0_dma.h"
 
 /**
  * @addtogroup HC32F4A0_DDL_Driver
@@ -80,6 +84,46 @@ extern "C"
 /*******************************************************************************
  * Global type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup CRC_Global_Types CRC Global Types
+ * @{
+ */
+
+/**
+ * @brief CRC context structure definition
+ * @note  The running checksum is kept in the context, so several contexts can
+ *        be updated in turn. The CRC unit is reloaded when it holds another one.
+ */
+typedef struct
+{
+    uint32_t u32Protocol;               /*!< CRC protocol.
+                                             This parameter can be a value of @ref CRC_Protocol_Control_Bit */
+    uint32_t u32Reslt;                  /*!< Value of CRC_RESLT after the last update */
+    uint32_t u32ResltMask;              /*!< Difference between a value written to CRC_RESLT and
+                                             the value read back, for internal use */
+} stc_crc_ctx_t;
+
+/**
+ * @brief CRC DMA handle structure definition
+ */
+typedef struct
+{
+    M4_DMA_TypeDef      *DMAx;          /*!< DMA unit that feeds the CRC data register: M4_DMA1 or M4_DMA2 */
+    uint8_t             u8DmaCh;        /*!< DMA channel that feeds the CRC data register: DMA_CH0 ~ DMA_CH7 */
+    func_ptr_t          pfnCpltCallback;/*!< Called when the data is done, may be NULL */
+#if (DDL_DMA_ENABLE == DDL_ON)
+    stc_dma_ch_t        stcDmaCh;       /*!< Channel claimed by CRC_DMA_Update() while the DMA runs */
+#endif /* DDL_DMA_ENABLE */
+    __IO en_result_t    enResult;       /*!< OperationInProgress while the DMA runs, then Ok or the error code */
+    stc_crc_ctx_t       *pstcCtx;       /*!< Context of the current update */
+    const uint8_t       *pu8Data;       /*!< Data after the current DMA transfer */
+    uint32_t            u32Length;      /*!< Bytes after the current DMA transfer */
+    uint32_t            u32BlockCnt;    /*!< Blocks of the current DMA transfer still to be triggered */
+} stc_crc_dma_handle_t;
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Global pre-processor symbols/macros ('#define')
@@ -150,6 +194,19 @@ en_flag_status_t CRC_Check(uint32_t u32CrcProtocol,
                            uint32_t u32InitVal,
                            uint32_t u32Length,
                            uint8_t u8BitWidth);
+
+en_result_t CRC_Begin(stc_crc_ctx_t *pstcCtx, uint32_t u32CrcProtocol, uint32_t u32InitVal);
+en_result_t CRC_Update(stc_crc_ctx_t *pstcCtx, const void *pvData, uint32_t u32Length);
+uint32_t CRC_End(stc_crc_ctx_t *pstcCtx);
+
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_INTERRUPTS_ENABLE == DDL_ON)
+en_result_t CRC_DMA_StructInit(stc_crc_dma_handle_t *pstcHandle);
+en_result_t CRC_DMA_Update(stc_crc_dma_handle_t *pstcHandle,
+                           stc_crc_ctx_t *pstcCtx,
+                           const void *pvData,
+                           uint32_t u32Length);
+void CRC_DMA_IrqHandler(stc_crc_dma_handle_t *pstcHandle);
+#endif /* DDL_DMA_ENABLE && DDL_INTERRUPTS_ENABLE */
 /**
  * @}
  */
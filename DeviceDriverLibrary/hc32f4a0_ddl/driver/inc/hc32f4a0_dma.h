@@ -7,6 +7,17 @@
    Change Logs:
    Date             Author          Notes
    2020-06-12       Zhangxl         First version
+   2026-10-17       Zhangxl         Add channel manager DMA_ChAlloc/DMA_ChClaim/DMA_ChFree
+                                    and DMA_ChIrqHandler
+   2026-10-17       Zhangxl         Add LLP chain builder DMA_LlpChainInit/DMA_LlpChainBuild
+                                    and DMA_LlpChainLoad
+   2026-10-17       Zhangxl         Add memory copy/set queue DMA_MemInit/DMA_MemCopy/DMA_MemSet
+                                    and DMA_MemIrqHandler
+   2026-10-17       Zhangxl         Add ping-pong stream DMA_StreamInit/DMA_StreamStart/DMA_StreamStop,
+                                    DMA_StreamRelease and DMA_StreamIrqHandler
+   2026-10-17       Zhangxl         Add 2D transfer DMA_BlitStructInit/DMA_BlitBuild/DMA_BlitStart
+   2026-10-17       Zhangxl         Add software trigger owner DMA_SwTrigAcquire/DMA_SwTrigRelease
+                                    and DMA_SwTrigger
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -196,6 +207,127 @@ typedef struct
     uint32_t CHCTLx;            /*!< LLP channel control */
 } stc_dma_llp_descriptor_t;
 
+/**
+ * @brief  DMA managed channel structure definition
+ */
+typedef struct
+{
+    M4_DMA_TypeDef  *DMAx;              /*!< DMA unit of the channel: M4_DMA1 or M4_DMA2, set by DMA_ChAlloc() */
+    uint8_t         u8Ch;               /*!< DMA channel: DMA_CH0 ~ DMA_CH7, set by DMA_ChAlloc()               */
+    func_ptr_t      pfnTcCallback;      /*!< Called by DMA_ChIrqHandler() when the transfer is completed, may be NULL */
+    func_ptr_t      pfnBtcCallback;     /*!< Called by DMA_ChIrqHandler() when a block is completed, may be NULL     */
+    func_ptr_t      pfnErrCallback;     /*!< Called by DMA_ChIrqHandler() on request or transfer error, may be NULL */
+} stc_dma_ch_t;
+
+/**
+ * @brief  DMA LLP chain segment structure definition
+ */
+typedef struct
+{
+    uint32_t u32SrcAddr;        /*!< Specifies the segment source address.                              */
+
+    uint32_t u32DestAddr;       /*!< Specifies the segment destination address.                         */
+
+    uint32_t u32Length;         /*!< Specifies the segment length in data of u32DataWidth.              */
+
+    uint32_t u32DataWidth;      /*!< Specifies the segment data width.
+                                    This parameter can be a value of @ref DMA_DataWidth_Sel             */
+
+    uint32_t u32SrcInc;         /*!< Specifies the source address increment mode.
+                                    This parameter can be a value of @ref DMA_SrcAddr_Incremented_Mode  */
+
+    uint32_t u32DestInc;        /*!< Specifies the destination address increment mode.
+                                    This parameter can be a value of @ref DMA_DesAddr_Incremented_Mode  */
+
+} stc_dma_llp_seg_t;
+
+/**
+ * @brief  DMA LLP chain structure definition
+ */
+typedef struct
+{
+    stc_dma_llp_descriptor_t *pstcDesc; /*!< Descriptor array, word aligned, kept by the caller              */
+    uint32_t u32DescNum;        /*!< Descriptor count of the array                                      */
+    uint32_t u32DescCnt;        /*!< Descriptor count of the built chain                                */
+    uint32_t u32LlpRun;         /*!< Specifies the chain mode.
+                                    This parameter can be a value of @ref DMA_Llp_Mode                  */
+} stc_dma_llp_chain_t;
+
+/**
+ * @brief  DMA memory request structure definition
+ */
+typedef struct
+{
+    uint32_t    u32DestAddr;        /*!< Destination address                                            */
+    uint32_t    u32SrcAddr;         /*!< Source address, 0 for a memory set                             */
+    uint32_t    u32Size;            /*!< Size in bytes                                                  */
+    uint32_t    u32Fill;            /*!< Byte value repeated in the word, read by the memory set        */
+    func_ptr_t  pfnCpltCallback;    /*!< Called by DMA_MemIrqHandler() when the request is over, may be NULL */
+} stc_dma_mem_req_t;
+
+/**
+ * @brief  DMA memory engine structure definition
+ */
+typedef struct
+{
+    M4_DMA_TypeDef      *DMAx;          /*!< DMA unit of the engine: M4_DMA1 or M4_DMA2                 */
+    uint8_t             u8Ch;           /*!< DMA channel of the engine: DMA_CH0 ~ DMA_CH7               */
+    stc_dma_mem_req_t   *pstcQueue;     /*!< Request queue, kept by the caller                          */
+    uint32_t            u32QueueSize;   /*!< Request count of the queue                                 */
+    __IO uint32_t       u32Head;        /*!< Index of the request in progress                           */
+    __IO uint32_t       u32Tail;        /*!< Index of the next free request                             */
+    __IO uint8_t        u8Busy;         /*!< 1 while a request is in progress                           */
+    stc_dma_llp_chain_t stcChain;       /*!< Descriptor chain of the request in progress                */
+} stc_dma_mem_t;
+
+/**
+ * @brief  DMA ping-pong stream initialization structure definition
+ */
+typedef struct
+{
+    uint32_t    u32Dir;             /*!< Stream direction, @ref DMA_Stream_Dir                                  */
+    uint32_t    u32PeriphAddr;      /*!< Peripheral address                                                     */
+    uint32_t    u32PeriphRptSize;   /*!< 0: The peripheral address is fixed.
+                                         1 ~ 1024: The peripheral address is increased and reloaded every
+                                         u32PeriphRptSize data, e.g. the data registers of an ADC scan          */
+    uint32_t    u32Buf0Addr;        /*!< Address of the buffer 0                                                */
+    uint32_t    u32Buf1Addr;        /*!< Address of the buffer 1                                                */
+    uint32_t    u32BufLen;          /*!< Data count of each buffer, a multiple of u32BlockSize                 */
+    uint32_t    u32BlockSize;       /*!< Data count moved by each request: 1 ~ 1024                             */
+    uint32_t    u32DataWidth;       /*!< Data width, @ref DMA_DataWidth_Sel                                     */
+    func_ptr_t  pfnHalfCallback;    /*!< Called when the buffer 0 is done, may be NULL                          */
+    func_ptr_t  pfnFullCallback;    /*!< Called when the buffer 1 is done, may be NULL                          */
+} stc_dma_stream_init_t;
+
+/**
+ * @brief  DMA ping-pong stream structure definition
+ */
+typedef struct
+{
+    M4_DMA_TypeDef              *DMAx;          /*!< DMA unit of the stream: M4_DMA1 or M4_DMA2             */
+    uint8_t                     u8Ch;           /*!< DMA channel of the stream: DMA_CH0 ~ DMA_CH7           */
+    stc_dma_llp_descriptor_t    astcDesc[2U];   /*!< Descriptors of the buffers, linked to each other       */
+    func_ptr_t                  pfnHalfCallback;/*!< Called when the buffer 0 is done                       */
+    func_ptr_t                  pfnFullCallback;/*!< Called when the buffer 1 is done                       */
+    __IO uint32_t               u32Index;       /*!< Buffer in progress: DMA_STREAM_BUF0 or DMA_STREAM_BUF1 */
+    __IO uint8_t                au8Ready[2U];   /*!< Buffers done and not released                          */
+    __IO uint32_t               u32OverrunCnt;  /*!< Buffers done again before being released               */
+} stc_dma_stream_t;
+
+/**
+ * @brief  DMA 2D transfer (blit) structure definition
+ */
+typedef struct
+{
+    uint32_t    u32SrcAddr;         /*!< Address of the first data of the source rectangle                     */
+    uint32_t    u32DestAddr;        /*!< Address of the first data of the destination rectangle                */
+    uint32_t    u32Width;           /*!< Data count of a row                                                    */
+    uint32_t    u32Height;          /*!< Row count                                                              */
+    uint32_t    u32SrcStride;       /*!< Bytes from a source row to the next one                               */
+    uint32_t    u32DestStride;      /*!< Bytes from a destination row to the next one                          */
+    uint32_t    u32DataWidth;       /*!< Data (pixel) width, @ref DMA_DataWidth_Sel                            */
+} stc_dma_blit_t;
+
 /**
  * @}
  */
@@ -224,6 +356,40 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup DMA_Ch_Alloc_Hint DMA channel allocation hint
+ * @note The channel with the lower number has the higher priority.
+ * @{
+ */
+#define DMA_CH_HINT_PRIO_HIGH       (0x00UL)      /*!< Take the free channel of the highest priority  */
+#define DMA_CH_HINT_PRIO_LOW        (0x01UL)      /*!< Take the free channel of the lowest priority   */
+#define DMA_CH_HINT_UNIT_ANY        (0x00UL)      /*!< Take a channel of DMA1, then DMA2              */
+#define DMA_CH_HINT_UNIT1           (0x10UL)      /*!< Take a channel of DMA1 only                    */
+#define DMA_CH_HINT_UNIT2           (0x20UL)      /*!< Take a channel of DMA2 only                    */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DMA_Stream_Dir DMA ping-pong stream direction
+ * @{
+ */
+#define DMA_STREAM_PERIPH_TO_MEM    (0x00UL)      /*!< The buffers are filled from the peripheral     */
+#define DMA_STREAM_MEM_TO_PERIPH    (0x01UL)      /*!< The buffers are sent to the peripheral         */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DMA_Stream_Buf DMA ping-pong stream buffer
+ * @{
+ */
+#define DMA_STREAM_BUF0             (0x00UL)      /*!< Buffer 0, reported by the half callback        */
+#define DMA_STREAM_BUF1             (0x01UL)      /*!< Buffer 1, reported by the full callback        */
+/**
+ * @}
+ */
+
 /**
  * @defgroup DMA_Mx_Channel_selection DMA Multiplex Channel selection
  * @{
@@ -560,6 +726,44 @@ uint32_t DMA_GetNonSeqSrcCnt(const M4_DMA_TypeDef *DMAx, uint8_t u8Ch);
 uint32_t DMA_GetNonSeqDestCnt(const M4_DMA_TypeDef *DMAx, uint8_t u8Ch);
 uint32_t DMA_GetNonSeqSrcOffset(const M4_DMA_TypeDef *DMAx, uint8_t u8Ch);
 uint32_t DMA_GetNonSeqDestOffset(const M4_DMA_TypeDef *DMAx, uint8_t u8Ch);
+
+en_result_t DMA_ChAlloc(stc_dma_ch_t *pstcCh, uint32_t u32Hint, en_event_src_t enSrc);
+en_result_t DMA_ChClaim(stc_dma_ch_t *pstcCh, en_event_src_t enSrc);
+en_result_t DMA_ChFree(const stc_dma_ch_t *pstcCh);
+void DMA_ChIrqHandler(M4_DMA_TypeDef *DMAx);
+
+en_result_t DMA_SwTrigAcquire(M4_DMA_TypeDef *DMAx, uint8_t u8Ch);
+en_result_t DMA_SwTrigRelease(M4_DMA_TypeDef *DMAx, uint8_t u8Ch);
+en_result_t DMA_SwTrigger(const M4_DMA_TypeDef *DMAx, uint8_t u8Ch);
+
+en_result_t DMA_LlpSegStructInit(stc_dma_llp_seg_t *pstcSeg);
+en_result_t DMA_LlpChainInit(stc_dma_llp_chain_t *pstcChain, stc_dma_llp_descriptor_t astcDesc[],
+                             uint32_t u32DescNum, uint32_t u32LlpRun);
+en_result_t DMA_LlpChainBuild(stc_dma_llp_chain_t *pstcChain, const stc_dma_llp_seg_t astcSeg[],
+                              uint32_t u32SegNum, uint32_t u32IntEn, en_functional_state_t enCircular);
+en_result_t DMA_LlpChainLoad(M4_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_llp_chain_t *pstcChain);
+
+en_result_t DMA_MemInit(stc_dma_mem_t *pstcMem, M4_DMA_TypeDef *DMAx, uint8_t u8Ch,
+                        stc_dma_mem_req_t astcQueue[], uint32_t u32QueueSize,
+                        stc_dma_llp_descriptor_t astcDesc[], uint32_t u32DescNum);
+en_result_t DMA_MemCopy(stc_dma_mem_t *pstcMem, void *pvDest, const void *pvSrc,
+                        uint32_t u32Size, func_ptr_t pfnCpltCallback);
+en_result_t DMA_MemSet(stc_dma_mem_t *pstcMem, void *pvDest, uint8_t u8Value,
+                       uint32_t u32Size, func_ptr_t pfnCpltCallback);
+void DMA_MemIrqHandler(stc_dma_mem_t *pstcMem);
+
+en_result_t DMA_StreamStructInit(stc_dma_stream_init_t *pstcStreamInit);
+en_result_t DMA_StreamInit(stc_dma_stream_t *pstcStream, M4_DMA_TypeDef *DMAx, uint8_t u8Ch,
+                           en_event_src_t enTrigSrc, const stc_dma_stream_init_t *pstcStreamInit);
+en_result_t DMA_StreamStart(stc_dma_stream_t *pstcStream);
+en_result_t DMA_StreamStop(const stc_dma_stream_t *pstcStream);
+en_result_t DMA_StreamRelease(stc_dma_stream_t *pstcStream, uint32_t u32Buf);
+uint32_t DMA_StreamGetOverrunCnt(const stc_dma_stream_t *pstcStream);
+void DMA_StreamIrqHandler(stc_dma_stream_t *pstcStream);
+
+en_result_t DMA_BlitStructInit(stc_dma_blit_t *pstcBlit);
+en_result_t DMA_BlitBuild(stc_dma_llp_chain_t *pstcChain, const stc_dma_blit_t *pstcBlit, uint32_t u32IntEn);
+en_result_t DMA_BlitStart(M4_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_llp_chain_t *pstcChain);
 /**
  * @}
  */
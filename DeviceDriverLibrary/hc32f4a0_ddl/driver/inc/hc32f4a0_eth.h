@@ -8,6 +8,16 @@
    Date             Author          Notes
    2020-06-12       Yangjp          First version
    2020-07-03       Yangjp          Optimize stc_eth_mac_init_t structure
+   2026-10-17       Yangjp          1. Add zero-copy scatter-gather transmit
+                                    2. Add Tx completion reclaim and completion queue
+                                    3. Add zero-copy receive with Rx buffer pool
+                                    4. Add Rx interrupt coalescing and batched receive
+                                    5. Add non-blocking PHY link state machine
+                                    6. Add per-frame Tx checksum insertion and Rx checksum status
+                                    7. Add PTP clock servo, nanosecond time and PPS alignment
+                                    8. Add multicast address and VLAN filter manager
+                                    9. Add L3/L4 flow table
+                                    10. Add MMC statistics collector
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -113,6 +123,9 @@ typedef struct
 
     uint32_t u32RxMode;                         /*!< Specifies the Ethernet Rx mode.
                                                      This parameter can be a value of @ref ETH_Rx_Mode */
+
+    uint32_t u32PhyInitMode;                    /*!< Specifies the PHY initialization mode of ETH_Init().
+                                                     This parameter can be a value of @ref ETH_PHY_Init_Mode */
 } stc_eth_comm_init_t;
 
 /**
@@ -364,6 +377,36 @@ typedef struct
                                                      This parameter must be a number between Min_Data = 0x0 and Max_Data = 0x7FFFFFFF */
 } stc_eth_pps_config_t;
 
+/**
+ * @brief ETH PTP Servo Initialization Structure Definition
+ */
+typedef struct
+{
+    uint32_t u32BaseAddend;                     /*!< Specifies the nominal addend of the fine calibration, 0 to take the
+                                                     current PTP_TSPADDR value */
+
+    int32_t  i32Kp;                             /*!< Specifies the proportional gain in Q16 (ppb per ns of offset * 65536) */
+
+    int32_t  i32Ki;                             /*!< Specifies the integral gain in Q16 (ppb per ns of offset * 65536),
+                                                     applied once per sample */
+
+    uint32_t u32MaxFreq;                        /*!< Specifies the maximum frequency adjustment (ppb) */
+
+    uint32_t u32StepThreshold;                  /*!< Specifies the offset (ns) above which the time is stepped instead of
+                                                     slewed, 0 to always slew */
+} stc_eth_ptp_servo_init_t;
+
+/**
+ * @brief ETH PTP Servo Structure Definition
+ */
+typedef struct
+{
+    stc_eth_ptp_servo_init_t stcInit;           /*!< Servo configuration */
+    int64_t                  i64Drift;          /*!< Integral term, ppb in Q16 */
+    int32_t                  i32Freq;           /*!< Last frequency adjustment (ppb) */
+    uint32_t                 u32State;          /*!< Servo state, a value of @ref ETH_PTP_Servo_State */
+} stc_eth_ptp_servo_t;
+
 /**
  * @brief ETH DMA Descriptor Structure Definition
  */
@@ -390,8 +433,84 @@ typedef struct
     uint32_t           u32SegCount;             /*!< Segment count         */
     uint32_t           u32Length;               /*!< Frame length          */
     uint32_t           u32Buffer;               /*!< Frame buffer          */
+    uint32_t           u32ChecksumStatus;       /*!< Hardware checksum status, a combination of @ref ETH_Rx_Checksum_Status */
 } stc_eth_dma_rx_frame_t;
 
+/**
+ * @brief ETH DMA Transmit Segment Structure Definition
+ */
+typedef struct
+{
+    const uint8_t *pu8Buffer;                   /*!< Segment data, kept by the caller until the frame is reclaimed */
+    uint32_t      u32Length;                    /*!< Segment length.
+                                                     This parameter must be a number between Min_Data = 1 and Max_Data = 0x1FFF */
+} stc_eth_dma_tx_seg_t;
+
+/**
+ * @brief ETH DMA Transmit Frame Structure Definition
+ */
+typedef struct
+{
+    const stc_eth_dma_tx_seg_t *pstcSeg;        /*!< Segments of the frame, each one is mapped onto a Tx descriptor */
+    uint32_t                   u32SegCount;     /*!< Segment count */
+    void                       *pvArg;          /*!< Caller argument, given back when the frame is reclaimed */
+    en_functional_state_t      enTimeStamp;     /*!< Capture the transmit time stamp of the frame.
+                                                     This parameter can be a value of @ref en_functional_state_t */
+    en_functional_state_t      enCpltInt;       /*!< Interrupt on completion of the frame.
+                                                     This parameter can be a value of @ref en_functional_state_t */
+    uint32_t                   u32ChecksumMode; /*!< Checksum insertion of the frame.
+                                                     This parameter can be a value of @ref ETH_DMA_Tx_Descriptor_Checksum_Insertion_Control */
+} stc_eth_dma_tx_frame_t;
+
+/**
+ * @brief ETH DMA Transmit Completion Structure Definition
+ */
+typedef struct
+{
+    void     *pvArg;                            /*!< pvArg of the frame, its segment buffers are free */
+    uint32_t u32Status;                         /*!< TDES0 status of the frame: ETH_DMATXDESC_TTSS and the bits from
+                                                     ETH_DMATXDESC_IHE to ETH_DMATXDESC_DEE */
+    uint32_t u32TimeStampHigh;                  /*!< Time stamp high value, valid if ETH_DMATXDESC_TTSS is set in u32Status */
+    uint32_t u32TimeStampLow;                   /*!< Time stamp low value, valid if ETH_DMATXDESC_TTSS is set in u32Status */
+} stc_eth_dma_tx_cplt_t;
+
+/**
+ * @brief ETH DMA Transmit Completion Queue Structure Definition
+ */
+typedef struct
+{
+    stc_eth_dma_tx_cplt_t *pstcBuf;             /*!< Buffer of the queue */
+    uint32_t              u32Size;              /*!< Size of the buffer, a power of 2 */
+    __IO uint32_t         u32Head;              /*!< Completions put by ETH_DMA_ReclaimTransmitFrame_Interrupt() */
+    __IO uint32_t         u32Tail;              /*!< Completions taken by ETH_DMA_GetTransmitCplt() */
+} stc_eth_dma_tx_cplt_queue_t;
+
+/**
+ * @brief ETH DMA Receive Buffer Pool Structure Definition
+ */
+typedef struct
+{
+    uint8_t       **ppu8Buf;                    /*!< Ring of the free buffers */
+    uint32_t      u32Size;                      /*!< Size of the ring, a power of 2 */
+    uint32_t      u32BufSize;                   /*!< Size of each buffer, a multiple of 4 up to 0x1FFC */
+    __IO uint32_t u32Head;                      /*!< Buffers put by ETH_DMA_RxPoolPut() */
+    __IO uint32_t u32Tail;                      /*!< Buffers taken by the driver to refill descriptors */
+} stc_eth_dma_rx_pool_t;
+
+/**
+ * @brief ETH DMA Receive Buffer Structure Definition
+ */
+typedef struct
+{
+    uint8_t  *pu8Buffer;                        /*!< Frame buffer, owned by the caller until given back by ETH_DMA_RxPoolPut() */
+    uint32_t u32Length;                         /*!< Frame length without FCS */
+    uint32_t u32Status;                         /*!< RDES0 of the frame */
+    uint32_t u32ExtendStatus;                   /*!< RDES4 of the frame (enhance descriptor) */
+    uint32_t u32TimeStampHigh;                  /*!< Time stamp high value (enhance descriptor) */
+    uint32_t u32TimeStampLow;                   /*!< Time stamp low value (enhance descriptor) */
+    uint32_t u32ChecksumStatus;                 /*!< Hardware checksum status, a combination of @ref ETH_Rx_Checksum_Status */
+} stc_eth_dma_rx_buf_t;
+
 /**
  * @brief ETH Initialization Structure Definition
  */
@@ -410,6 +529,14 @@ typedef struct
     stc_eth_dma_desc_t      *stcRxDesc;         /*!< Rx descriptor to Get */
     stc_eth_dma_desc_t      *stcTxDesc;         /*!< Tx descriptor to Set */
     stc_eth_dma_rx_frame_t  stcRxFrame;         /*!< last Rx frame */
+    stc_eth_dma_desc_t      *stcTxCpltDesc;     /*!< Oldest Tx descriptor not reclaimed (zero-copy Tx list) */
+    uint32_t                u32TxDescCnt;       /*!< Tx descriptor count of a zero-copy Tx list, 0 for a copy list */
+    __IO uint32_t           u32TxDescQueued;    /*!< Tx descriptors given to the DMA, advanced by the sender */
+    __IO uint32_t           u32TxDescReclaimed; /*!< Tx descriptors reclaimed, advanced by the reclaimer */
+    stc_eth_dma_rx_pool_t   *pstcRxPool;        /*!< Buffer pool refilling the Rx list, NULL for a copy list */
+    uint32_t                u32RxDescCnt;       /*!< Rx descriptor count */
+    uint32_t                u32PhyLinkState;    /*!< PHY link state, a value of @ref ETH_PHY_Link_State */
+    uint32_t                u32PhyLinkTime;     /*!< Time(ms) spent in the current PHY link state */
 } stc_eth_handle_t;
 
 /**
@@ -426,6 +553,23 @@ typedef struct
     uint8_t  au8MACAddr[6];                     /*!< Specifies the MAC Address of used Hardware */
 } stc_eth_mac_addr_config_t;
 
+/**
+ * @brief ETH MAC Filter Manager Structure Definition
+ */
+typedef struct
+{
+    uint8_t  aau8Addr[32][6];                   /*!< Subscribed multicast addresses */
+    uint16_t au16AddrRefCnt[32];                /*!< Subscriptions of each address, 0 for a free entry */
+    uint8_t  au8AddrSlot[32];                   /*!< Perfect filter slot (1 ~ 4) of each address, 0 in the hash table */
+    uint8_t  au8HashCnt[64];                    /*!< Addresses in each bin of the MAC hash table */
+    uint32_t u32SlotNum;                        /*!< Perfect filter slots owned by the manager, from ETH_MAC_ADDRESS1 */
+    uint32_t u32SlotUsed;                       /*!< Bit n set when the slot n is used */
+    uint16_t au16Vlan[16];                      /*!< Subscribed VLAN tags */
+    uint16_t au16VlanRefCnt[16];                /*!< Subscriptions of each VLAN tag, 0 for a free entry */
+    uint8_t  au8VlanHashCnt[16];                /*!< VLAN tags in each bin of the VLAN hash table */
+    uint32_t u32VlanCnt;                        /*!< Subscribed VLAN tag count */
+} stc_eth_mac_filter_t;
+
 /**
  * @brief ETH L3L4 Filter Configuration Structure Definition
  */
@@ -474,6 +618,82 @@ typedef struct
                                                      This parameter must be a number between Min_Data = 0x0 and Max_Data = 0xFFFFFFFF */
 } stc_eth_l3l4_filter_config_t;
 
+/**
+ * @brief ETH Flow Rule Structure Definition
+ */
+typedef struct
+{
+    uint32_t u32Protocol;                       /*!< Specifies the IP protocol of the flow.
+                                                     This parameter can be a value of @ref ETH_Flow_Protocol */
+    uint32_t u32DestAddr;                       /*!< Specifies the IPv4 destination address of the flow, 0 for any address.
+                                                     The address a.b.c.d is given as (a << 24) | (b << 16) | (c << 8) | d */
+    uint16_t u16DestPort;                       /*!< Specifies the destination port of the flow, 0 for any port */
+} stc_eth_flow_rule_t;
+
+/**
+ * @brief ETH Flow Table Structure Definition
+ */
+typedef struct
+{
+    stc_eth_flow_rule_t   astcRule[8];          /*!< Rules, the lower rule ID has the higher priority */
+    uint32_t              u32RuleMask;          /*!< Bit n set when the rule n is valid */
+    uint32_t              u32HwRule;            /*!< Rule programmed into the L3/L4 filter, ETH_FLOW_RULE_NONE for none */
+    uint32_t              u32HwMode;            /*!< Use of the L3/L4 filter, a value of @ref ETH_Flow_Hw_Filter_Mode */
+} stc_eth_flow_table_t;
+
+/**
+ * @brief ETH Statistics Counter Structure Definition
+ */
+typedef struct
+{
+    uint64_t u64RxFrames;                       /*!< Good unicast, multicast and broadcast frames received */
+    uint64_t u64TxFrames;                       /*!< Good unicast, multicast and broadcast frames transmitted */
+    uint64_t u64RxBytes;                        /*!< Bytes received, counted by ETH_STAT_AddBytes() */
+    uint64_t u64TxBytes;                        /*!< Bytes transmitted, counted by ETH_STAT_AddBytes() */
+    uint64_t u64RxCrcErr;                       /*!< Frames received with CRC error */
+    uint64_t u64RxAlignErr;                     /*!< Frames received with alignment error */
+    uint64_t u64RxShortErr;                     /*!< Frames received shorter than 64 bytes */
+    uint64_t u64RxLengthErr;                    /*!< Frames received with length error */
+    uint64_t u64RxOutOfRangeErr;                /*!< Frames received with out of scope length */
+    uint64_t u64TxErr;                          /*!< Frames not transmitted by deferral, collision or carrier error */
+    uint64_t u64RxOvfDrop;                      /*!< Frames dropped by Rx FIFO overflow */
+    uint64_t u64RxBufUnavailDrop;               /*!< Frames dropped by Rx buffer unavailable */
+} stc_eth_stat_count_t;
+
+/**
+ * @brief ETH Statistics Rate Structure Definition
+ */
+typedef struct
+{
+    uint32_t u32RxFrames;                       /*!< Good frames received per second */
+    uint32_t u32TxFrames;                       /*!< Good frames transmitted per second */
+    uint32_t u32RxBytes;                        /*!< Bytes received per second */
+    uint32_t u32TxBytes;                        /*!< Bytes transmitted per second */
+    uint32_t u32RxCrcErr;                       /*!< Frames received with CRC error per second */
+    uint32_t u32RxOvfDrop;                      /*!< Frames dropped by Rx FIFO overflow per second */
+    uint32_t u32RxBufUnavailDrop;               /*!< Frames dropped by Rx buffer unavailable per second */
+} stc_eth_stat_rate_t;
+
+/**
+ * @brief ETH Statistics Snapshot Structure Definition
+ */
+typedef struct
+{
+    stc_eth_stat_count_t stcTotal;              /*!< Totals since ETH_STAT_Init() */
+    stc_eth_stat_rate_t  stcRate;               /*!< Rates of the last completed period */
+} stc_eth_stat_snapshot_t;
+
+/**
+ * @brief ETH Statistics Collector Structure Definition
+ */
+typedef struct
+{
+    stc_eth_stat_snapshot_t stcSnapshot;        /*!< Totals and rates */
+    stc_eth_stat_count_t    stcRateBase;        /*!< Totals at the start of the rate period */
+    uint32_t                u32RateTime;        /*!< Time elapsed in the rate period(ms) */
+    uint32_t                au32MmcLast[16];    /*!< Last value read from each MMC counter */
+} stc_eth_stat_t;
+
 /**
  * @}
  */
@@ -822,6 +1042,28 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup ETH_PHY_Init_Mode ETH PHY Initialization Mode
+ * @{
+ */
+#define ETH_PHY_INIT_MODE_BLOCKING                  (0UL)           /*!< ETH_Init() waits for the link and auto-negotiation */
+#define ETH_PHY_INIT_MODE_NONBLOCKING               (0x00000001UL)  /*!< ETH_Init() only resets the PHY, ETH_PHY_LinkProcess() brings it up */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ETH_PHY_Link_State ETH PHY Link State
+ * @{
+ */
+#define ETH_PHY_LINK_STATE_RESET                    (0UL)   /*!< Waiting for the PHY reset */
+#define ETH_PHY_LINK_STATE_DOWN                     (1UL)   /*!< Waiting for the link */
+#define ETH_PHY_LINK_STATE_AUTONEGO                 (2UL)   /*!< Waiting for the auto-negotiation */
+#define ETH_PHY_LINK_STATE_UP                       (3UL)   /*!< Link up, MAC duplex mode and speed configured */
+/**
+ * @}
+ */
+
 /**
  * @defgroup ETH_TX_CLK_POLARITY ETH TX Clock Polarity
  * @{
@@ -1449,6 +1691,36 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup ETH_Flow_Protocol ETH Flow Protocol
+ * @{
+ */
+#define ETH_FLOW_PROTOCOL_TCP                       (6UL)                     /*!< TCP flow */
+#define ETH_FLOW_PROTOCOL_UDP                       (17UL)                    /*!< UDP flow */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ETH_Flow_Hw_Filter_Mode ETH Flow Hardware Filter Mode
+ * @{
+ */
+#define ETH_FLOW_HW_FILTER_OFF                      (0UL)                     /*!< The L3/L4 filter is not used, every frame is matched in software */
+#define ETH_FLOW_HW_FILTER_DEDICATED                (1UL)                     /*!< The receive path only carries the flow of a single rule table:
+                                                                                   the MAC drops the frames failing the L3/L4 filter */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ETH_Flow_Rule_None ETH Flow Rule None
+ * @{
+ */
+#define ETH_FLOW_RULE_NONE                          (0xFFFFFFFFUL)            /*!< No rule matched */
+/**
+ * @}
+ */
+
 /**
  * @defgroup ETH_MAC_Address_Index ETH MAC Address Index
  * @{
@@ -1849,6 +2121,21 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup ETH_Rx_Checksum_Status ETH Rx Checksum Status
+ * @note   Reported with ETH_MAC_CHECKSUM_MODE_HARDWARE and the enhance descriptor,
+ *         the checksums without an OK or ERR status must be verified by software.
+ * @{
+ */
+#define ETH_RX_CHECKSUM_NONE                        (0UL)           /*!< Not checked by the hardware */
+#define ETH_RX_CHECKSUM_IPHDR_OK                    (0x00000001UL)  /*!< IPv4 header checksum correct, or IPv6 header */
+#define ETH_RX_CHECKSUM_IPHDR_ERR                   (0x00000002UL)  /*!< IPv4 header checksum error */
+#define ETH_RX_CHECKSUM_PAYLOAD_OK                  (0x00000004UL)  /*!< TCP/UDP/ICMP checksum correct */
+#define ETH_RX_CHECKSUM_PAYLOAD_ERR                 (0x00000008UL)  /*!< TCP/UDP/ICMP checksum error */
+/**
+ * @}
+ */
+
 /**
  * @defgroup ETH_DMA_Tx_Descriptor_VLAN_Insertion_Control ETH DMA Tx Descriptor VLAN Insertion Control
  * @{
@@ -2093,6 +2380,17 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup ETH_PTP_Servo_State ETH PTP Servo State
+ * @{
+ */
+#define ETH_PTP_SERVO_STATE_UNLOCKED                (0UL)   /*!< No sample yet */
+#define ETH_PTP_SERVO_STATE_JUMP                    (1UL)   /*!< Offset above the step threshold: step the time */
+#define ETH_PTP_SERVO_STATE_LOCKED                  (2UL)   /*!< Offset within the step threshold: slew the frequency */
+/**
+ * @}
+ */
+
 /**
  * @defgroup ETH_PTP_Flag ETH PTP Flag
  * @{
@@ -2368,6 +2666,8 @@ en_result_t ETH_Stop(void);
 en_result_t ETH_PHY_WriteRegister(stc_eth_handle_t *pstcEthHandle, uint16_t u16Reg, uint16_t u16RegVal);
 en_result_t ETH_PHY_ReadRegister(stc_eth_handle_t *pstcEthHandle, uint16_t u16Reg, uint16_t *pu16RegVal);
 en_result_t ETH_PHY_LoopBackCmd(stc_eth_handle_t *pstcEthHandle, en_functional_state_t enNewSta);
+en_result_t ETH_PHY_LinkProcess(stc_eth_handle_t *pstcEthHandle, uint32_t u32ElapsedTime);
+uint32_t ETH_PHY_GetLinkState(const stc_eth_handle_t *pstcEthHandle);
 
 /* MAC Functions */
 void ETH_MAC_DeInit(void);
@@ -2396,6 +2696,15 @@ en_result_t ETH_MACADDR_GetAddress(uint32_t u32Index, uint8_t au8Addr[]);
 void ETH_MACADDR_SetFilterMode(uint32_t u32Index, uint32_t u32Mode);
 void ETH_MACADDR_SetFilterMask(uint32_t u32Index, uint32_t u32Mask);
 
+/* MAC Filter Manager Functions */
+uint32_t ETH_MAC_GetAddrHashIndex(const uint8_t au8Addr[]);
+uint32_t ETH_MAC_GetVlanHashIndex(uint16_t u16VlanTag, uint32_t u32Comparison);
+en_result_t ETH_MAC_FilterInit(stc_eth_mac_filter_t *pstcFilter, uint32_t u32SlotNum);
+en_result_t ETH_MAC_FilterAddAddr(stc_eth_mac_filter_t *pstcFilter, const uint8_t au8Addr[]);
+en_result_t ETH_MAC_FilterDelAddr(stc_eth_mac_filter_t *pstcFilter, const uint8_t au8Addr[]);
+en_result_t ETH_MAC_FilterAddVlan(stc_eth_mac_filter_t *pstcFilter, uint16_t u16VlanTag);
+en_result_t ETH_MAC_FilterDelVlan(stc_eth_mac_filter_t *pstcFilter, uint16_t u16VlanTag);
+
 /* MAC L3L4 Filter Functions */
 void ETH_MAC_L3L4FilterDeInit(void);
 en_result_t ETH_MAC_L3L4FilterInit(const stc_eth_l3l4_filter_config_t *pstcL3L4FilterInit);
@@ -2409,6 +2718,14 @@ void ETH_MAC_SetIpv4DestAddrFilterVal(uint32_t u32Addr);
 void ETH_MAC_SetIpv4SrcAddrFilterVal(uint32_t u32Addr);
 en_result_t ETH_MAC_SetIpv6AddrFilterVal(const uint32_t au32Addr[]);
 
+/* Flow Table Functions */
+en_result_t ETH_FLOW_TableInit(stc_eth_flow_table_t *pstcTable, uint32_t u32HwMode);
+en_result_t ETH_FLOW_RuleStructInit(stc_eth_flow_rule_t *pstcRule);
+en_result_t ETH_FLOW_AddRule(stc_eth_flow_table_t *pstcTable, const stc_eth_flow_rule_t *pstcRule, uint32_t *pu32RuleId);
+en_result_t ETH_FLOW_DelRule(stc_eth_flow_table_t *pstcTable, uint32_t u32RuleId);
+uint32_t ETH_FLOW_Lookup(const stc_eth_flow_table_t *pstcTable, const uint8_t au8Frame[],
+                         uint32_t u32Length, uint32_t u32ExtendStatus);
+
 /* DMA Functions */
 void ETH_DMA_DeInit(void);
 en_result_t ETH_DMA_Init(const stc_eth_dma_init_t *pstcDmaInit);
@@ -2438,8 +2755,21 @@ uint32_t ETH_DMA_GetCurRxBufferAddr(void);
 en_result_t ETH_DMA_TxDescListInit(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_desc_t astcTxDescTab[], const uint8_t au8TxBuffer[], uint32_t u32TxBufferCnt);
 en_result_t ETH_DMA_RxDescListInit(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_desc_t astcRxDescTab[], const uint8_t au8RxBuffer[], uint32_t u32RxBufferCnt);
 en_result_t ETH_DMA_SetTransmitFrame(stc_eth_handle_t *pstcEthHandle, uint32_t u32FrameLength);
+en_result_t ETH_DMA_SetTransmitFrameChecksum(stc_eth_handle_t *pstcEthHandle, uint32_t u32FrameLength, uint32_t u32ChecksumMode);
 en_result_t ETH_DMA_GetReceiveFrame(stc_eth_handle_t *pstcEthHandle);
 en_result_t ETH_DMA_GetReceiveFrame_Interrupt(stc_eth_handle_t *pstcEthHandle);
+en_result_t ETH_DMA_TxFrameStructInit(stc_eth_dma_tx_frame_t *pstcTxFrame);
+en_result_t ETH_DMA_SetTransmitSegments(stc_eth_handle_t *pstcEthHandle, const stc_eth_dma_tx_frame_t *pstcTxFrame);
+en_result_t ETH_DMA_ReclaimTransmitFrame(stc_eth_handle_t *pstcEthHandle, void **ppvArg);
+en_result_t ETH_DMA_TxCpltQueueInit(stc_eth_dma_tx_cplt_queue_t *pstcQueue, stc_eth_dma_tx_cplt_t astcBuf[], uint32_t u32Size);
+en_result_t ETH_DMA_ReclaimTransmitFrame_Interrupt(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_tx_cplt_queue_t *pstcQueue);
+en_result_t ETH_DMA_GetTransmitCplt(stc_eth_dma_tx_cplt_queue_t *pstcQueue, stc_eth_dma_tx_cplt_t *pstcCplt);
+en_result_t ETH_DMA_RxPoolInit(stc_eth_dma_rx_pool_t *pstcPool, uint8_t *apu8Ring[], uint32_t u32Size, uint32_t u32BufSize);
+en_result_t ETH_DMA_RxPoolPut(stc_eth_dma_rx_pool_t *pstcPool, uint8_t *pu8Buffer);
+en_result_t ETH_DMA_RxDescListPoolInit(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_desc_t astcRxDescTab[], uint32_t u32RxDescCnt, stc_eth_dma_rx_pool_t *pstcPool);
+en_result_t ETH_DMA_TakeReceiveFrame(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_rx_buf_t *pstcRxBuf);
+en_result_t ETH_DMA_TakeReceiveFrames(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_rx_buf_t astcRxBuf[], uint32_t u32MaxCnt, uint32_t *pu32Cnt);
+en_result_t ETH_DMA_RxIntCoalesceConfig(stc_eth_handle_t *pstcEthHandle, uint32_t u32FrameCnt, uint8_t u8Watchdog);
 en_result_t ETH_DMA_SetTxDescOwn(stc_eth_dma_desc_t *pstcTxDesc, uint32_t u32Owner);
 en_result_t ETH_DMA_SetTxDescBufferSize(stc_eth_dma_desc_t *pstcTxDesc, uint8_t u8BufferNum, uint32_t u32BufferSize);
 en_result_t ETH_DMA_TxDescChecksumInsertConfig(stc_eth_dma_desc_t *pstcTxDesc, uint32_t u32ChecksumMode);
@@ -2485,6 +2815,13 @@ en_flag_status_t ETH_MMC_GetTxStatus(uint32_t u32Flag);
 en_flag_status_t ETH_MMC_GetRxStatus(uint32_t u32Flag);
 uint32_t ETH_MMC_GetRegister(uint32_t u32Reg);
 
+/* Statistics Functions */
+en_result_t ETH_STAT_Init(stc_eth_stat_t *pstcStat);
+void ETH_STAT_Collect(stc_eth_stat_t *pstcStat);
+void ETH_STAT_AddBytes(stc_eth_stat_t *pstcStat, uint32_t u32RxBytes, uint32_t u32TxBytes);
+void ETH_STAT_Process(stc_eth_stat_t *pstcStat, uint32_t u32ElapsedTime);
+en_result_t ETH_STAT_GetSnapshot(const stc_eth_stat_t *pstcStat, stc_eth_stat_snapshot_t *pstcSnapshot);
+
 /* PTP Functions */
 void ETH_PTP_DeInit(void);
 en_result_t ETH_PTP_Init(const stc_eth_ptp_init_t *pstcPtpInit);
@@ -2503,6 +2840,14 @@ void ETH_PTP_SetUpdateTime(uint32_t u32Sign, uint32_t u32Sec, uint32_t u32SubSec
 void ETH_PTP_Cmd(en_functional_state_t enNewSta);
 void ETH_PTP_IntCmd(en_functional_state_t enNewSta);
 en_flag_status_t ETH_PTP_GetStatus(uint32_t u32Flag);
+en_result_t ETH_PTP_GetTimeNs(uint64_t *pu64Ns);
+uint64_t ETH_PTP_TimeStampToNs(uint32_t u32Sec, uint32_t u32SubSec);
+en_result_t ETH_PTP_AdjustTime(int64_t i64Offset);
+en_result_t ETH_PTP_AdjustFreq(uint32_t u32BaseAddend, int32_t i32Freq);
+en_result_t ETH_PTP_ServoStructInit(stc_eth_ptp_servo_init_t *pstcServoInit);
+en_result_t ETH_PTP_ServoInit(stc_eth_ptp_servo_t *pstcServo, const stc_eth_ptp_servo_init_t *pstcServoInit);
+uint32_t ETH_PTP_ServoSample(stc_eth_ptp_servo_t *pstcServo, int64_t i64Offset);
+en_result_t ETH_PTP_ServoUpdate(stc_eth_ptp_servo_t *pstcServo, int64_t i64Offset);
 
 /* PTP PPS Functions */
 void ETH_PPS_DeInit(uint8_t u8Ch);
@@ -2512,6 +2857,7 @@ void ETH_PPS_SetTargetTime(uint8_t u8Ch, uint32_t u32Sec, uint32_t u32SubSec);
 void ETH_PPS_SetTargetTimeFunc(uint8_t u8Ch, uint32_t u32Func);
 void ETH_PPS_SetPps0OutputMode(uint32_t u32OutputMode);
 void ETH_PPS_SetPps0OutputFreq(uint32_t u32OutputFreq);
+void ETH_PPS_AlignTargetTime(uint8_t u8Ch);
 
 /**
  * @}
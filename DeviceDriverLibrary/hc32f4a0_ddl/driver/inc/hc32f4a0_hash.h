@@ -7,6 +7,10 @@
    Change Logs:
    Date             Author          Notes
    2020-06-12       Heqb         First version
+   2026-10-17       Heqb         Add streaming context API HASH_CtxInit/HMAC_CtxInit,
+                                 HASH_Update and HASH_Final
+   2026-10-17       Heqb         Add DMA-fed calculation HASH_DMA_Start/HMAC_DMA_Start
+   2026-10-17       Heqb         The HASH DMA channel is claimed through DMA_ChClaim()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -64,6 +68,7 @@ extern "C"
  ******************************************************************************/
 #include "hc32_common.h"
 #include "ddl_config.h"
+#include "hc32f4a0_dma.h"
 
 /**
  * @addtogroup HC32F4A0_DDL_Driver
@@ -80,6 +85,47 @@ extern "C"
 /*******************************************************************************
  * Global type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup HASH_Global_Types HASH Global Types
+ * @{
+ */
+
+/**
+ * @brief HASH streaming context structure definition
+ * @note  The HASH engine keeps the intermediate digest internally, so only one
+ *        context can be in progress at a time.
+ */
+typedef struct
+{
+    uint32_t u32Mode;                   /*!< Operating mode of the stream.
+                                             This parameter can be a value of @ref HASH_Mode */
+    uint32_t u32MsgLenLow;              /*!< Message length fed so far in bytes, low 32 bits */
+    uint32_t u32MsgLenHigh;             /*!< Message length fed so far in bytes, high 32 bits */
+    uint32_t u32GrpCnt;                 /*!< Number of message groups written to the HASH engine */
+    uint32_t u32BufLen;                 /*!< Number of pending bytes in au8Buf */
+    uint8_t  au8Buf[64U];               /*!< Pending bytes of an incomplete group (HASH_GROUP_LEN bytes) */
+} stc_hash_ctx_t;
+
+/**
+ * @brief HASH DMA handle structure definition
+ */
+typedef struct
+{
+    M4_DMA_TypeDef      *DMAx;          /*!< DMA unit that feeds the HASH data registers: M4_DMA1 or M4_DMA2 */
+    uint8_t             u8DmaCh;        /*!< DMA channel that feeds the HASH data registers: DMA_CH0 ~ DMA_CH7 */
+    func_ptr_t          pfnCpltCallback;/*!< Called by HASH_DMA_IrqHandler() when the calculation is over, may be NULL */
+#if (DDL_DMA_ENABLE == DDL_ON)
+    stc_dma_ch_t        stcDmaCh;       /*!< Channel claimed by HASH_DMA_Start()/HMAC_DMA_Start() while the DMA runs */
+#endif /* DDL_DMA_ENABLE */
+    __IO en_result_t    enResult;       /*!< OperationInProgress while calculating, then Ok or the error code */
+    uint8_t             *pu8MsgDigest;  /*!< Buffer of the digest of the current calculation, 32 bytes */
+    const uint32_t      *pu32Tail;      /*!< Trailing words of the message that do not make up a complete group */
+    stc_hash_ctx_t      stcCtx;         /*!< Context of the current calculation */
+} stc_hash_dma_handle_t;
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Global pre-processor symbols/macros ('#define')
@@ -240,6 +286,31 @@ void HASH_ComTriggerCmd(uint8_t u8TrigReg, uint32_t u32ComTrig, \
                         en_functional_state_t enNewState);
 en_flag_status_t HASH_GetStatus(uint32_t u32HashFlag);
 void HASH_GetResult(uint8_t au8MsgDigest[]);
+
+en_result_t HASH_CtxInit(stc_hash_ctx_t *pstcCtx);
+en_result_t HMAC_CtxInit(stc_hash_ctx_t *pstcCtx,
+                         const uint8_t au8Key[],
+                         uint32_t u32KeyLength);
+en_result_t HASH_Update(stc_hash_ctx_t *pstcCtx,
+                        const void *pvSrcData,
+                        uint32_t u32SrcDataSize);
+en_result_t HASH_Final(stc_hash_ctx_t *pstcCtx, uint8_t au8MsgDigest[]);
+
+#if (DDL_DMA_ENABLE == DDL_ON)
+en_result_t HASH_DMA_StructInit(stc_hash_dma_handle_t *pstcHandle);
+en_result_t HASH_DMA_Start(stc_hash_dma_handle_t *pstcHandle,
+                           const uint32_t au32SrcData[],
+                           uint32_t u32SrcDataSize,
+                           uint8_t au8MsgDigest[]);
+en_result_t HMAC_DMA_Start(stc_hash_dma_handle_t *pstcHandle,
+                           const uint32_t au32SrcData[],
+                           uint32_t u32SrcDataSize,
+                           const uint8_t au8Key[],
+                           uint32_t u32KeyLength,
+                           uint8_t au8MsgDigest[]);
+void HASH_DMA_TransCpltIrqHandler(stc_hash_dma_handle_t *pstcHandle);
+void HASH_DMA_IrqHandler(stc_hash_dma_handle_t *pstcHandle);
+#endif /* DDL_DMA_ENABLE */
 /**
  * @}
  */
@@ -7,6 +7,8 @@
    Change Logs:
    Date             Author          Notes
    2020-06-12       Wangmin         First version
+   2026-10-17       Wangmin         Add DMA transaction queue SPI_DmaInit/SPI_DmaTransfer/SPI_DmaIrqHandler
+   2026-10-17       Wangmin         Claim the DMA channels of the queue, add SPI_DmaAbort/SPI_DmaErrIrqHandler
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -64,6 +66,8 @@ extern "C"
  ******************************************************************************/
 #include "hc32_common.h"
 #include "ddl_config.h"
+#include "hc32f4a0_dma.h"
+#include "hc32f4a0_gpio.h"
 
 /**
  * @addtogroup HC32F4A0_DDL_Driver
@@ -127,6 +131,79 @@ typedef struct
                                          This parameter can be a value of @ref SPI_Setup_Delay_Time_define */
 } stc_spi_delay_t;
 
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_GPIO_ENABLE == DDL_ON)
+/**
+ * @brief Structure definition of a device on the bus of the SPI DMA transaction queue.
+ */
+typedef struct
+{
+    uint8_t  u8CsPort;              /*!< GPIO port of the CS pin, GPIO_PORT_A ~ GPIO_PORT_I.
+                                         The pin is configured as an output by the application */
+    uint16_t u16CsPin;              /*!< GPIO pin of the CS pin, GPIO_PIN_00 ~ GPIO_PIN_15 */
+    uint32_t u32CsActiveLevel;      /*!< CS active level.
+                                         This parameter can be a value of @ref SPI_SS_Active_Level_Define */
+    uint32_t u32SpiMode;            /*!< SPI mode.
+                                         This parameter can be a value of @ref SPI_Mode_Define */
+    uint32_t u32BaudRatePrescaler;  /*!< SPI baud rate prescaler.
+                                         This parameter can be a value of @ref SPI_Baud_Rate_Prescaler_Define */
+    uint32_t u32DataBits;           /*!< SPI data bits, 4 bits ~ 32 bits.
+                                         This parameter can be a value of @ref SPI_Data_Size_Define */
+    uint32_t u32FirstBit;           /*!< MSB first or LSB first.
+                                         This parameter can be a value of @ref SPI_First_Bit_Define */
+} stc_spi_dma_dev_t;
+
+/**
+ * @brief Structure definition of a transaction of the SPI DMA transaction queue.
+ */
+typedef struct
+{
+    uint32_t    u32DevId;           /*!< Index of the device in the device table */
+    const void  *pvTxBuf;           /*!< Data to be sent, in byte, half word or word by the data bits of the device.
+                                         NULL: MOSI outputs high */
+    void        *pvRxBuf;           /*!< Buffer of the received data. NULL: the received data is discarded */
+    uint32_t    u32Length;          /*!< Data count, 1 ~ 65535 */
+    func_ptr_t  pfnCpltCallback;    /*!< Called by SPI_DmaIrqHandler() or SPI_DmaAbort() after CS is released,
+                                         may be NULL. stc_spi_dma_t::enXferResult tells how it ended */
+} stc_spi_dma_xfer_t;
+
+/**
+ * @brief Structure definition of SPI DMA transaction queue initialization.
+ */
+typedef struct
+{
+    M4_DMA_TypeDef              *TxDMAx;        /*!< DMA unit of the TX: M4_DMA1 or M4_DMA2 */
+    uint8_t                     u8TxDmaCh;      /*!< DMA channel of the TX: DMA_CH0 ~ DMA_CH7 */
+    M4_DMA_TypeDef              *RxDMAx;        /*!< DMA unit of the RX: M4_DMA1 or M4_DMA2 */
+    uint8_t                     u8RxDmaCh;      /*!< DMA channel of the RX: DMA_CH0 ~ DMA_CH7 */
+    const stc_spi_dma_dev_t     *pstcDev;       /*!< Device table, kept by the caller */
+    uint32_t                    u32DevNum;      /*!< Device count of the table */
+    stc_spi_dma_xfer_t          *pstcQueue;     /*!< Transaction queue, kept by the caller */
+    uint32_t                    u32QueueSize;   /*!< Transaction count of the queue, 2 at least.
+                                                     One entry is kept free to tell a full queue from an empty one */
+} stc_spi_dma_init_t;
+
+/**
+ * @brief Structure definition of SPI DMA transaction queue.
+ */
+typedef struct
+{
+    M4_SPI_TypeDef              *SPIx;          /*!< SPI unit */
+    stc_dma_ch_t                stcTxDmaCh;     /*!< DMA channel of the TX, claimed by SPI_DmaInit() */
+    stc_dma_ch_t                stcRxDmaCh;     /*!< DMA channel of the RX, claimed by SPI_DmaInit() */
+    const stc_spi_dma_dev_t     *pstcDev;       /*!< Device table */
+    uint32_t                    u32DevNum;      /*!< Device count of the table */
+    stc_spi_dma_xfer_t          *pstcQueue;     /*!< Transaction queue */
+    uint32_t                    u32QueueSize;   /*!< Transaction count of the queue */
+    __IO uint32_t               u32Head;        /*!< Index of the transaction in progress */
+    __IO uint32_t               u32Tail;        /*!< Index of the next free transaction */
+    __IO uint8_t                u8Busy;         /*!< 1 while a transaction is in progress */
+    __IO en_result_t            enXferResult;   /*!< Result of the transaction whose pfnCpltCallback is called:
+                                                     Ok, or Error when aborted by SPI_DmaAbort() */
+    uint32_t                    u32TxDummy;     /*!< Sent when pvTxBuf is NULL */
+    uint32_t                    u32RxDummy;     /*!< Receives the data when pvRxBuf is NULL */
+} stc_spi_dma_t;
+#endif /* DDL_DMA_ENABLE && DDL_GPIO_ENABLE */
+
 /**
  * @}
  */
@@ -453,6 +530,16 @@ en_result_t SPI_Transmit(M4_SPI_TypeDef *SPIx, const void *pvTxBuf, uint32_t u32
 en_result_t SPI_Receive(M4_SPI_TypeDef *SPIx, void *pvRxBuf, uint32_t u32RxLength);
 en_result_t SPI_TransmitReceive(M4_SPI_TypeDef *SPIx, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Length);
 
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_GPIO_ENABLE == DDL_ON)
+en_result_t SPI_DmaStructInit(stc_spi_dma_init_t *pstcInit);
+en_result_t SPI_DmaInit(stc_spi_dma_t *pstcSpiDma, M4_SPI_TypeDef *SPIx, const stc_spi_dma_init_t *pstcInit);
+en_result_t SPI_DmaTransfer(stc_spi_dma_t *pstcSpiDma, const stc_spi_dma_xfer_t *pstcXfer);
+en_flag_status_t SPI_DmaGetBusyStatus(const stc_spi_dma_t *pstcSpiDma);
+en_result_t SPI_DmaAbort(stc_spi_dma_t *pstcSpiDma);
+void SPI_DmaIrqHandler(stc_spi_dma_t *pstcSpiDma);
+void SPI_DmaErrIrqHandler(stc_spi_dma_t *pstcSpiDma);
+#endif /* DDL_DMA_ENABLE && DDL_GPIO_ENABLE */
+
 /**
  * @}
  */
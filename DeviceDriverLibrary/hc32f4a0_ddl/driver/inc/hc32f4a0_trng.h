@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2020-06-12       Heqb         First version
+   2026-10-17       Heqb         Add the entropy pool and the CTR_DRBG
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -64,6 +65,7 @@ extern "C"
  ******************************************************************************/
 #include "hc32_common.h"
 #include "ddl_config.h"
+#include "hc32f4a0_aes.h"
 
 /**
  * @addtogroup HC32F4A0_DDL_Driver
@@ -80,6 +82,50 @@ extern "C"
 /*******************************************************************************
  * Global type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup TRNG_Global_Types TRNG Global Types
+ * @{
+ */
+
+/**
+ * @brief TRNG entropy pool structure definition, see TRNG_PoolInit()
+ */
+typedef struct
+{
+    uint32_t            *pu32Buf;       /*!< Buffer of the pool */
+    uint32_t            u32Size;        /*!< Size of the buffer in words, a power of 2 */
+    __IO uint32_t       u32Head;        /*!< Words written, advanced by TRNG_PoolIrqHandler() */
+    __IO uint32_t       u32Tail;        /*!< Words read, advanced by TRNG_PoolRead() */
+    __IO uint32_t       u32Running;     /*!< 1 while a generation for the pool is in progress */
+    __IO en_result_t    enResult;       /*!< Ok, or Error after TRNG_HEALTH_FAIL_LIMIT failures in a row */
+    uint32_t            u32FailCnt;     /*!< Number of samples discarded by the health tests */
+    uint32_t            u32FailRun;     /*!< Number of failed samples in a row */
+    uint32_t            u32Startup;     /*!< Samples still to be tested and dropped by the start-up test */
+    uint32_t            u32RctCnt;      /*!< Repetition count test: length of the current run */
+    uint32_t            u32AptCnt;      /*!< Adaptive proportion test: matches in the window */
+    uint32_t            u32AptIdx;      /*!< Adaptive proportion test: position in the window */
+    uint8_t             u8RctLast;      /*!< Repetition count test: previous byte */
+    uint8_t             u8AptRef;       /*!< Adaptive proportion test: reference byte of the window */
+} stc_trng_pool_t;
+
+#if (DDL_AES_ENABLE == DDL_ON)
+/**
+ * @brief CTR_DRBG (NIST SP 800-90A, AES-256, no derivation function) structure
+ *        definition, see TRNG_DRBG_Init()
+ */
+typedef struct
+{
+    stc_aes_ctx_t       stcAes;         /*!< Key and V + 1 of the DRBG, as an AES-256 CTR context */
+    stc_trng_pool_t     *pstcPool;      /*!< Entropy pool used for seeding */
+    uint32_t            u32ReseedCnt;   /*!< Number of generate requests since the last reseed */
+    uint32_t            u32ReseedInterval; /*!< Reseed from the pool after this number of requests */
+    uint32_t            u32Seeded;      /*!< 1 once seeded from the pool, TRNG_DRBG_Generate() refuses to run before */
+} stc_trng_drbg_t;
+#endif /* DDL_AES_ENABLE */
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Global pre-processor symbols/macros ('#define')
@@ -112,6 +158,33 @@ extern "C"
  * @}
  */
 
+/**
+ * @defgroup TRNG_DRBG_Parameters TRNG CTR_DRBG Parameters
+ * @{
+ */
+#define TRNG_DRBG_SEED_LEN          (48U)                     /* Seed length: AES-256 key and block. */
+#define TRNG_DRBG_MAX_REQUEST       (65536UL)                 /* Bytes per generate request, longer reads are split. */
+#define TRNG_DRBG_RESEED_INTERVAL   (1024UL)                  /* Default number of requests between two reseeds. */
+#define TRNG_DRBG_RESEED_LIMIT      (0x100000UL)              /* Requests without reseed before generating stops. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TRNG_Health_Test TRNG Health Test Parameters
+ * @brief Continuous health tests of NIST SP 800-90B on the raw bytes, for a
+ *        min-entropy of 4 bits per byte and a false alarm rate of 2^-20.
+ * @{
+ */
+#define TRNG_HEALTH_RCT_CUTOFF      (6UL)                     /* Repetition count test: identical bytes in a row. */
+#define TRNG_HEALTH_APT_WINDOW      (512UL)                   /* Adaptive proportion test: window in bytes. */
+#define TRNG_HEALTH_APT_CUTOFF      (62UL)                    /* Adaptive proportion test: matches in the window. */
+#define TRNG_HEALTH_FAIL_LIMIT      (4UL)                     /* Failed samples in a row that stop the pool. */
+#define TRNG_HEALTH_STARTUP         (128UL)                   /* Start-up test: 64-bit samples dropped (1024 bytes). */
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -131,6 +204,24 @@ void TRNG_SetShiftCnt(uint32_t u32ShiftCount);
 void TRNG_ReloadCmd(uint32_t u32ReloadCmd);
 
 en_result_t TRNG_Generate(uint32_t au32Random[]);
+
+en_result_t TRNG_PoolInit(stc_trng_pool_t *pstcPool, uint32_t au32Buf[], uint32_t u32Size);
+void TRNG_PoolIrqHandler(stc_trng_pool_t *pstcPool);
+uint32_t TRNG_PoolGetCount(const stc_trng_pool_t *pstcPool);
+en_result_t TRNG_PoolRead(stc_trng_pool_t *pstcPool, uint32_t au32Random[], uint32_t u32Count);
+
+#if (DDL_AES_ENABLE == DDL_ON)
+en_result_t TRNG_DRBG_Init(stc_trng_drbg_t *pstcDrbg,
+                           stc_trng_pool_t *pstcPool,
+                           const uint8_t au8Pers[],
+                           uint32_t u32PersLength);
+en_result_t TRNG_DRBG_Reseed(stc_trng_drbg_t *pstcDrbg,
+                             const uint8_t au8Add[],
+                             uint32_t u32AddLength);
+en_result_t TRNG_DRBG_Generate(stc_trng_drbg_t *pstcDrbg,
+                               uint8_t au8Random[],
+                               uint32_t u32Size);
+#endif /* DDL_AES_ENABLE */
 /**
  * @}
  */
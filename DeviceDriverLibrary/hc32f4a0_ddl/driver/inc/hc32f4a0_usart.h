@@ -7,6 +7,10 @@
    Change Logs:
    Date             Author          Notes
    2020-06-12       Hongjh          First version
+   2026-10-17       Hongjh          Add buffered UART USART_BufInit/USART_BufWrite/USART_BufRead
+                                    and the interrupt handlers of the buffered UART
+   2026-10-17       Hongjh          Add precomputed baudrate configuration USART_BaudCfgCalc/USART_SetBaudCfg
+                                    and the compile-time macro USART_BAUD_CFG
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -64,6 +68,7 @@ extern "C"
  ******************************************************************************/
 #include "hc32_common.h"
 #include "ddl_config.h"
+#include "hc32f4a0_dma.h"
 
 /**
  * @addtogroup HC32F4A0_DDL_Driver
@@ -227,6 +232,92 @@ typedef struct
                                              This parameter can be a value of @ref USART_Hardware_Flow_Control */
 } stc_usart_clksync_init_t;
 
+/**
+ * @brief USART precomputed baudrate configuration structure definition
+ * @note  Fill it with USART_BaudCfgCalc() or the compile-time initializer USART_BAUD_CFG(),
+ *        then apply it with USART_SetBaudCfg().
+ */
+typedef struct
+{
+    uint32_t u32PclkDiv;                /*!< PCLK division.
+                                             This parameter can be a value of @ref USART_PCLK_Division */
+
+    uint32_t u32Brr;                    /*!< BRR register value: DIV_Integer and DIV_Fraction */
+
+    uint32_t u32FractEn;                /*!< CR1 FBME bit value: USART_CR1_FBME or 0 */
+
+    int32_t  i32Err;                    /*!< Baudrate error rate in ppm: (achieved / required - 1) * 1000000 */
+} stc_usart_baud_cfg_t;
+
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_TMR0_ENABLE == DDL_ON)
+/**
+ * @brief Buffered UART ring structure definition
+ * @note  Lock-free between one producer and one consumer: each index is written by one side only.
+ */
+typedef struct
+{
+    uint8_t         *pu8Buf;            /*!< Ring memory */
+    uint32_t        u32Size;            /*!< Ring size in bytes, a power of 2 */
+    __IO uint32_t   u32In;              /*!< Free running count of the bytes put, written by the producer */
+    __IO uint32_t   u32Out;             /*!< Free running count of the bytes taken, written by the consumer */
+} stc_usart_ring_t;
+
+/**
+ * @brief Buffered UART initialization structure definition
+ */
+typedef struct
+{
+    M4_DMA_TypeDef  *RxDMAx;            /*!< DMA unit of the RX: M4_DMA1 or M4_DMA2 */
+
+    uint8_t         u8RxDmaCh;          /*!< DMA channel of the RX: DMA_CH0 ~ DMA_CH7 */
+
+    M4_DMA_TypeDef  *TxDMAx;            /*!< DMA unit of the TX: M4_DMA1 or M4_DMA2 */
+
+    uint8_t         u8TxDmaCh;          /*!< DMA channel of the TX: DMA_CH0 ~ DMA_CH7 */
+
+    uint8_t         *pu8RxBuf;          /*!< RX ring memory */
+
+    uint32_t        u32RxBufSize;       /*!< RX ring size: a power of 2, 2 ~ 65536 */
+
+    uint8_t         *pu8TxBuf;          /*!< TX ring memory */
+
+    uint32_t        u32TxBufSize;       /*!< TX ring size: a power of 2, 2 ~ 65536 */
+
+    uint32_t        u32RtoClkSrc;       /*!< Clock source of the TMR0 channel of the RX timeout.
+                                             This parameter can be a value of @ref TMR0_Clock_Source_define */
+
+    uint32_t        u32RtoClkDiv;       /*!< Clock division of the TMR0 channel of the RX timeout.
+                                             This parameter can be a value of @ref TMR0_Clock_Division_define */
+
+    uint16_t        u16RtoCmpValue;     /*!< RX timeout in TMR0 counts after the last received data.
+                                             0: The RX timeout is not used (USART3/4/7/8/9/10 have none) */
+
+    func_ptr_t      pfnRxCallback;      /*!< Called when half of the RX ring is filled or on RX timeout, may be NULL */
+
+    func_ptr_t      pfnTxCallback;      /*!< Called when the TX ring gets empty, may be NULL */
+} stc_usart_buf_init_t;
+
+/**
+ * @brief Buffered UART handle structure definition
+ */
+typedef struct
+{
+    M4_USART_TypeDef            *USARTx;            /*!< USART unit */
+    stc_dma_ch_t                stcRxDmaCh;         /*!< DMA channel of the RX, claimed by USART_BufInit() */
+    stc_dma_ch_t                stcTxDmaCh;         /*!< DMA channel of the TX, claimed by USART_BufInit() */
+    stc_dma_llp_descriptor_t    astcRxDesc[2U];     /*!< RX DMA descriptors, one per half of the RX ring */
+    stc_usart_ring_t            stcRx;              /*!< RX ring, filled by the DMA */
+    stc_usart_ring_t            stcTx;              /*!< TX ring, emptied by the DMA */
+    __IO uint32_t               u32RxHalfIn;        /*!< RX count at the start of the RX DMA half in progress */
+    __IO uint32_t               u32TxSpan;          /*!< Bytes of the TX DMA transfer in progress */
+    __IO uint8_t                u8TxBusy;           /*!< 1 while the TX ring is being sent */
+    __IO uint32_t               u32RxOverrunCnt;    /*!< Times the RX ring was overwritten before being read */
+    __IO uint32_t               u32RxErrCnt;        /*!< Parity, framing and overrun errors of the USART */
+    func_ptr_t                  pfnRxCallback;      /*!< Called when RX data is ready */
+    func_ptr_t                  pfnTxCallback;      /*!< Called when the TX ring gets empty */
+} stc_usart_buf_t;
+#endif /* DDL_DMA_ENABLE && DDL_TMR0_ENABLE */
+
 /**
  * @}
  */
@@ -516,6 +607,83 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup USART_Baudrate_Clock_Factor USART Baudrate Clock Factor
+ * @brief    USART clock cycles per bit for (DIV_Integer + 1) = 1, selected by the USART mode.
+ * @{
+ */
+#define USART_BAUD_FACTOR_UART_OVER16       (16UL)              /*!< UART/LIN mode, oversampling by 16 bits */
+#define USART_BAUD_FACTOR_UART_OVER8        (8UL)               /*!< UART/LIN mode, oversampling by 8 bits */
+#define USART_BAUD_FACTOR_CLKSYNC           (4UL)               /*!< Clock synchronization mode */
+#define USART_BAUD_FACTOR_SC_ETU_32         (64UL)              /*!< Smartcard mode, 1 etu = 32/f */
+#define USART_BAUD_FACTOR_SC_ETU_64         (128UL)             /*!< Smartcard mode, 1 etu = 64/f */
+#define USART_BAUD_FACTOR_SC_ETU_128        (256UL)             /*!< Smartcard mode, 1 etu = 128/f */
+#define USART_BAUD_FACTOR_SC_ETU_256        (512UL)             /*!< Smartcard mode, 1 etu = 256/f */
+#define USART_BAUD_FACTOR_SC_ETU_372        (744UL)             /*!< Smartcard mode, 1 etu = 372/f */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup USART_Baudrate_Config USART Precomputed Baudrate Configuration
+ * @brief    Integer-only constant expressions for building stc_usart_baud_cfg_t tables at compile time.
+ *           The parameters are:
+ *           - pclk:    PCLK1 frequency(Hz) before the USART PCLK division
+ *           - baud:    Required baudrate
+ *           - factor:  A value of @ref USART_Baudrate_Clock_Factor
+ *           - fract:   Enable for the instances that support the baudrate fraction, otherwise Disable
+ * @note   The smallest PCLK division that keeps DIV_Integer <= 0xFF is selected, and the results are
+ *         the same as USART_SetBaudrate() with that PCLK division.
+ *         The configuration is valid only if USART_BAUD_CFG_VALID() is non-zero.
+ * @{
+ */
+#define USART_BAUD_CFG_K(baud, factor)                                         \
+(   (uint64_t)(baud) * (uint64_t)(factor))
+
+#define USART_BAUD_CFG_PSC(pclk, baud, factor)                                 \
+(   (((uint64_t)(pclk) / USART_BAUD_CFG_K((baud), (factor))) <= 256ULL) ? 0UL :\
+    (((uint64_t)(pclk) / (4ULL * USART_BAUD_CFG_K((baud), (factor)))) <= 256ULL) ? 1UL :\
+    (((uint64_t)(pclk) / (16ULL * USART_BAUD_CFG_K((baud), (factor)))) <= 256ULL) ? 2UL : 3UL)
+
+#define USART_BAUD_CFG_CLK(pclk, baud, factor)                                 \
+(   (uint64_t)(pclk) >> (2UL * USART_BAUD_CFG_PSC((pclk), (baud), (factor))))
+
+/* (DIV_Integer + 1) */
+#define USART_BAUD_CFG_DIV(pclk, baud, factor)                                 \
+(   USART_BAUD_CFG_CLK((pclk), (baud), (factor)) / USART_BAUD_CFG_K((baud), (factor)))
+
+#define USART_BAUD_CFG_VALID(pclk, baud, factor)                               \
+(   (USART_BAUD_CFG_DIV((pclk), (baud), (factor)) >= 1ULL)         &&          \
+    (USART_BAUD_CFG_DIV((pclk), (baud), (factor)) <= 256ULL))
+
+#define USART_BAUD_CFG_FRACT(pclk, baud, factor, fract)                        \
+(   ((Enable == (fract)) &&                                                    \
+     (0ULL != (USART_BAUD_CFG_CLK((pclk), (baud), (factor)) % USART_BAUD_CFG_K((baud), (factor))))) ? \
+    (uint32_t)((256ULL * USART_BAUD_CFG_K((baud), (factor)) * USART_BAUD_CFG_DIV((pclk), (baud), (factor))) / \
+               USART_BAUD_CFG_CLK((pclk), (baud), (factor)) - 128ULL) : 0UL)
+
+#define USART_BAUD_CFG_BRR(pclk, baud, factor, fract)                          \
+(   ((uint32_t)(USART_BAUD_CFG_DIV((pclk), (baud), (factor)) - 1ULL) << USART_BRR_DIV_INTEGER_POS) | \
+    USART_BAUD_CFG_FRACT((pclk), (baud), (factor), (fract)))
+
+#define USART_BAUD_CFG_ERR(pclk, baud, factor, fract)                          \
+(   (int32_t)((int64_t)((USART_BAUD_CFG_CLK((pclk), (baud), (factor)) *        \
+                         (0UL == USART_BAUD_CFG_FRACT((pclk), (baud), (factor), (fract)) ? 256ULL : \
+                          (128ULL + USART_BAUD_CFG_FRACT((pclk), (baud), (factor), (fract)))) * 1000000ULL) / \
+                        (256ULL * USART_BAUD_CFG_K((baud), (factor)) * USART_BAUD_CFG_DIV((pclk), (baud), (factor)))) - \
+              1000000LL))
+
+#define USART_BAUD_CFG(pclk, baud, factor, fract)                              \
+{                                                                              \
+    (USART_BAUD_CFG_PSC((pclk), (baud), (factor)) << USART_PR_PSC_POS),        \
+    USART_BAUD_CFG_BRR((pclk), (baud), (factor), (fract)),                     \
+    ((0UL != USART_BAUD_CFG_FRACT((pclk), (baud), (factor), (fract))) ? USART_CR1_FBME : 0UL), \
+    USART_BAUD_CFG_ERR((pclk), (baud), (factor), (fract))                      \
+}
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -617,6 +785,33 @@ uint32_t USART_GetLinSendBreakLen(const M4_USART_TypeDef *USARTx);
 en_result_t USART_SetBaudrate(M4_USART_TypeDef *USARTx,
                                     uint32_t u32Baudrate,
                                     float32_t *pf32Err);
+en_result_t USART_BaudCfgCalc(uint32_t u32Pclk,
+                                    uint32_t u32Baudrate,
+                                    uint32_t u32Factor,
+                                    en_functional_state_t enFraction,
+                                    stc_usart_baud_cfg_t *pstcCfg);
+en_result_t USART_SetBaudCfg(M4_USART_TypeDef *USARTx,
+                                    const stc_usart_baud_cfg_t *pstcCfg);
+
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_TMR0_ENABLE == DDL_ON)
+en_result_t USART_BufStructInit(stc_usart_buf_init_t *pstcInit);
+en_result_t USART_BufInit(stc_usart_buf_t *pstcBuf,
+                            M4_USART_TypeDef *USARTx,
+                            const stc_usart_buf_init_t *pstcInit);
+uint32_t USART_BufWrite(stc_usart_buf_t *pstcBuf,
+                            const uint8_t au8Data[],
+                            uint32_t u32Len);
+uint32_t USART_BufRead(stc_usart_buf_t *pstcBuf,
+                            uint8_t au8Data[],
+                            uint32_t u32Len);
+uint32_t USART_BufGetRxCount(const stc_usart_buf_t *pstcBuf);
+uint32_t USART_BufGetTxFree(const stc_usart_buf_t *pstcBuf);
+void USART_BufRxDmaIrqHandler(stc_usart_buf_t *pstcBuf);
+void USART_BufRxTimeoutIrqHandler(stc_usart_buf_t *pstcBuf);
+void USART_BufRxErrIrqHandler(stc_usart_buf_t *pstcBuf);
+void USART_BufTxEmptyIrqHandler(stc_usart_buf_t *pstcBuf);
+void USART_BufTxDmaIrqHandler(stc_usart_buf_t *pstcBuf);
+#endif /* DDL_DMA_ENABLE && DDL_TMR0_ENABLE */
 
 /**
  * @}
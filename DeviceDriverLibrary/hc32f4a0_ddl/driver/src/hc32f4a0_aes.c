@@ -7,6 +7,9 @@
    Change Logs:
    Date             Author          Notes
    2020-06-12       Heqb          First version
+   2026-10-17       Heqb          1. Load the key once per call in AES_Encrypt()/AES_Decrypt()
+                                  2. Add CBC/CTR/CFB mode context and GCM functions
+                                  3. Add non-blocking AES job functions
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -95,6 +98,15 @@
  * @}
  */
 
+/* Direction of the block calculation, value of AES_CR.MODE */
+#define AES_DIR_ENCRYPT               (0UL)
+#define AES_DIR_DECRYPT               (AES_CR_MODE)
+
+/* GCM: length of the IV which is used as J0 directly, and the tag length range */
+#define AES_GCM_IV_LEN                (12UL)
+#define AES_GCM_TAG_LEN_MIN           (4UL)
+#define AES_GCM_TAG_LEN_MAX           (16UL)
+
 /**
  * @defgroup AES_Check_Parameters_Validity AES Check Parameters Validity
  * @{
@@ -103,6 +115,16 @@
 (   ((x) == AES_KEY_LEN_128BIT)                  ||                            \
     ((x) == AES_KEY_LEN_192BIT)                  ||                            \
     ((x) == AES_KEY_LEN_256BIT))
+
+#define IS_AES_MODE(x)                                                         \
+(   ((x) == AES_MODE_ECB)                        ||                            \
+    ((x) == AES_MODE_CBC)                        ||                            \
+    ((x) == AES_MODE_CTR)                        ||                            \
+    ((x) == AES_MODE_CFB))
+
+#define IS_AES_GCM_TAG_LEN(x)                                                  \
+(   ((x) >= AES_GCM_TAG_LEN_MIN)                 &&                            \
+    ((x) <= AES_GCM_TAG_LEN_MAX))
 /**
  * @}
  */
@@ -120,10 +142,62 @@
 static void AES_WriteData(const uint8_t *pu8Srcdata);
 static void AES_ReadData(const uint8_t *pu8Result);
 static void AES_WriteKey(const uint8_t *pu8Key, uint8_t u8KeyLength);
+static uint32_t AES_GetKeySize(uint8_t u8KeyLength);
+static en_result_t AES_CalcBlock(const uint8_t *pu8Input, uint8_t *pu8Output, uint32_t u32Dir);
+static void AES_CtxLoadKey(const stc_aes_ctx_t *pstcCtx);
+static void AES_CounterInc(uint8_t au8Counter[], uint32_t u32Width);
+static en_result_t AES_CtxCheck(const stc_aes_ctx_t *pstcCtx,
+                                const uint8_t au8Input[],
+                                uint32_t u32Size,
+                                const uint8_t au8Output[]);
+static uint32_t AES_CtxStreamTail(stc_aes_ctx_t *pstcCtx,
+                                  const uint8_t au8Input[],
+                                  uint32_t u32Size,
+                                  uint8_t au8Output[],
+                                  uint32_t u32Dir);
+static uint32_t AES_CtxBlockPre(stc_aes_ctx_t *pstcCtx,
+                                const uint8_t au8Input[],
+                                uint32_t u32Dir,
+                                uint8_t au8Block[]);
+static void AES_CtxBlockPost(stc_aes_ctx_t *pstcCtx,
+                             const uint8_t au8Input[],
+                             uint8_t au8Output[],
+                             uint32_t u32Len,
+                             uint32_t u32Dir,
+                             const uint8_t au8Block[]);
+static en_result_t AES_CtxCrypt(stc_aes_ctx_t *pstcCtx,
+                                const uint8_t au8Input[],
+                                uint32_t u32Size,
+                                uint8_t au8Output[],
+                                uint32_t u32Dir);
+static en_result_t AES_JobStart(stc_aes_job_t *pstcJob,
+                                stc_aes_ctx_t *pstcCtx,
+                                const uint8_t au8Input[],
+                                uint32_t u32Size,
+                                uint8_t au8Output[],
+                                func_ptr_t pfnCallback,
+                                uint32_t u32Dir);
+static void AES_JobNextBlock(stc_aes_job_t *pstcJob);
+static void AES_JobDone(stc_aes_job_t *pstcJob, en_result_t enResult);
+static void AES_GcmGenTable(stc_aes_gcm_ctx_t *pstcCtx, const uint8_t au8H[]);
+static void AES_GcmMult(const stc_aes_gcm_ctx_t *pstcCtx, const uint8_t au8X[], uint8_t au8Output[]);
+static void AES_GcmGhash(const stc_aes_gcm_ctx_t *pstcCtx, uint8_t au8Y[],
+                         const uint8_t au8Data[], uint32_t u32Size);
+static void AES_GcmLenBlock(uint8_t au8Block[], uint32_t u32Len1, uint32_t u32Len2);
+static en_result_t AES_GcmCrypt(stc_aes_gcm_ctx_t *pstcCtx,
+                                const uint8_t au8Iv[], uint32_t u32IvLength,
+                                const uint8_t au8Aad[], uint32_t u32AadLength,
+                                const uint8_t au8Input[], uint32_t u32Size,
+                                uint8_t au8Output[], uint8_t au8Tag[],
+                                uint32_t u32Dir);
 
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/* Context whose key is currently loaded in the key registers, NULL if unknown. */
+static const stc_aes_ctx_t *m_pstcKeyCtx = NULL;
+/* Job which is using the AES unit, NULL if none. */
+static stc_aes_job_t *m_pstcJob = NULL;
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -144,6 +218,7 @@ static void AES_WriteKey(const uint8_t *pu8Key, uint8_t u8KeyLength);
  *         Ok: Encryption successfully.
  *         ErrorInvalidParameter: Invalid parameter
  *         ErrorTimeout: Encryption error timeout
+ *         ErrorOperationInProgress: An AES job is in progress
  */
 en_result_t AES_Encrypt(uint8_t au8Plaintext[],
                         uint32_t u32PlaintextSize,
@@ -152,7 +227,6 @@ en_result_t AES_Encrypt(uint8_t au8Plaintext[],
                         uint8_t au8Ciphertext[])
 {
     en_result_t   enRet = ErrorInvalidParameter;
-    uint32_t u32TimeCount = 0UL;
     uint32_t u32Index = 0UL;
     uint8_t au8FillBuffer[16U] = {0U};
     if((au8Plaintext != NULL) && (u32PlaintextSize != 0UL)   \
@@ -160,75 +234,28 @@ en_result_t AES_Encrypt(uint8_t au8Plaintext[],
           && (au8Ciphertext != NULL))
     {
         DDL_ASSERT(IS_AES_KEYLENGTH(u8KeyLength));
-        enRet = Ok;
-        while(u32PlaintextSize > 0UL)
+        enRet = (m_pstcJob == NULL) ? Ok : ErrorOperationInProgress;
+        if (enRet == Ok)
+        {
+            /* The key is loaded once for all blocks. */
+            AES_WriteKey(pu8Key, u8KeyLength);
+            MODIFY_REG32(M4_AES->CR, AES_CR_KEYSIZE, AES_GetKeySize(u8KeyLength));
+            m_pstcKeyCtx = NULL;
+        }
+        while((u32PlaintextSize > 0UL) && (enRet == Ok))
         {
-            /* Wait for AES to stop */
-            while(READ_REG32_BIT(M4_AES->CR, AES_CR_START) == 1U)
+            if (u32PlaintextSize >= AES_BLOCK_LEN)
             {
-                if(u32TimeCount++ >= AES_TIMEOUT)
-                {
-                    enRet = ErrorTimeout;
-                    break;
-                }
+                enRet = AES_CalcBlock(&au8Plaintext[u32Index], &au8Ciphertext[u32Index], AES_DIR_ENCRYPT);
+                u32PlaintextSize -= AES_BLOCK_LEN;
             }
-            if (enRet == Ok)
+            else
             {
-                if (u32PlaintextSize >= AES_BLOCK_LEN)
-                {
-                    AES_WriteData(&au8Plaintext[u32Index]);
-                }
-                else
-                {
-                    memcpy(au8FillBuffer, &au8Plaintext[u32Index], u32PlaintextSize);
-                    AES_WriteData(&au8FillBuffer[0U]);
-                }
-                AES_WriteKey(pu8Key, u8KeyLength);
-                switch (u8KeyLength)
-                {
-                case AES_KEY_LEN_128BIT:
-                    MODIFY_REG32(M4_AES->CR, AES_CR_KEYSIZE, AES_KEY_SIZE_128BIT);
-                    break;
-
-                case AES_KEY_LEN_192BIT:
-                    MODIFY_REG32(M4_AES->CR, AES_CR_KEYSIZE, AES_KEY_SIZE_192BIT);
-                    break;
-
-                case AES_KEY_LEN_256BIT:
-                    MODIFY_REG32(M4_AES->CR, AES_CR_KEYSIZE, AES_KEY_SIZE_256BIT);
-                    break;
-
-                default:
-                    break;
-                }
-                /* Set AES encrypt. */
-                CLEAR_REG32_BIT(M4_AES->CR, AES_CR_MODE);
-                /* Start AES calculating. */
-                SET_REG32_BIT(M4_AES->CR, AES_CR_START);
-                /* Wait for AES to stop */
-                u32TimeCount = 0UL;
-                while(READ_REG32_BIT(M4_AES->CR, AES_CR_START) == 1U)
-                {
-                    if(u32TimeCount++ > AES_TIMEOUT)
-                    {
-                        enRet = ErrorTimeout;
-                        break;
-                    }
-                }
-                if (enRet == Ok)
-                {
-                    AES_ReadData(&au8Ciphertext[u32Index]);
-                    if (u32PlaintextSize < AES_BLOCK_LEN)
-                    {
-                        u32PlaintextSize = 0UL;
-                    }
-                    else
-                    {
-                        u32PlaintextSize -= AES_BLOCK_LEN;
-                    }
-                    u32Index += AES_BLOCK_LEN;
-                }
+                memcpy(au8FillBuffer, &au8Plaintext[u32Index], u32PlaintextSize);
+                enRet = AES_CalcBlock(&au8FillBuffer[0U], &au8Ciphertext[u32Index], AES_DIR_ENCRYPT);
+                u32PlaintextSize = 0UL;
             }
+            u32Index += AES_BLOCK_LEN;
         }
     }
     return enRet;
@@ -245,6 +272,7 @@ en_result_t AES_Encrypt(uint8_t au8Plaintext[],
  *         Ok: Decryption successfully.
  *         ErrorInvalidParameter: Invalid parameter
  *         ErrorTimeout: Decryption error timeout
+ *         ErrorOperationInProgress: An AES job is in progress
  */
 en_result_t AES_Decrypt(uint8_t au8Ciphertext[],
                         uint32_t u32CiphertextSize,
@@ -253,69 +281,1111 @@ en_result_t AES_Decrypt(uint8_t au8Ciphertext[],
                         uint8_t au8Plaintext[])
 {
     en_result_t   enRet = Ok;
-    uint32_t u32TimeCount = 0UL;
     uint32_t u32Index = 0UL;
+    uint8_t au8FillBuffer[16U] = {0U};
     if((au8Plaintext != NULL) && (u32CiphertextSize != 0UL)   \
           && (pu8Key != NULL) && (u8KeyLength != 0U)          \
           && (au8Ciphertext != NULL))
     {
         DDL_ASSERT(IS_AES_KEYLENGTH(u8KeyLength));
+        enRet = (m_pstcJob == NULL) ? Ok : ErrorOperationInProgress;
+        if (enRet == Ok)
+        {
+            /* The key is loaded once for all blocks. */
+            AES_WriteKey(pu8Key, u8KeyLength);
+            MODIFY_REG32(M4_AES->CR, AES_CR_KEYSIZE, AES_GetKeySize(u8KeyLength));
+            m_pstcKeyCtx = NULL;
+        }
+        while((u32CiphertextSize > 0UL) && (enRet == Ok))
+        {
+            if (u32CiphertextSize >= AES_BLOCK_LEN)
+            {
+                enRet = AES_CalcBlock(&au8Ciphertext[u32Index], &au8Plaintext[u32Index], AES_DIR_DECRYPT);
+                u32CiphertextSize -= AES_BLOCK_LEN;
+            }
+            else
+            {
+                memcpy(au8FillBuffer, &au8Ciphertext[u32Index], u32CiphertextSize);
+                enRet = AES_CalcBlock(&au8FillBuffer[0U], &au8Plaintext[u32Index], AES_DIR_DECRYPT);
+                u32CiphertextSize = 0UL;
+            }
+            u32Index += AES_BLOCK_LEN;
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Initialize an AES block cipher mode context.
+ * @param  [in] pstcCtx            Pointer to the context.
+ * @param  [in] u32Mode            Block cipher mode.
+ *                                 This parameter can be a value of @ref AES_Cipher_Mode
+ *   @arg  AES_MODE_ECB:           Electronic codebook, whole blocks only.
+ *   @arg  AES_MODE_CBC:           Cipher block chaining, whole blocks only.
+ *   @arg  AES_MODE_CTR:           Counter mode, any length. au8Iv is the initial
+ *                                 counter block, incremented as a 128-bit big-endian number.
+ *   @arg  AES_MODE_CFB:           128-bit cipher feedback, any length.
+ * @param  [in] pu8Key             Pointer to the AES key.
+ * @param  [in] u8KeyLength        Length of the key in bytes, 16, 24 or 32.
+ * @param  [in] au8Iv              Buffer of the 16-byte IV or initial counter block.
+ *                                 NULL for an all-zero block. Not used in ECB mode.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Initialize successfully.
+ *         ErrorInvalidParameter: Invalid parameter
+ */
+en_result_t AES_CtxInit(stc_aes_ctx_t *pstcCtx,
+                        uint32_t u32Mode,
+                        const uint8_t *pu8Key,
+                        uint8_t u8KeyLength,
+                        const uint8_t au8Iv[])
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcCtx != NULL) && (pu8Key != NULL) && (IS_AES_KEYLENGTH(u8KeyLength)))
+    {
+        DDL_ASSERT(IS_AES_MODE(u32Mode));
+
+        if (m_pstcKeyCtx == pstcCtx)
+        {
+            m_pstcKeyCtx = NULL;
+        }
+        pstcCtx->u32Mode     = u32Mode;
+        pstcCtx->u32KeySize  = AES_GetKeySize(u8KeyLength);
+        pstcCtx->u8KeyLength = u8KeyLength;
+        (void)memset(pstcCtx->au8Key, 0, sizeof(pstcCtx->au8Key));
+        (void)memcpy(pstcCtx->au8Key, pu8Key, u8KeyLength);
+        enRet = AES_CtxSetIv(pstcCtx, au8Iv);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set the IV (CBC/CFB) or the counter block (CTR) of the context, for
+ *         example at the start of a new record. The key is kept.
+ * @param  [in] pstcCtx            Pointer to the context.
+ * @param  [in] au8Iv              Buffer of the 16-byte IV or counter block, NULL for all-zero.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Set successfully.
+ *         ErrorInvalidParameter: pstcCtx == NULL
+ */
+en_result_t AES_CtxSetIv(stc_aes_ctx_t *pstcCtx, const uint8_t au8Iv[])
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcCtx != NULL)
+    {
+        if (au8Iv != NULL)
+        {
+            (void)memcpy(pstcCtx->au8Iv, au8Iv, AES_BLOCK_LEN);
+        }
+        else
+        {
+            (void)memset(pstcCtx->au8Iv, 0, AES_BLOCK_LEN);
+        }
+        pstcCtx->u8StreamPos = 0U;
         enRet = Ok;
-        while(u32CiphertextSize > 0UL)
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Encrypt data with the block cipher mode of the context. The chaining
+ *         state is kept in the context, so a stream can be split over calls.
+ * @param  [in] pstcCtx            Pointer to the context initialized by AES_CtxInit().
+ * @param  [in] au8Plaintext       Buffer of the plaintext.
+ * @param  [in] u32Size            Length of the plaintext in bytes. A multiple of
+ *                                 16 in ECB and CBC mode, any length in CTR and CFB mode.
+ * @param  [out] au8Ciphertext     Buffer of the ciphertext, may be the same as au8Plaintext.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Encryption successfully.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         ErrorTimeout: Encryption error timeout
+ *         ErrorOperationInProgress: An AES job is in progress
+ */
+en_result_t AES_CtxEncrypt(stc_aes_ctx_t *pstcCtx,
+                           const uint8_t au8Plaintext[],
+                           uint32_t u32Size,
+                           uint8_t au8Ciphertext[])
+{
+    return AES_CtxCrypt(pstcCtx, au8Plaintext, u32Size, au8Ciphertext, AES_DIR_ENCRYPT);
+}
+
+/**
+ * @brief  Decrypt data with the block cipher mode of the context. The chaining
+ *         state is kept in the context, so a stream can be split over calls.
+ * @param  [in] pstcCtx            Pointer to the context initialized by AES_CtxInit().
+ * @param  [in] au8Ciphertext      Buffer of the ciphertext.
+ * @param  [in] u32Size            Length of the ciphertext in bytes. A multiple of
+ *                                 16 in ECB and CBC mode, any length in CTR and CFB mode.
+ * @param  [out] au8Plaintext      Buffer of the plaintext, may be the same as au8Ciphertext.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Decryption successfully.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         ErrorTimeout: Decryption error timeout
+ *         ErrorOperationInProgress: An AES job is in progress
+ */
+en_result_t AES_CtxDecrypt(stc_aes_ctx_t *pstcCtx,
+                           const uint8_t au8Ciphertext[],
+                           uint32_t u32Size,
+                           uint8_t au8Plaintext[])
+{
+    return AES_CtxCrypt(pstcCtx, au8Ciphertext, u32Size, au8Plaintext, AES_DIR_DECRYPT);
+}
+
+/**
+ * @brief  Initialize an AES-GCM context: store the key and compute the GHASH
+ *         table of the hash subkey H = AES(key, 0).
+ * @param  [in] pstcCtx            Pointer to the GCM context.
+ * @param  [in] pu8Key             Pointer to the AES key.
+ * @param  [in] u8KeyLength        Length of the key in bytes, 16, 24 or 32.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Initialize successfully.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         ErrorTimeout: AES error timeout
+ *         ErrorOperationInProgress: An AES job is in progress
+ */
+en_result_t AES_GCM_Init(stc_aes_gcm_ctx_t *pstcCtx,
+                         const uint8_t *pu8Key,
+                         uint8_t u8KeyLength)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint8_t au8H[16U] = {0U};
+
+    if (pstcCtx != NULL)
+    {
+        enRet = AES_CtxInit(&pstcCtx->stcAes, AES_MODE_ECB, pu8Key, u8KeyLength, NULL);
+        if ((enRet == Ok) && (m_pstcJob != NULL))
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        if (enRet == Ok)
+        {
+            AES_CtxLoadKey(&pstcCtx->stcAes);
+            enRet = AES_CalcBlock(au8H, au8H, AES_DIR_ENCRYPT);
+            if (enRet == Ok)
+            {
+                AES_GcmGenTable(pstcCtx, au8H);
+            }
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  AES-GCM authenticated encryption of one record.
+ * @param  [in] pstcCtx            Pointer to the GCM context initialized by AES_GCM_Init().
+ * @param  [in] au8Iv              Buffer of the IV. It must never be reused with the same key.
+ * @param  [in] u32IvLength        Length of the IV in bytes, 12 is recommended.
+ * @param  [in] au8Aad             Buffer of the additional authenticated data, may be NULL if u32AadLength is 0.
+ * @param  [in] u32AadLength       Length of the additional authenticated data in bytes.
+ * @param  [in] au8Plaintext       Buffer of the plaintext, may be NULL if u32Size is 0.
+ * @param  [in] u32Size            Length of the plaintext in bytes.
+ * @param  [out] au8Ciphertext     Buffer of the ciphertext, u32Size bytes, may be the same as au8Plaintext.
+ * @param  [out] au8Tag            Buffer of the authentication tag.
+ * @param  [in] u32TagLength       Length of the tag in bytes, 4 ~ 16.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Encryption successfully.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         ErrorTimeout: Encryption error timeout
+ *         ErrorOperationInProgress: An AES job is in progress
+ */
+en_result_t AES_GCM_Encrypt(stc_aes_gcm_ctx_t *pstcCtx,
+                            const uint8_t au8Iv[], uint32_t u32IvLength,
+                            const uint8_t au8Aad[], uint32_t u32AadLength,
+                            const uint8_t au8Plaintext[], uint32_t u32Size,
+                            uint8_t au8Ciphertext[],
+                            uint8_t au8Tag[], uint32_t u32TagLength)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint8_t au8FullTag[16U];
+
+    if ((pstcCtx != NULL) && (au8Tag != NULL) && (IS_AES_GCM_TAG_LEN(u32TagLength)))
+    {
+        enRet = AES_GcmCrypt(pstcCtx, au8Iv, u32IvLength, au8Aad, u32AadLength,
+                             au8Plaintext, u32Size, au8Ciphertext, au8FullTag, AES_DIR_ENCRYPT);
+        if (enRet == Ok)
+        {
+            (void)memcpy(au8Tag, au8FullTag, u32TagLength);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  AES-GCM authenticated decryption of one record.
+ * @param  [in] pstcCtx            Pointer to the GCM context initialized by AES_GCM_Init().
+ * @param  [in] au8Iv              Buffer of the IV used for encryption.
+ * @param  [in] u32IvLength        Length of the IV in bytes.
+ * @param  [in] au8Aad             Buffer of the additional authenticated data, may be NULL if u32AadLength is 0.
+ * @param  [in] u32AadLength       Length of the additional authenticated data in bytes.
+ * @param  [in] au8Ciphertext      Buffer of the ciphertext, may be NULL if u32Size is 0.
+ * @param  [in] u32Size            Length of the ciphertext in bytes.
+ * @param  [out] au8Plaintext      Buffer of the plaintext, u32Size bytes, may be the same as au8Ciphertext.
+ * @param  [in] au8Tag             Buffer of the received authentication tag.
+ * @param  [in] u32TagLength       Length of the tag in bytes, 4 ~ 16.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Decryption successfully and the tag matches.
+ *         Error: The tag does not match, au8Plaintext is cleared.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         ErrorTimeout: Decryption error timeout
+ *         ErrorOperationInProgress: An AES job is in progress
+ */
+en_result_t AES_GCM_Decrypt(stc_aes_gcm_ctx_t *pstcCtx,
+                            const uint8_t au8Iv[], uint32_t u32IvLength,
+                            const uint8_t au8Aad[], uint32_t u32AadLength,
+                            const uint8_t au8Ciphertext[], uint32_t u32Size,
+                            uint8_t au8Plaintext[],
+                            const uint8_t au8Tag[], uint32_t u32TagLength)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint8_t au8FullTag[16U];
+    uint8_t u8Diff = 0U;
+    uint32_t i;
+
+    if ((pstcCtx != NULL) && (au8Tag != NULL) && (IS_AES_GCM_TAG_LEN(u32TagLength)))
+    {
+        enRet = AES_GcmCrypt(pstcCtx, au8Iv, u32IvLength, au8Aad, u32AadLength,
+                             au8Ciphertext, u32Size, au8Plaintext, au8FullTag, AES_DIR_DECRYPT);
+        if (enRet == Ok)
         {
-            /* Wait for AES to stop */
-            while(READ_REG32_BIT(M4_AES->CR, AES_CR_START) == 1U)
+            /* Compare all bytes so the time taken does not depend on the tag. */
+            for (i = 0UL; i < u32TagLength; i++)
+            {
+                u8Diff |= (uint8_t)(au8FullTag[i] ^ au8Tag[i]);
+            }
+            if (u8Diff != 0U)
             {
-                if(u32TimeCount++ > AES_TIMEOUT)
+                if (u32Size != 0UL)
                 {
-                    enRet = ErrorTimeout;
-                    break;
+                    (void)memset(au8Plaintext, 0, u32Size);
                 }
+                enRet = Error;
             }
-            if (enRet == Ok)
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start encrypting data with the block cipher mode of the context
+ *         without waiting for the AES unit. AES_JobProcess() moves the job on.
+ * @param  [in] pstcJob            Pointer to the job, it must stay valid until the job is over.
+ * @param  [in] pstcCtx            Pointer to the context initialized by AES_CtxInit().
+ * @param  [in] au8Plaintext       Buffer of the plaintext.
+ * @param  [in] u32Size            Length of the plaintext in bytes, as AES_CtxEncrypt().
+ * @param  [out] au8Ciphertext     Buffer of the ciphertext, may be the same as au8Plaintext.
+ * @param  [in] pfnCallback        Called when the job is over, may be NULL.
+ * @retval An en_result_t enumeration value:
+ *         Ok: The job is started, or already over if nothing had to be calculated.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         ErrorOperationInProgress: Another job is in progress
+ * @note   The AES unit serves only one job at a time and the other AES functions
+ *         return ErrorOperationInProgress until it is over.
+ */
+en_result_t AES_JobEncrypt(stc_aes_job_t *pstcJob,
+                           stc_aes_ctx_t *pstcCtx,
+                           const uint8_t au8Plaintext[],
+                           uint32_t u32Size,
+                           uint8_t au8Ciphertext[],
+                           func_ptr_t pfnCallback)
+{
+    return AES_JobStart(pstcJob, pstcCtx, au8Plaintext, u32Size, au8Ciphertext, pfnCallback, AES_DIR_ENCRYPT);
+}
+
+/**
+ * @brief  Start decrypting data with the block cipher mode of the context
+ *         without waiting for the AES unit. AES_JobProcess() moves the job on.
+ * @param  [in] pstcJob            Pointer to the job, it must stay valid until the job is over.
+ * @param  [in] pstcCtx            Pointer to the context initialized by AES_CtxInit().
+ * @param  [in] au8Ciphertext      Buffer of the ciphertext.
+ * @param  [in] u32Size            Length of the ciphertext in bytes, as AES_CtxDecrypt().
+ * @param  [out] au8Plaintext      Buffer of the plaintext, may be the same as au8Ciphertext.
+ * @param  [in] pfnCallback        Called when the job is over, may be NULL.
+ * @retval An en_result_t enumeration value:
+ *         Ok: The job is started, or already over if nothing had to be calculated.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         ErrorOperationInProgress: Another job is in progress
+ */
+en_result_t AES_JobDecrypt(stc_aes_job_t *pstcJob,
+                           stc_aes_ctx_t *pstcCtx,
+                           const uint8_t au8Ciphertext[],
+                           uint32_t u32Size,
+                           uint8_t au8Plaintext[],
+                           func_ptr_t pfnCallback)
+{
+    return AES_JobStart(pstcJob, pstcCtx, au8Ciphertext, u32Size, au8Plaintext, pfnCallback, AES_DIR_DECRYPT);
+}
+
+/**
+ * @brief  Move an AES job on. If the AES unit has finished the current block,
+ *         the result is stored and the next block is started; the function
+ *         never waits for the AES unit. Call it from the main loop or from a
+ *         periodic interrupt.
+ * @param  [in] pstcJob            Pointer to the job.
+ * @retval An en_result_t enumeration value:
+ *         OperationInProgress: The job is not over.
+ *         Ok: The job is over.
+ *         ErrorTimeout: The AES unit did not finish a block within AES_TIMEOUT calls.
+ *         ErrorInvalidParameter: pstcJob == NULL
+ */
+en_result_t AES_JobProcess(stc_aes_job_t *pstcJob)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Len;
+    uint8_t au8Block[16U];
+
+    if (pstcJob != NULL)
+    {
+        if ((m_pstcJob == pstcJob) && (pstcJob->enResult == OperationInProgress))
+        {
+            if (READ_REG32_BIT(M4_AES->CR, AES_CR_START) != 0UL)
+            {
+                if (pstcJob->u32PollCnt++ >= AES_TIMEOUT)
+                {
+                    AES_JobDone(pstcJob, ErrorTimeout);
+                }
+            }
+            else
+            {
+                AES_ReadData(au8Block);
+                u32Len = pstcJob->u32Size - pstcJob->u32Index;
+                if (u32Len > AES_BLOCK_LEN)
+                {
+                    u32Len = AES_BLOCK_LEN;
+                }
+                AES_CtxBlockPost(pstcJob->pstcCtx, &pstcJob->pu8Input[pstcJob->u32Index],
+                                 &pstcJob->pu8Output[pstcJob->u32Index], u32Len, pstcJob->u32Dir, au8Block);
+                pstcJob->u32Index += u32Len;
+                if (pstcJob->u32Index < pstcJob->u32Size)
+                {
+                    AES_JobNextBlock(pstcJob);
+                }
+                else
+                {
+                    AES_JobDone(pstcJob, Ok);
+                }
+            }
+        }
+        enRet = pstcJob->enResult;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Abort an AES job, the callback is not called. The chaining state of
+ *         the context is undefined afterwards.
+ * @param  [in] pstcJob            Pointer to the job.
+ * @retval An en_result_t enumeration value:
+ *         Ok: The job is aborted or was not in progress.
+ *         ErrorInvalidParameter: pstcJob == NULL
+ */
+en_result_t AES_JobAbort(stc_aes_job_t *pstcJob)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32TimeCount = 0UL;
+
+    if (pstcJob != NULL)
+    {
+        if (m_pstcJob == pstcJob)
+        {
+            /* Let the block in progress finish before the unit is handed over. */
+            while ((READ_REG32_BIT(M4_AES->CR, AES_CR_START) != 0UL) && (u32TimeCount < AES_TIMEOUT))
+            {
+                u32TimeCount++;
+            }
+            m_pstcJob = NULL;
+            pstcJob->enResult = Error;
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup AES_Local_Functions AES Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the AES_CR.KEYSIZE value of a key length.
+ * @param  [in] u8KeyLength   Length of key in bytes.
+ * @retval A value of @ref AES_KEY_SIZE
+ */
+static uint32_t AES_GetKeySize(uint8_t u8KeyLength)
+{
+    uint32_t u32KeySize;
+
+    switch (u8KeyLength)
+    {
+        case AES_KEY_LEN_192BIT:
+            u32KeySize = AES_KEY_SIZE_192BIT;
+            break;
+        case AES_KEY_LEN_256BIT:
+            u32KeySize = AES_KEY_SIZE_256BIT;
+            break;
+        default:
+            u32KeySize = AES_KEY_SIZE_128BIT;
+            break;
+    }
+
+    return u32KeySize;
+}
+
+/**
+ * @brief  Calculate one block with the key already in the key registers.
+ * @param  [in] pu8Input      Pointer to the 16-byte input block.
+ * @param  [out] pu8Output    Pointer to the 16-byte output block, may be the same as pu8Input.
+ * @param  [in] u32Dir        AES_DIR_ENCRYPT or AES_DIR_DECRYPT.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Calculate successfully.
+ *         ErrorTimeout: AES error timeout
+ */
+static en_result_t AES_CalcBlock(const uint8_t *pu8Input, uint8_t *pu8Output, uint32_t u32Dir)
+{
+    en_result_t enRet = Ok;
+    uint32_t u32TimeCount = 0UL;
+
+    AES_WriteData(pu8Input);
+    MODIFY_REG32(M4_AES->CR, AES_CR_MODE, u32Dir);
+    /* Start AES calculating. */
+    SET_REG32_BIT(M4_AES->CR, AES_CR_START);
+    /* Wait for AES to stop */
+    while (READ_REG32_BIT(M4_AES->CR, AES_CR_START) != 0UL)
+    {
+        if (u32TimeCount++ >= AES_TIMEOUT)
+        {
+            enRet = ErrorTimeout;
+            break;
+        }
+    }
+    if (enRet == Ok)
+    {
+        AES_ReadData(pu8Output);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Load the key of the context unless it is the key already loaded.
+ * @param  [in] pstcCtx       Pointer to the context.
+ * @retval None
+ */
+static void AES_CtxLoadKey(const stc_aes_ctx_t *pstcCtx)
+{
+    if (m_pstcKeyCtx != pstcCtx)
+    {
+        AES_WriteKey(pstcCtx->au8Key, pstcCtx->u8KeyLength);
+        MODIFY_REG32(M4_AES->CR, AES_CR_KEYSIZE, pstcCtx->u32KeySize);
+        m_pstcKeyCtx = pstcCtx;
+    }
+}
+
+/**
+ * @brief  Increment the big-endian counter held in the last bytes of a block.
+ * @param  [in,out] au8Counter  Buffer of the 16-byte counter block.
+ * @param  [in] u32Width        Number of bytes of the counter: 16 for CTR mode, 4 for GCM.
+ * @retval None
+ */
+static void AES_CounterInc(uint8_t au8Counter[], uint32_t u32Width)
+{
+    uint32_t i = AES_BLOCK_LEN;
+
+    while (i > (AES_BLOCK_LEN - u32Width))
+    {
+        i--;
+        au8Counter[i]++;
+        if (au8Counter[i] != 0U)
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief  Check the input of a context calculation: ECB and CBC mode only take
+ *         whole blocks, and the AES unit must not be running a job.
+ * @param  [in] pstcCtx       Pointer to the context.
+ * @param  [in] au8Input      Buffer of the input data.
+ * @param  [in] u32Size       Length of the input data in bytes.
+ * @param  [in] au8Output     Buffer of the output data.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Parameters are valid.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         ErrorOperationInProgress: A job is in progress
+ */
+static en_result_t AES_CtxCheck(const stc_aes_ctx_t *pstcCtx,
+                                const uint8_t au8Input[],
+                                uint32_t u32Size,
+                                const uint8_t au8Output[])
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcCtx != NULL) && (au8Input != NULL) && (au8Output != NULL)         && \
+        (((pstcCtx->u32Mode != AES_MODE_ECB) && (pstcCtx->u32Mode != AES_MODE_CBC)) || \
+         ((u32Size % AES_BLOCK_LEN) == 0UL)))
+    {
+        DDL_ASSERT(IS_AES_MODE(pstcCtx->u32Mode));
+        enRet = (m_pstcJob == NULL) ? Ok : ErrorOperationInProgress;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Use the key stream bytes left over from the previous call (CTR and
+ *         CFB mode), no block is calculated.
+ * @param  [in] pstcCtx       Pointer to the context.
+ * @param  [in] au8Input      Buffer of the input data.
+ * @param  [in] u32Size       Length of the input data in bytes.
+ * @param  [out] au8Output    Buffer of the output data.
+ * @param  [in] u32Dir        AES_DIR_ENCRYPT or AES_DIR_DECRYPT.
+ * @retval Number of bytes processed.
+ */
+static uint32_t AES_CtxStreamTail(stc_aes_ctx_t *pstcCtx,
+                                  const uint8_t au8Input[],
+                                  uint32_t u32Size,
+                                  uint8_t au8Output[],
+                                  uint32_t u32Dir)
+{
+    uint32_t u32Index = 0UL;
+    uint8_t u8Data;
+
+    while ((pstcCtx->u8StreamPos != 0U) && (u32Index < u32Size))
+    {
+        u8Data = au8Input[u32Index];
+        au8Output[u32Index] = u8Data ^ pstcCtx->au8Stream[pstcCtx->u8StreamPos];
+        if (pstcCtx->u32Mode == AES_MODE_CFB)
+        {
+            /* The ciphertext is fed back as the next IV. */
+            pstcCtx->au8Iv[pstcCtx->u8StreamPos] = (u32Dir == AES_DIR_ENCRYPT) ? au8Output[u32Index] : u8Data;
+        }
+        pstcCtx->u8StreamPos = (pstcCtx->u8StreamPos + 1U) & (AES_BLOCK_LEN - 1U);
+        u32Index++;
+    }
+
+    return u32Index;
+}
+
+/**
+ * @brief  Prepare the input of the block cipher for the next block of the context.
+ * @param  [in] pstcCtx       Pointer to the context.
+ * @param  [in] au8Input      Buffer of the next input block (a whole block in ECB and CBC mode).
+ * @param  [in] u32Dir        AES_DIR_ENCRYPT or AES_DIR_DECRYPT.
+ * @param  [out] au8Block     Buffer of the 16-byte block cipher input.
+ * @retval Direction of the block cipher: AES_DIR_ENCRYPT or AES_DIR_DECRYPT.
+ */
+static uint32_t AES_CtxBlockPre(stc_aes_ctx_t *pstcCtx,
+                                const uint8_t au8Input[],
+                                uint32_t u32Dir,
+                                uint8_t au8Block[])
+{
+    uint32_t i;
+    uint32_t u32CipherDir = AES_DIR_ENCRYPT;
+
+    switch (pstcCtx->u32Mode)
+    {
+        case AES_MODE_ECB:
+            (void)memcpy(au8Block, au8Input, AES_BLOCK_LEN);
+            u32CipherDir = u32Dir;
+            break;
+
+        case AES_MODE_CBC:
+            if (u32Dir == AES_DIR_ENCRYPT)
             {
-                AES_WriteData(&au8Ciphertext[u32Index]);
-                AES_WriteKey(pu8Key, u8KeyLength);
-                switch (u8KeyLength)
+                for (i = 0UL; i < AES_BLOCK_LEN; i++)
                 {
-                case AES_KEY_LEN_128BIT:
-                    MODIFY_REG32(M4_AES->CR, AES_CR_KEYSIZE, AES_KEY_SIZE_128BIT);
-                    break;
+                    au8Block[i] = au8Input[i] ^ pstcCtx->au8Iv[i];
+                }
+            }
+            else
+            {
+                (void)memcpy(au8Block, au8Input, AES_BLOCK_LEN);
+                u32CipherDir = AES_DIR_DECRYPT;
+            }
+            break;
+
+        default:
+            /* CTR and CFB only use the encryption direction of the cipher. */
+            (void)memcpy(au8Block, pstcCtx->au8Iv, AES_BLOCK_LEN);
+            if (pstcCtx->u32Mode == AES_MODE_CTR)
+            {
+                AES_CounterInc(pstcCtx->au8Iv, AES_BLOCK_LEN);
+            }
+            break;
+    }
+
+    return u32CipherDir;
+}
+
+/**
+ * @brief  Produce the output of a block of the context from the block cipher result.
+ * @param  [in] pstcCtx       Pointer to the context.
+ * @param  [in] au8Input      Buffer of the input block.
+ * @param  [out] au8Output    Buffer of the output block, may be the same as au8Input.
+ * @param  [in] u32Len        Length of the block, less than 16 only for the last block of CTR and CFB mode.
+ * @param  [in] u32Dir        AES_DIR_ENCRYPT or AES_DIR_DECRYPT.
+ * @param  [in] au8Block      Buffer of the 16-byte block cipher result.
+ * @retval None
+ */
+static void AES_CtxBlockPost(stc_aes_ctx_t *pstcCtx,
+                             const uint8_t au8Input[],
+                             uint8_t au8Output[],
+                             uint32_t u32Len,
+                             uint32_t u32Dir,
+                             const uint8_t au8Block[])
+{
+    uint32_t i;
+    uint8_t u8Data;
+
+    switch (pstcCtx->u32Mode)
+    {
+        case AES_MODE_ECB:
+            (void)memcpy(au8Output, au8Block, AES_BLOCK_LEN);
+            break;
+
+        case AES_MODE_CBC:
+            if (u32Dir == AES_DIR_ENCRYPT)
+            {
+                (void)memcpy(pstcCtx->au8Iv, au8Block, AES_BLOCK_LEN);
+                (void)memcpy(au8Output, au8Block, AES_BLOCK_LEN);
+            }
+            else
+            {
+                /* Byte by byte, so the ciphertext is kept as next IV before an in-place output overwrites it. */
+                for (i = 0UL; i < AES_BLOCK_LEN; i++)
+                {
+                    u8Data = au8Input[i];
+                    au8Output[i] = au8Block[i] ^ pstcCtx->au8Iv[i];
+                    pstcCtx->au8Iv[i] = u8Data;
+                }
+            }
+            break;
+
+        default:
+            (void)memcpy(pstcCtx->au8Stream, au8Block, AES_BLOCK_LEN);
+            for (i = 0UL; i < u32Len; i++)
+            {
+                u8Data = au8Input[i];
+                au8Output[i] = u8Data ^ au8Block[i];
+                if (pstcCtx->u32Mode == AES_MODE_CFB)
+                {
+                    pstcCtx->au8Iv[i] = (u32Dir == AES_DIR_ENCRYPT) ? au8Output[i] : u8Data;
+                }
+            }
+            pstcCtx->u8StreamPos = (uint8_t)(u32Len & (AES_BLOCK_LEN - 1U));
+            break;
+    }
+}
+
+/**
+ * @brief  Encrypt or decrypt data with the block cipher mode of the context.
+ * @param  [in] pstcCtx       Pointer to the context.
+ * @param  [in] au8Input      Buffer of the input data.
+ * @param  [in] u32Size       Length of the input data in bytes.
+ * @param  [out] au8Output    Buffer of the output data.
+ * @param  [in] u32Dir        AES_DIR_ENCRYPT or AES_DIR_DECRYPT.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Calculate successfully.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         ErrorTimeout: AES error timeout
+ */
+static en_result_t AES_CtxCrypt(stc_aes_ctx_t *pstcCtx,
+                                const uint8_t au8Input[],
+                                uint32_t u32Size,
+                                uint8_t au8Output[],
+                                uint32_t u32Dir)
+{
+    en_result_t enRet;
+    uint32_t u32Index;
+    uint32_t u32Len;
+    uint32_t u32CipherDir;
+    uint8_t au8Block[16U];
+
+    enRet = AES_CtxCheck(pstcCtx, au8Input, u32Size, au8Output);
+    if (enRet == Ok)
+    {
+        u32Index = AES_CtxStreamTail(pstcCtx, au8Input, u32Size, au8Output, u32Dir);
+        if (u32Index < u32Size)
+        {
+            AES_CtxLoadKey(pstcCtx);
+        }
+        while ((u32Index < u32Size) && (enRet == Ok))
+        {
+            u32Len = u32Size - u32Index;
+            if (u32Len > AES_BLOCK_LEN)
+            {
+                u32Len = AES_BLOCK_LEN;
+            }
+            u32CipherDir = AES_CtxBlockPre(pstcCtx, &au8Input[u32Index], u32Dir, au8Block);
+            enRet = AES_CalcBlock(au8Block, au8Block, u32CipherDir);
+            if (enRet == Ok)
+            {
+                AES_CtxBlockPost(pstcCtx, &au8Input[u32Index], &au8Output[u32Index], u32Len, u32Dir, au8Block);
+                u32Index += u32Len;
+            }
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start a job of the block cipher mode of the context.
+ * @param  [in] pstcJob       Pointer to the job.
+ * @param  [in] pstcCtx       Pointer to the context.
+ * @param  [in] au8Input      Buffer of the input data.
+ * @param  [in] u32Size       Length of the input data in bytes.
+ * @param  [out] au8Output    Buffer of the output data.
+ * @param  [in] pfnCallback   Completion callback, may be NULL.
+ * @param  [in] u32Dir        AES_DIR_ENCRYPT or AES_DIR_DECRYPT.
+ * @retval An en_result_t enumeration value:
+ *         Ok: The job is started or already over.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         ErrorOperationInProgress: Another job is in progress
+ */
+static en_result_t AES_JobStart(stc_aes_job_t *pstcJob,
+                                stc_aes_ctx_t *pstcCtx,
+                                const uint8_t au8Input[],
+                                uint32_t u32Size,
+                                uint8_t au8Output[],
+                                func_ptr_t pfnCallback,
+                                uint32_t u32Dir)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcJob != NULL)
+    {
+        enRet = AES_CtxCheck(pstcCtx, au8Input, u32Size, au8Output);
+        if (enRet == Ok)
+        {
+            pstcJob->pstcCtx         = pstcCtx;
+            pstcJob->pu8Input        = au8Input;
+            pstcJob->pu8Output       = au8Output;
+            pstcJob->u32Size         = u32Size;
+            pstcJob->u32Dir          = u32Dir;
+            pstcJob->pfnCpltCallback = pfnCallback;
+            pstcJob->u32Index        = AES_CtxStreamTail(pstcCtx, au8Input, u32Size, au8Output, u32Dir);
+            pstcJob->u32PollCnt      = 0UL;
+            pstcJob->enResult        = OperationInProgress;
+            m_pstcJob = pstcJob;
+
+            if (pstcJob->u32Index < u32Size)
+            {
+                AES_JobNextBlock(pstcJob);
+            }
+            else
+            {
+                AES_JobDone(pstcJob, Ok);
+            }
+        }
+    }
 
-                case AES_KEY_LEN_192BIT:
-                    MODIFY_REG32(M4_AES->CR, AES_CR_KEYSIZE, AES_KEY_SIZE_192BIT);
-                    break;
+    return enRet;
+}
 
-                case AES_KEY_LEN_256BIT:
-                    MODIFY_REG32(M4_AES->CR, AES_CR_KEYSIZE, AES_KEY_SIZE_256BIT);
-                    break;
+/**
+ * @brief  Start the block cipher on the next block of the job.
+ * @param  [in] pstcJob       Pointer to the job.
+ * @retval None
+ */
+static void AES_JobNextBlock(stc_aes_job_t *pstcJob)
+{
+    uint32_t u32CipherDir;
+    uint8_t au8Block[16U];
 
-                default:
-                    break;
+    u32CipherDir = AES_CtxBlockPre(pstcJob->pstcCtx, &pstcJob->pu8Input[pstcJob->u32Index],
+                                   pstcJob->u32Dir, au8Block);
+    AES_CtxLoadKey(pstcJob->pstcCtx);
+    AES_WriteData(au8Block);
+    MODIFY_REG32(M4_AES->CR, AES_CR_MODE, u32CipherDir);
+    /* Start AES calculating, AES_JobProcess() collects the result. */
+    SET_REG32_BIT(M4_AES->CR, AES_CR_START);
+    pstcJob->u32PollCnt = 0UL;
+}
+
+/**
+ * @brief  End the job and call its completion callback.
+ * @param  [in] pstcJob       Pointer to the job.
+ * @param  [in] enResult      Result of the job.
+ * @retval None
+ */
+static void AES_JobDone(stc_aes_job_t *pstcJob, en_result_t enResult)
+{
+    m_pstcJob = NULL;
+    pstcJob->enResult = enResult;
+    if (pstcJob->pfnCpltCallback != NULL)
+    {
+        pstcJob->pfnCpltCallback();
+    }
+}
+
+/**
+ * @brief  Compute the 4-bit GHASH multiplication table of H.
+ * @param  [in] pstcCtx       Pointer to the GCM context.
+ * @param  [in] au8H          Buffer of the 16-byte hash subkey H.
+ * @retval None
+ */
+static void AES_GcmGenTable(stc_aes_gcm_ctx_t *pstcCtx, const uint8_t au8H[])
+{
+    uint32_t i;
+    uint32_t j;
+    uint64_t u64Hi = 0ULL;
+    uint64_t u64Lo = 0ULL;
+    uint64_t u64Tmp;
+
+    for (i = 0UL; i < 8UL; i++)
+    {
+        u64Hi = (u64Hi << 8U) | au8H[i];
+        u64Lo = (u64Lo << 8U) | au8H[i + 8UL];
+    }
+
+    pstcCtx->au64HH[0U] = 0ULL;
+    pstcCtx->au64HL[0U] = 0ULL;
+    pstcCtx->au64HH[8U] = u64Hi;
+    pstcCtx->au64HL[8U] = u64Lo;
+    /* H * x, H * x^2, H * x^3 in the bit reflected GCM field. */
+    for (i = 4UL; i > 0UL; i >>= 1U)
+    {
+        u64Tmp = (u64Lo & 1ULL) * 0xE1000000ULL;
+        u64Lo  = (u64Hi << 63U) | (u64Lo >> 1U);
+        u64Hi  = (u64Hi >> 1U) ^ (u64Tmp << 32U);
+        pstcCtx->au64HH[i] = u64Hi;
+        pstcCtx->au64HL[i] = u64Lo;
+    }
+    for (i = 2UL; i <= 8UL; i <<= 1U)
+    {
+        for (j = 1UL; j < i; j++)
+        {
+            pstcCtx->au64HH[i + j] = pstcCtx->au64HH[i] ^ pstcCtx->au64HH[j];
+            pstcCtx->au64HL[i + j] = pstcCtx->au64HL[i] ^ pstcCtx->au64HL[j];
+        }
+    }
+}
+
+/**
+ * @brief  GHASH multiplication: output = X * H.
+ * @param  [in] pstcCtx       Pointer to the GCM context.
+ * @param  [in] au8X          Buffer of the 16-byte block X.
+ * @param  [out] au8Output    Buffer of the 16-byte result, may be the same as au8X.
+ * @retval None
+ */
+static void AES_GcmMult(const stc_aes_gcm_ctx_t *pstcCtx, const uint8_t au8X[], uint8_t au8Output[])
+{
+    /* Reduction of the 4 bits shifted out, per value of the bits. */
+    static const uint64_t au64Last4[16U] =
+    {
+        0x0000ULL, 0x1C20ULL, 0x3840ULL, 0x2460ULL, 0x7080ULL, 0x6CA0ULL, 0x48C0ULL, 0x54E0ULL,
+        0xE100ULL, 0xFD20ULL, 0xD940ULL, 0xC560ULL, 0x9180ULL, 0x8DA0ULL, 0xA9C0ULL, 0xB5E0ULL,
+    };
+    int32_t i;
+    uint32_t u32Lo;
+    uint32_t u32Hi;
+    uint32_t u32Rem;
+    uint64_t u64Zh;
+    uint64_t u64Zl;
+
+    u32Lo = (uint32_t)au8X[15U] & 0x0FUL;
+    u64Zh = pstcCtx->au64HH[u32Lo];
+    u64Zl = pstcCtx->au64HL[u32Lo];
+
+    for (i = 15; i >= 0; i--)
+    {
+        u32Lo = (uint32_t)au8X[i] & 0x0FUL;
+        u32Hi = ((uint32_t)au8X[i] >> 4U) & 0x0FUL;
+
+        if (i != 15)
+        {
+            u32Rem = (uint32_t)u64Zl & 0x0FUL;
+            u64Zl  = (u64Zh << 60U) | (u64Zl >> 4U);
+            u64Zh  = (u64Zh >> 4U) ^ (au64Last4[u32Rem] << 48U);
+            u64Zh ^= pstcCtx->au64HH[u32Lo];
+            u64Zl ^= pstcCtx->au64HL[u32Lo];
+        }
+        u32Rem = (uint32_t)u64Zl & 0x0FUL;
+        u64Zl  = (u64Zh << 60U) | (u64Zl >> 4U);
+        u64Zh  = (u64Zh >> 4U) ^ (au64Last4[u32Rem] << 48U);
+        u64Zh ^= pstcCtx->au64HH[u32Hi];
+        u64Zl ^= pstcCtx->au64HL[u32Hi];
+    }
+
+    for (i = 0; i < 8; i++)
+    {
+        au8Output[i]      = (uint8_t)(u64Zh >> (56U - (8U * (uint32_t)i)));
+        au8Output[i + 8]  = (uint8_t)(u64Zl >> (56U - (8U * (uint32_t)i)));
+    }
+}
+
+/**
+ * @brief  Absorb data into the GHASH state, the last partial block is zero padded.
+ * @param  [in] pstcCtx       Pointer to the GCM context.
+ * @param  [in,out] au8Y      Buffer of the 16-byte GHASH state.
+ * @param  [in] au8Data       Buffer of the data.
+ * @param  [in] u32Size       Length of the data in bytes.
+ * @retval None
+ */
+static void AES_GcmGhash(const stc_aes_gcm_ctx_t *pstcCtx, uint8_t au8Y[],
+                         const uint8_t au8Data[], uint32_t u32Size)
+{
+    uint32_t u32Index = 0UL;
+    uint32_t u32Len;
+    uint32_t i;
+
+    while (u32Index < u32Size)
+    {
+        u32Len = u32Size - u32Index;
+        if (u32Len > AES_BLOCK_LEN)
+        {
+            u32Len = AES_BLOCK_LEN;
+        }
+        for (i = 0UL; i < u32Len; i++)
+        {
+            au8Y[i] ^= au8Data[u32Index + i];
+        }
+        AES_GcmMult(pstcCtx, au8Y, au8Y);
+        u32Index += u32Len;
+    }
+}
+
+/**
+ * @brief  Build a GHASH length block: the two lengths in bits as 64-bit big-endian values.
+ * @param  [out] au8Block     Buffer of the 16-byte block.
+ * @param  [in] u32Len1       First length in bytes.
+ * @param  [in] u32Len2       Second length in bytes.
+ * @retval None
+ */
+static void AES_GcmLenBlock(uint8_t au8Block[], uint32_t u32Len1, uint32_t u32Len2)
+{
+    (void)memset(au8Block, 0, AES_BLOCK_LEN);
+    au8Block[3U]  = (uint8_t)(u32Len1 >> 29U);
+    au8Block[4U]  = (uint8_t)(u32Len1 >> 21U);
+    au8Block[5U]  = (uint8_t)(u32Len1 >> 13U);
+    au8Block[6U]  = (uint8_t)(u32Len1 >> 5U);
+    au8Block[7U]  = (uint8_t)(u32Len1 << 3U);
+    au8Block[11U] = (uint8_t)(u32Len2 >> 29U);
+    au8Block[12U] = (uint8_t)(u32Len2 >> 21U);
+    au8Block[13U] = (uint8_t)(u32Len2 >> 13U);
+    au8Block[14U] = (uint8_t)(u32Len2 >> 5U);
+    au8Block[15U] = (uint8_t)(u32Len2 << 3U);
+}
+
+/**
+ * @brief  AES-GCM encryption or decryption of one record and computation of
+ *         the full 16-byte tag.
+ * @param  [in] pstcCtx       Pointer to the GCM context.
+ * @param  [in] au8Iv         Buffer of the IV.
+ * @param  [in] u32IvLength   Length of the IV in bytes.
+ * @param  [in] au8Aad        Buffer of the additional authenticated data.
+ * @param  [in] u32AadLength  Length of the additional authenticated data in bytes.
+ * @param  [in] au8Input      Buffer of the input data.
+ * @param  [in] u32Size       Length of the input data in bytes.
+ * @param  [out] au8Output    Buffer of the output data.
+ * @param  [out] au8Tag       Buffer of the 16-byte tag.
+ * @param  [in] u32Dir        AES_DIR_ENCRYPT or AES_DIR_DECRYPT.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Calculate successfully.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         ErrorTimeout: AES error timeout
+ */
+static en_result_t AES_GcmCrypt(stc_aes_gcm_ctx_t *pstcCtx,
+                                const uint8_t au8Iv[], uint32_t u32IvLength,
+                                const uint8_t au8Aad[], uint32_t u32AadLength,
+                                const uint8_t au8Input[], uint32_t u32Size,
+                                uint8_t au8Output[], uint8_t au8Tag[],
+                                uint32_t u32Dir)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint8_t au8J0[16U] = {0U};
+    uint8_t au8Counter[16U];
+    uint8_t au8Stream[16U];
+    uint8_t au8Y[16U] = {0U};
+    uint32_t u32Index;
+    uint32_t u32Len;
+    uint32_t i;
+
+    if ((au8Iv != NULL) && (u32IvLength != 0UL)                     && \
+        ((au8Aad != NULL) || (u32AadLength == 0UL))                 && \
+        (((au8Input != NULL) && (au8Output != NULL)) || (u32Size == 0UL)))
+    {
+        /* Pre-counter block J0. */
+        if (u32IvLength == AES_GCM_IV_LEN)
+        {
+            (void)memcpy(au8J0, au8Iv, AES_GCM_IV_LEN);
+            au8J0[15U] = 1U;
+        }
+        else
+        {
+            AES_GcmGhash(pstcCtx, au8J0, au8Iv, u32IvLength);
+            AES_GcmLenBlock(au8Stream, 0UL, u32IvLength);
+            AES_GcmGhash(pstcCtx, au8J0, au8Stream, AES_BLOCK_LEN);
+        }
+
+        AES_GcmGhash(pstcCtx, au8Y, au8Aad, u32AadLength);
+        if (u32Dir == AES_DIR_DECRYPT)
+        {
+            /* Authenticate the ciphertext before an in-place decryption overwrites it. */
+            AES_GcmGhash(pstcCtx, au8Y, au8Input, u32Size);
+        }
+
+        enRet = (m_pstcJob == NULL) ? Ok : ErrorOperationInProgress;
+        if (enRet == Ok)
+        {
+            AES_CtxLoadKey(&pstcCtx->stcAes);
+        }
+        (void)memcpy(au8Counter, au8J0, AES_BLOCK_LEN);
+        u32Index = 0UL;
+        while ((u32Index < u32Size) && (enRet == Ok))
+        {
+            AES_CounterInc(au8Counter, 4UL);
+            enRet = AES_CalcBlock(au8Counter, au8Stream, AES_DIR_ENCRYPT);
+            /* A failed block leaves no keystream, the output is not touched */
+            if (enRet == Ok)
+            {
+                u32Len = u32Size - u32Index;
+                if (u32Len > AES_BLOCK_LEN)
+                {
+                    u32Len = AES_BLOCK_LEN;
                 }
-                /* Set AES decrypt. */
-                SET_REG32_BIT(M4_AES->CR, AES_CR_MODE);
-                /* Start AES calculating. */
-                SET_REG32_BIT(M4_AES->CR, AES_CR_START);
-                /* Wait for AES to stop */
-                u32TimeCount = 0UL;
-                while(READ_REG32_BIT(M4_AES->CR, AES_CR_START) == 1UL)
+                for (i = 0UL; i < u32Len; i++)
                 {
-                    if(u32TimeCount++ >= AES_TIMEOUT)
-                    {
-                        enRet = ErrorTimeout;
-                        break;
-                    }
+                    au8Output[u32Index + i] = au8Input[u32Index + i] ^ au8Stream[i];
                 }
-                if (enRet == Ok)
+                u32Index += u32Len;
+            }
+        }
+
+        if (enRet == Ok)
+        {
+            if (u32Dir == AES_DIR_ENCRYPT)
+            {
+                AES_GcmGhash(pstcCtx, au8Y, au8Output, u32Size);
+            }
+            AES_GcmLenBlock(au8Stream, u32AadLength, u32Size);
+            AES_GcmGhash(pstcCtx, au8Y, au8Stream, AES_BLOCK_LEN);
+
+            /* Tag = AES(J0) ^ GHASH */
+            enRet = AES_CalcBlock(au8J0, au8Tag, AES_DIR_ENCRYPT);
+            if (enRet == Ok)
+            {
+                for (i = 0UL; i < AES_BLOCK_LEN; i++)
                 {
-                    AES_ReadData(&au8Plaintext[u32Index]);
-                    u32CiphertextSize -= AES_BLOCK_LEN;
-                    u32Index += AES_BLOCK_LEN;
+                    au8Tag[i] ^= au8Y[i];
                 }
             }
         }
     }
+
     return enRet;
 }
 
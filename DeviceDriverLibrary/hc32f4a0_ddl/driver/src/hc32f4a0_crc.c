@@ -10,6 +10,7 @@
    2020-07-21       Heqb            Fixed a bug for CRC_Check function
    2020-08-11       Heqb            Modify macro definition name IS_CRC_PROCOTOL
                                     to IS_CRC_PROTOCOL
+   2026-10-17       Heqb            Add CRC context functions and DMA feed
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -58,6 +59,8 @@
  * Include files
  ******************************************************************************/
 #include "hc32f4a0_crc.h"
+#include "hc32f4a0_dma.h"
+#include "hc32f4a0_interrupts.h"
 #include "hc32f4a0_utility.h"
 
 /**
@@ -85,6 +88,10 @@
  * @{
  */
 
+/* DMA feed: words per block and blocks per transfer */
+#define CRC_DMA_BLOCK_WORDS (1024UL)
+#define CRC_DMA_MAX_BLOCKS  (0xFFFFUL)
+
 /**
  * @defgroup CRC_Check_Parameters_Validity CRC check parameters validity
  * @{
@@ -120,6 +127,15 @@
 static void CRC_8BitWrite(const uint8_t au8Data[], uint32_t u32Length);
 static void CRC_16BitWrite(const uint16_t au16Data[], uint32_t u32Length);
 static void CRC_32BitWrite(const uint32_t au32Data[], uint32_t u32Length);
+static void CRC_WriteReslt(uint32_t u32CrcProtocol, uint32_t u32Val);
+static uint32_t CRC_ReadReslt(uint32_t u32CrcProtocol);
+static void CRC_CtxLoad(const stc_crc_ctx_t *pstcCtx);
+static void CRC_ByteStreamWrite(const uint8_t *pu8Data, uint32_t u32Length);
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_INTERRUPTS_ENABLE == DDL_ON)
+static void CRC_DMA_Run(stc_crc_dma_handle_t *pstcHandle);
+static en_result_t CRC_DMA_Claim(stc_crc_dma_handle_t *pstcHandle);
+static void CRC_DMA_Release(const stc_crc_dma_handle_t *pstcHandle);
+#endif /* DDL_DMA_ENABLE && DDL_INTERRUPTS_ENABLE */
 /**
  * @}
  */
@@ -127,6 +143,10 @@ static void CRC_32BitWrite(const uint32_t au32Data[], uint32_t u32Length);
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/* Context whose checksum is in the CRC unit, NULL if unknown. */
+static const stc_crc_ctx_t *m_pstcCrcCtx = NULL;
+/* Handle whose DMA transfer feeds the CRC unit, NULL if none. */
+static stc_crc_dma_handle_t *m_pstcCrcDma = NULL;
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -164,6 +184,7 @@ uint32_t CRC_Calculate(uint32_t u32CrcProtocol,
         DDL_ASSERT(IS_CRC_BIT_WIDTH(u8BitWidth));
         /* Set operation mode (CRC16 or CRC32) */
         WRITE_REG32(M4_CRC->CR, u32CrcProtocol);
+        m_pstcCrcCtx = NULL;
         /* Set initial value */
         if (u32CrcProtocol == CRC_CRC32)
         {
@@ -231,6 +252,7 @@ en_flag_status_t CRC_Check(uint32_t u32CrcProtocol,
     {
         /* Set operation mode (CRC16 or CRC32) */
         WRITE_REG32(M4_CRC->CR, u32CrcProtocol);
+        m_pstcCrcCtx = NULL;
         /* Set initial value */
         if (u32CrcProtocol == CRC_CRC32)
         {
@@ -272,6 +294,226 @@ en_flag_status_t CRC_Check(uint32_t u32CrcProtocol,
     return enFlag;
 }
 
+/**
+ * @brief  Begin a CRC calculation on a context.
+ * @param  [in] pstcCtx               Pointer to the context.
+ * @param  [in] u32CrcProtocol        CRC protocol control bit.
+ *                                    This parameter can be a value of @ref CRC_Protocol_Control_Bit
+ * @param  [in] u32InitVal            Initialize the CRC calculation.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Begin successfully.
+ *         ErrorInvalidParameter: pstcCtx == NULL
+ *         ErrorOperationInProgress: The CRC unit is fed by DMA
+ */
+en_result_t CRC_Begin(stc_crc_ctx_t *pstcCtx, uint32_t u32CrcProtocol, uint32_t u32InitVal)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcCtx != NULL)
+    {
+        DDL_ASSERT(IS_CRC_PROTOCOL(u32CrcProtocol));
+        if (m_pstcCrcDma != NULL)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            /* Set operation mode (CRC16 or CRC32) */
+            WRITE_REG32(M4_CRC->CR, u32CrcProtocol);
+            /* The value read back differs from the value written, keep the difference for reloading */
+            CRC_WriteReslt(u32CrcProtocol, 0UL);
+            pstcCtx->u32ResltMask = CRC_ReadReslt(u32CrcProtocol);
+            /* Set initial value */
+            CRC_WriteReslt(u32CrcProtocol, u32InitVal);
+            pstcCtx->u32Protocol = u32CrcProtocol;
+            pstcCtx->u32Reslt    = CRC_ReadReslt(u32CrcProtocol);
+            m_pstcCrcCtx = pstcCtx;
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Add data to the CRC calculation of a context.
+ * @param  [in] pstcCtx               Pointer to the context started by CRC_Begin().
+ * @param  [in] pvData                Pointer to the data, any alignment.
+ * @param  [in] u32Length             The length of the data in bytes.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Update successfully.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         ErrorOperationInProgress: The CRC unit is fed by DMA
+ * @note   The word aligned part of the data is written in words, the unaligned
+ *         head and tail in bytes. The result is the same as writing all data in bytes.
+ */
+en_result_t CRC_Update(stc_crc_ctx_t *pstcCtx, const void *pvData, uint32_t u32Length)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcCtx != NULL) && ((pvData != NULL) || (u32Length == 0UL)))
+    {
+        if (m_pstcCrcDma != NULL)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            CRC_CtxLoad(pstcCtx);
+            CRC_ByteStreamWrite((const uint8_t *)pvData, u32Length);
+            pstcCtx->u32Reslt = CRC_ReadReslt(pstcCtx->u32Protocol);
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  End the CRC calculation of a context.
+ * @param  [in] pstcCtx               Pointer to the context.
+ * @retval CRC checksum, the same value CRC_Calculate() returns for the whole data.
+ */
+uint32_t CRC_End(stc_crc_ctx_t *pstcCtx)
+{
+    uint32_t u32CheckSum = 0UL;
+
+    if (pstcCtx != NULL)
+    {
+        u32CheckSum = pstcCtx->u32Reslt;
+        if (m_pstcCrcCtx == pstcCtx)
+        {
+            m_pstcCrcCtx = NULL;
+        }
+    }
+
+    return u32CheckSum;
+}
+
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_INTERRUPTS_ENABLE == DDL_ON)
+/**
+ * @brief  Initialize the CRC DMA handle structure.
+ * @param  [in] pstcHandle            Pointer to a @ref stc_crc_dma_handle_t structure
+ * @retval Ok: Initialize successfully
+ *         ErrorInvalidParameter: pstcHandle == NULL
+ */
+en_result_t CRC_DMA_StructInit(stc_crc_dma_handle_t *pstcHandle)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcHandle != NULL)
+    {
+        pstcHandle->DMAx            = M4_DMA1;
+        pstcHandle->u8DmaCh         = DMA_CH0;
+        pstcHandle->pfnCpltCallback = NULL;
+        pstcHandle->enResult        = Ok;
+        pstcHandle->pstcCtx         = NULL;
+        pstcHandle->pu8Data         = NULL;
+        pstcHandle->u32Length       = 0UL;
+        pstcHandle->u32BlockCnt     = 0UL;
+        enRet = Ok;
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Add data to the CRC calculation of a context, the data is moved to
+ *         the CRC data register by DMA.
+ * @param  [in] pstcHandle            Pointer to a @ref stc_crc_dma_handle_t structure
+ *                                    initialized by CRC_DMA_StructInit(), DMAx, u8DmaCh
+ *                                    and pfnCpltCallback must be set
+ * @param  [in] pstcCtx               Pointer to the context started by CRC_Begin().
+ * @param  [in] pvData                Pointer to the data, any alignment. It must not
+ *                                    change until the update is over.
+ * @param  [in] u32Length             The length of the data in bytes.
+ * @retval Ok: Update started, or already over if there are no whole words
+ *         ErrorInvalidParameter: Parameter error
+ *         ErrorOperationInProgress: The CRC unit is already fed by DMA, or
+ *                                   another DMA channel owns the software trigger
+ *         ErrorInvalidMode: The DMA channel is owned by another user
+ * @note   The words are moved in blocks of up to 1024 words, every block is
+ *         started by the AOS software trigger (EVT_AOS_STRG). The channel is
+ *         claimed with DMA_ChClaim() and owns the software trigger
+ *         (DMA_SwTrigAcquire()) until the update is over, nothing is written to
+ *         the CRC unit when either is refused. The unaligned head and tail
+ *         bytes are written by the CPU. The clocks of CRC, DMA and AOS must be
+ *         enabled, and the block transfer complete interrupt of the DMA channel
+ *         must call CRC_DMA_IrqHandler(). pfnCpltCallback is called when the
+ *         update is over, then CRC_End() or the next update may be called.
+ */
+en_result_t CRC_DMA_Update(stc_crc_dma_handle_t *pstcHandle,
+                           stc_crc_ctx_t *pstcCtx,
+                           const void *pvData,
+                           uint32_t u32Length)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    const uint8_t *pu8Data = (const uint8_t *)pvData;
+    uint32_t u32Head;
+
+    if ((pstcHandle != NULL) && (pstcCtx != NULL) && ((pvData != NULL) || (u32Length == 0UL)))
+    {
+        DDL_ASSERT((pstcHandle->DMAx == M4_DMA1) || (pstcHandle->DMAx == M4_DMA2));
+        DDL_ASSERT(pstcHandle->u8DmaCh <= DMA_CH7);
+
+        if (m_pstcCrcDma != NULL)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            enRet = CRC_DMA_Claim(pstcHandle);
+        }
+
+        if (enRet == Ok)
+        {
+            CRC_CtxLoad(pstcCtx);
+            /* Bytes up to the first word boundary */
+            u32Head = (4UL - ((uint32_t)pu8Data & 3UL)) & 3UL;
+            if (u32Head > u32Length)
+            {
+                u32Head = u32Length;
+            }
+            CRC_8BitWrite(pu8Data, u32Head);
+
+            pstcHandle->pstcCtx   = pstcCtx;
+            pstcHandle->pu8Data   = &pu8Data[u32Head];
+            pstcHandle->u32Length = u32Length - u32Head;
+            pstcHandle->enResult  = OperationInProgress;
+            m_pstcCrcDma = pstcHandle;
+            CRC_DMA_Run(pstcHandle);
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  DMA block transfer complete IRQ handler of the CRC DMA feed.
+ * @param  [in] pstcHandle            Pointer to the handle passed to CRC_DMA_Update()
+ * @retval None
+ * @note   Call it in the block transfer complete interrupt callback of the DMA channel.
+ */
+void CRC_DMA_IrqHandler(stc_crc_dma_handle_t *pstcHandle)
+{
+    if (pstcHandle != NULL)
+    {
+        DMA_ClearTransIntStatus(pstcHandle->DMAx,
+                                ((DMA_TC_INT_CH0 | DMA_BTC_INT_CH0) << pstcHandle->u8DmaCh));
+        if (pstcHandle->enResult == OperationInProgress)
+        {
+            if (pstcHandle->u32BlockCnt > 0UL)
+            {
+                pstcHandle->u32BlockCnt--;
+                (void)DMA_SwTrigger(pstcHandle->DMAx, pstcHandle->u8DmaCh);
+            }
+            else
+            {
+                CRC_DMA_Run(pstcHandle);
+            }
+        }
+    }
+}
+#endif /* DDL_DMA_ENABLE && DDL_INTERRUPTS_ENABLE */
+
 /**
  * @}
  */
@@ -330,6 +572,187 @@ static void CRC_32BitWrite(const uint32_t au32Data[], uint32_t u32Length)
     }
 }
 
+/**
+ * @brief  Write the CRC result register.
+ * @param  [in]  u32CrcProtocol     CRC protocol control bit.
+ * @param  [in]  u32Val             The value to write.
+ * @retval None
+ */
+static void CRC_WriteReslt(uint32_t u32CrcProtocol, uint32_t u32Val)
+{
+    if (u32CrcProtocol == CRC_CRC32)
+    {
+        WRITE_REG32(M4_CRC->RESLT, u32Val);
+    }
+    else
+    {
+        WRITE_REG16(M4_CRC->RESLT, u32Val);
+    }
+}
+
+/**
+ * @brief  Read the CRC result register.
+ * @param  [in]  u32CrcProtocol     CRC protocol control bit.
+ * @retval The value of the result register.
+ */
+static uint32_t CRC_ReadReslt(uint32_t u32CrcProtocol)
+{
+    uint32_t u32Val;
+
+    if (u32CrcProtocol == CRC_CRC32)
+    {
+        u32Val = READ_REG32(M4_CRC->RESLT);
+    }
+    else
+    {
+        u32Val = READ_REG16(M4_CRC->RESLT);
+    }
+    return u32Val;
+}
+
+/**
+ * @brief  Reload the running checksum of a context unless the CRC unit holds it.
+ * @param  [in]  pstcCtx            Pointer to the context.
+ * @retval None
+ */
+static void CRC_CtxLoad(const stc_crc_ctx_t *pstcCtx)
+{
+    if (m_pstcCrcCtx != pstcCtx)
+    {
+        WRITE_REG32(M4_CRC->CR, pstcCtx->u32Protocol);
+        CRC_WriteReslt(pstcCtx->u32Protocol, pstcCtx->u32Reslt ^ pstcCtx->u32ResltMask);
+        m_pstcCrcCtx = pstcCtx;
+    }
+}
+
+/**
+ * @brief  Write a byte stream to the CRC data register, in words where it is
+ *         word aligned.
+ * @param  [in]  pu8Data            The buffer for writing.
+ * @param  [in]  u32Length          The length of the data in bytes.
+ * @retval None
+ */
+static void CRC_ByteStreamWrite(const uint8_t *pu8Data, uint32_t u32Length)
+{
+    uint32_t u32Head;
+    uint32_t u32Words;
+
+    u32Head = (4UL - ((uint32_t)pu8Data & 3UL)) & 3UL;
+    if (u32Head > u32Length)
+    {
+        u32Head = u32Length;
+    }
+    CRC_8BitWrite(pu8Data, u32Head);
+    u32Length -= u32Head;
+
+    u32Words = u32Length >> 2U;
+    CRC_32BitWrite((const uint32_t *)(const void *)&pu8Data[u32Head], u32Words);
+
+    CRC_8BitWrite(&pu8Data[u32Head + (u32Words << 2U)], u32Length & 3UL);
+}
+
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_INTERRUPTS_ENABLE == DDL_ON)
+/**
+ * @brief  Start the DMA transfer of the next whole words, or write the tail
+ *         bytes and end the update if there are none.
+ * @param  [in]  pstcHandle         Pointer to the handle.
+ * @retval None
+ */
+static void CRC_DMA_Run(stc_crc_dma_handle_t *pstcHandle)
+{
+    stc_dma_init_t stcDmaInit;
+    uint32_t u32Words = pstcHandle->u32Length >> 2U;
+    uint32_t u32BlockSize;
+    uint32_t u32BlockCnt;
+
+    if (u32Words == 0UL)
+    {
+        CRC_8BitWrite(pstcHandle->pu8Data, pstcHandle->u32Length);
+        pstcHandle->pstcCtx->u32Reslt = CRC_ReadReslt(pstcHandle->pstcCtx->u32Protocol);
+        CRC_DMA_Release(pstcHandle);
+        m_pstcCrcDma = NULL;
+        pstcHandle->enResult = Ok;
+        if (pstcHandle->pfnCpltCallback != NULL)
+        {
+            pstcHandle->pfnCpltCallback();
+        }
+    }
+    else
+    {
+        u32BlockSize = (u32Words < CRC_DMA_BLOCK_WORDS) ? u32Words : CRC_DMA_BLOCK_WORDS;
+        u32BlockCnt  = u32Words / u32BlockSize;
+        if (u32BlockCnt > CRC_DMA_MAX_BLOCKS)
+        {
+            u32BlockCnt = CRC_DMA_MAX_BLOCKS;
+        }
+
+        (void)DMA_StructInit(&stcDmaInit);
+        stcDmaInit.u32IntEn     = DMA_INT_ENABLE;
+        stcDmaInit.u32SrcAddr   = (uint32_t)pstcHandle->pu8Data;
+        stcDmaInit.u32DestAddr  = (uint32_t)(&M4_CRC->DAT0);
+        stcDmaInit.u32DataWidth = DMA_DATAWIDTH_32BIT;
+        stcDmaInit.u32BlockSize = u32BlockSize;
+        stcDmaInit.u32TransCnt  = u32BlockCnt;
+        stcDmaInit.u32SrcInc    = DMA_SRC_ADDR_INC;
+        stcDmaInit.u32DestInc   = DMA_DEST_ADDR_FIX;
+        (void)DMA_Init(pstcHandle->DMAx, pstcHandle->u8DmaCh, &stcDmaInit);
+
+        pstcHandle->pu8Data     = &pstcHandle->pu8Data[(u32BlockSize * u32BlockCnt) << 2U];
+        pstcHandle->u32Length  -= (u32BlockSize * u32BlockCnt) << 2U;
+        pstcHandle->u32BlockCnt = u32BlockCnt - 1UL;
+
+        /* Every block done triggers the next one from CRC_DMA_IrqHandler() */
+        DMA_ClearTransIntStatus(pstcHandle->DMAx,
+                                ((DMA_TC_INT_CH0 | DMA_BTC_INT_CH0) << pstcHandle->u8DmaCh));
+        DMA_TransIntCmd(pstcHandle->DMAx, (DMA_TC_INT_CH0 << pstcHandle->u8DmaCh), Disable);
+        DMA_TransIntCmd(pstcHandle->DMAx, (DMA_BTC_INT_CH0 << pstcHandle->u8DmaCh), Enable);
+
+        DMA_Cmd(pstcHandle->DMAx, Enable);
+        DMA_ChannelCmd(pstcHandle->DMAx, pstcHandle->u8DmaCh, Enable);
+        (void)DMA_SwTrigger(pstcHandle->DMAx, pstcHandle->u8DmaCh);
+    }
+}
+
+/**
+ * @brief  Claim the DMA channel of a handle and take the software trigger for it.
+ * @param  [in]  pstcHandle         Pointer to the handle.
+ * @retval Ok: The channel is claimed and owns the software trigger
+ *         ErrorInvalidMode: The channel is owned by another user
+ *         ErrorOperationInProgress: Another channel owns the software trigger
+ */
+static en_result_t CRC_DMA_Claim(stc_crc_dma_handle_t *pstcHandle)
+{
+    en_result_t enRet;
+
+    pstcHandle->stcDmaCh.DMAx           = pstcHandle->DMAx;
+    pstcHandle->stcDmaCh.u8Ch           = pstcHandle->u8DmaCh;
+    pstcHandle->stcDmaCh.pfnTcCallback  = NULL;
+    pstcHandle->stcDmaCh.pfnBtcCallback = NULL;
+    pstcHandle->stcDmaCh.pfnErrCallback = NULL;
+    enRet = DMA_ChClaim(&pstcHandle->stcDmaCh, EVT_MAX);
+    if (enRet == Ok)
+    {
+        enRet = DMA_SwTrigAcquire(pstcHandle->DMAx, pstcHandle->u8DmaCh);
+        if (enRet != Ok)
+        {
+            (void)DMA_ChFree(&pstcHandle->stcDmaCh);
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Give back the software trigger and the DMA channel of a handle.
+ * @param  [in]  pstcHandle         Pointer to the handle.
+ * @retval None
+ */
+static void CRC_DMA_Release(const stc_crc_dma_handle_t *pstcHandle)
+{
+    (void)DMA_SwTrigRelease(pstcHandle->DMAx, pstcHandle->u8DmaCh);
+    (void)DMA_ChFree(&pstcHandle->stcDmaCh);
+}
+#endif /* DDL_DMA_ENABLE && DDL_INTERRUPTS_ENABLE */
+
 /**
  * @}
  */
@@ -7,6 +7,17 @@
    Change Logs:
    Date             Author          Notes
    2020-06-12       Zhangxl         First version
+   2026-10-17       Zhangxl         Add channel manager DMA_ChAlloc/DMA_ChClaim/DMA_ChFree
+                                    and DMA_ChIrqHandler
+   2026-10-17       Zhangxl         Add LLP chain builder DMA_LlpChainInit/DMA_LlpChainBuild
+                                    and DMA_LlpChainLoad
+   2026-10-17       Zhangxl         Add memory copy/set queue DMA_MemInit/DMA_MemCopy/DMA_MemSet
+                                    and DMA_MemIrqHandler
+   2026-10-17       Zhangxl         Add ping-pong stream DMA_StreamInit/DMA_StreamStart/DMA_StreamStop,
+                                    DMA_StreamRelease and DMA_StreamIrqHandler
+   2026-10-17       Zhangxl         Add 2D transfer DMA_BlitStructInit/DMA_BlitBuild/DMA_BlitStart
+   2026-10-17       Zhangxl         Add software trigger owner DMA_SwTrigAcquire/DMA_SwTrigRelease
+                                    and DMA_SwTrigger
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -55,6 +66,7 @@
  * Include files
  ******************************************************************************/
 #include "hc32f4a0_dma.h"
+#include "hc32f4a0_interrupts.h"
 #include "hc32f4a0_utility.h"
 
 /**
@@ -83,6 +95,28 @@
  */
 #define DMA_CH_REG(reg_base, ch)    (*(uint32_t *)((uint32_t)(&(reg_base)) + ((ch) * 0x40UL)))
 
+#define DMA_UNIT_NUM                (2U)
+#define DMA_CH_NUM                  (8U)
+#define DMA_UNIT_IDX(unit)          (((unit) == M4_DMA1) ? 0U : 1U)
+#define DMA_CH_HINT_UNIT_MASK       (DMA_CH_HINT_UNIT1 | DMA_CH_HINT_UNIT2)
+
+/* Owner of the AOS software trigger: unit index and channel */
+#define DMA_SW_TRIG_KEY(unit, ch)   (((uint32_t)DMA_UNIT_IDX(unit) << 8U) | (uint32_t)(ch))
+#define DMA_SW_TRIG_FREE            (0xFFFFFFFFUL)
+
+/* Data count of a descriptor: one block in LLP run mode, blocks of one data in LLP wait mode */
+#define DMA_LLP_RUN_DESC_MAX        (1024UL)
+#define DMA_LLP_WAIT_DESC_MAX       (0xFFFFUL)
+
+/* Segments of a memory request: unaligned head, aligned body and tail */
+#define DMA_MEM_SEG_NUM             (3U)
+
+/* Block count of a descriptor is 16 bits */
+#define DMA_STREAM_BLK_CNT_MAX      (0xFFFFUL)
+
+/* Non-sequence offset field of SNSEQCTL/DNSEQCTL */
+#define DMA_NS_OFFSET_MAX           (DMA_SNSEQCTL_SOFFSET)
+
 /**
  * @defgroup DMA_Check_Parameters_Validity DMA Check Parameters Validity
  * @{
@@ -95,6 +129,11 @@
 /*! Parameter valid check for DMA channel. */
 #define IS_DMA_CH(ch)           ((ch) <= DMA_CH7)
 
+/*! Parameter valid check for DMA channel allocation hint. */
+#define IS_DMA_CH_HINT(hint)                                                    \
+(   ((hint) | DMA_CH_HINT_PRIO_LOW | DMA_CH_HINT_UNIT_MASK) ==                  \
+    (DMA_CH_HINT_PRIO_LOW | DMA_CH_HINT_UNIT_MASK))
+
 /*! Parameter valid check for DMA multiplex channel. */
 #define IS_DMA_MX_CH(ch)                                                        \
 (   ((ch) != 0x00UL)                        &&                                  \
@@ -223,10 +262,23 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+static void DMA_ChRegister(const stc_dma_ch_t *pstcCh, en_event_src_t enSrc);
+static en_flag_status_t DMA_ChTcTake(M4_DMA_TypeDef *DMAx, uint8_t u8Ch);
+static uint32_t DMA_LlpNextAddr(uint32_t u32Addr, uint32_t u32Inc, uint32_t u32Size);
+static uint32_t DMA_MemSplit(const stc_dma_mem_req_t *pstcReq, stc_dma_llp_seg_t astcSeg[], uint32_t *pu32DescCnt);
+static en_result_t DMA_MemPush(stc_dma_mem_t *pstcMem, const stc_dma_mem_req_t *pstcReq);
+static void DMA_MemStart(stc_dma_mem_t *pstcMem);
+static void DMA_LlpDescLoad(M4_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_llp_descriptor_t *pstcDesc);
+static uint32_t DMA_BlitNonSeqOfs(uint32_t u32Stride, uint32_t u32Width, uint32_t u32Size);
 
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/* Owners of the DMA channels, NULL for a free channel */
+static stc_dma_ch_t *m_apstcDmaCh[DMA_UNIT_NUM][DMA_CH_NUM];
+
+/* Channel allowed to fire the AOS software trigger, DMA_SW_TRIG_FREE for none */
+static uint32_t m_u32DmaSwTrigOwner = DMA_SW_TRIG_FREE;
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -1728,6 +1780,1441 @@ uint32_t DMA_GetNonSeqDestOffset(const M4_DMA_TypeDef *DMAx, uint8_t u8Ch)
     return (READ_REG32_BIT(DMA_CH_REG(DMAx->MONDNSEQCTL0, u8Ch), DMA_DNSEQCTL_DOFFSET));
 }
 
+/**
+ * @brief  Allocate a free DMA channel.
+ * @param  [in,out] pstcCh Pointer to a @ref stc_dma_ch_t structure, the callbacks are set by the caller,
+ *                         DMAx and u8Ch are set by the function. It is kept until DMA_ChFree().
+ * @param  [in] u32Hint Allocation hint, a combination of the priority and the unit of @ref DMA_Ch_Alloc_Hint
+ * @param  [in] enSrc Trigger source of the channel, @ref en_event_src_t
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok: A channel is allocated
+ *   @arg  ErrorInvalidParameter: pstcCh == NULL
+ *   @arg  ErrorBufferFull: No free channel
+ * @note   The interrupts of the channel are unmasked for the callbacks set, the channel interrupt itself
+ *         is enabled by DMA_Init() with DMA_INT_ENABLE.
+ * @note   The AOS clock must be enabled to bind the trigger source.
+ * @note   The channel is reserved with the interrupts masked, it may be called from thread and interrupt
+ *         contexts at the same time.
+ */
+en_result_t DMA_ChAlloc(stc_dma_ch_t *pstcCh, uint32_t u32Hint, en_event_src_t enSrc)
+{
+    uint8_t u8Unit;
+    uint8_t u8Idx;
+    uint8_t u8Ch = DMA_CH_NUM;
+    uint8_t u8UnitStart = 0U;
+    uint8_t u8UnitEnd = DMA_UNIT_NUM;
+    uint32_t u32Primask;
+    en_result_t enRet = ErrorBufferFull;
+
+    if (NULL == pstcCh)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        DDL_ASSERT(IS_DMA_CH_HINT(u32Hint));
+
+        if (DMA_CH_HINT_UNIT1 == (u32Hint & DMA_CH_HINT_UNIT_MASK))
+        {
+            u8UnitEnd = 1U;
+        }
+        else if (DMA_CH_HINT_UNIT2 == (u32Hint & DMA_CH_HINT_UNIT_MASK))
+        {
+            u8UnitStart = 1U;
+        }
+        else
+        {
+            /* Any unit */
+        }
+
+        /* Search and reserve with the interrupts masked */
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        for (u8Unit = u8UnitStart; u8Unit < u8UnitEnd; u8Unit++)
+        {
+            for (u8Idx = 0U; u8Idx < DMA_CH_NUM; u8Idx++)
+            {
+                /* Search from the channel of the hinted priority */
+                u8Ch = (DMA_CH_HINT_PRIO_LOW == (u32Hint & DMA_CH_HINT_PRIO_LOW)) ? (DMA_CH7 - u8Idx) : u8Idx;
+                if (NULL == m_apstcDmaCh[u8Unit][u8Ch])
+                {
+                    break;
+                }
+            }
+
+            if (u8Idx < DMA_CH_NUM)
+            {
+                m_apstcDmaCh[u8Unit][u8Ch] = pstcCh;
+                enRet = Ok;
+                break;
+            }
+        }
+        __set_PRIMASK(u32Primask);
+
+        if (Ok == enRet)
+        {
+            pstcCh->DMAx = (0U == u8Unit) ? M4_DMA1 : M4_DMA2;
+            pstcCh->u8Ch = u8Ch;
+            DMA_ChRegister(pstcCh, enSrc);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Claim a given DMA channel.
+ * @param  [in] pstcCh Pointer to a @ref stc_dma_ch_t structure with DMAx and u8Ch set to the wanted channel.
+ *                     It is kept until DMA_ChFree().
+ * @param  [in] enSrc Trigger source of the channel, @ref en_event_src_t
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok: The channel is claimed
+ *   @arg  ErrorInvalidParameter: pstcCh == NULL
+ *   @arg  ErrorInvalidMode: The channel is owned by another user
+ * @note   For the drivers bound to a fixed channel, the collision with the allocated channels is reported.
+ * @note   The channel is tested and reserved with the interrupts masked, as in DMA_ChAlloc().
+ */
+en_result_t DMA_ChClaim(stc_dma_ch_t *pstcCh, en_event_src_t enSrc)
+{
+    uint32_t u32Primask;
+    en_result_t enRet;
+
+    if (NULL == pstcCh)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        DDL_ASSERT(IS_DMA_UNIT(pstcCh->DMAx));
+        DDL_ASSERT(IS_DMA_CH(pstcCh->u8Ch));
+
+        /* Test and reserve with the interrupts masked */
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        if (NULL != m_apstcDmaCh[DMA_UNIT_IDX(pstcCh->DMAx)][pstcCh->u8Ch])
+        {
+            enRet = ErrorInvalidMode;
+        }
+        else
+        {
+            m_apstcDmaCh[DMA_UNIT_IDX(pstcCh->DMAx)][pstcCh->u8Ch] = pstcCh;
+            enRet = Ok;
+        }
+        __set_PRIMASK(u32Primask);
+
+        if (Ok == enRet)
+        {
+            DMA_ChRegister(pstcCh, enSrc);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Release a DMA channel.
+ * @param  [in] pstcCh Pointer to the @ref stc_dma_ch_t structure of the owner
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok: The channel is released
+ *   @arg  ErrorInvalidParameter: pstcCh == NULL or pstcCh is not the owner of the channel
+ * @note   The channel is disabled and its interrupts are masked.
+ */
+en_result_t DMA_ChFree(const stc_dma_ch_t *pstcCh)
+{
+    uint32_t u32ChBit;
+    en_result_t enRet = Ok;
+
+    if ((NULL == pstcCh) || (!IS_DMA_UNIT(pstcCh->DMAx)) || (!IS_DMA_CH(pstcCh->u8Ch)) ||
+        (pstcCh != m_apstcDmaCh[DMA_UNIT_IDX(pstcCh->DMAx)][pstcCh->u8Ch]))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        u32ChBit = 1UL << pstcCh->u8Ch;
+        DMA_ChannelCmd(pstcCh->DMAx, pstcCh->u8Ch, Disable);
+        DMA_TransIntCmd(pstcCh->DMAx, (u32ChBit | (u32ChBit << DMA_INTSTAT1_BTC_POS)), Disable);
+        DMA_ErrIntCmd(pstcCh->DMAx, (u32ChBit | (u32ChBit << DMA_INTSTAT0_REQERR_POS)), Disable);
+        DMA_ClearTransIntStatus(pstcCh->DMAx, (u32ChBit | (u32ChBit << DMA_INTSTAT1_BTC_POS)));
+        DMA_ClearErrIntStatus(pstcCh->DMAx, (u32ChBit | (u32ChBit << DMA_INTSTAT0_REQERR_POS)));
+        m_apstcDmaCh[DMA_UNIT_IDX(pstcCh->DMAx)][pstcCh->u8Ch] = NULL;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Dispatch the interrupts of a DMA unit to the callbacks of the channel owners.
+ * @param  [in] DMAx DMA unit instance.
+ *   @arg  M4_DMA1 Unit1.
+ *   @arg  M4_DMA2 Unit2.
+ * @retval None
+ * @note   Call it from the transfer completed, block transfer completed and error interrupts of the unit.
+ *         The flags of the channels not owned through the manager are left untouched.
+ */
+void DMA_ChIrqHandler(M4_DMA_TypeDef *DMAx)
+{
+    uint8_t u8Ch;
+    uint32_t u32ChBit;
+    uint32_t u32ErrStat;
+    uint32_t u32TransStat;
+    const stc_dma_ch_t *pstcCh;
+
+    DDL_ASSERT(IS_DMA_UNIT(DMAx));
+
+    u32ErrStat   = READ_REG32(DMAx->INTSTAT0) & ~READ_REG32(DMAx->INTMASK0);
+    u32TransStat = READ_REG32(DMAx->INTSTAT1) & ~READ_REG32(DMAx->INTMASK1);
+    for (u8Ch = 0U; u8Ch < DMA_CH_NUM; u8Ch++)
+    {
+        pstcCh   = m_apstcDmaCh[DMA_UNIT_IDX(DMAx)][u8Ch];
+        u32ChBit = 1UL << u8Ch;
+        if (NULL != pstcCh)
+        {
+            if (0UL != (u32ErrStat & (u32ChBit | (u32ChBit << DMA_INTSTAT0_REQERR_POS))))
+            {
+                DMA_ClearErrIntStatus(DMAx, (u32ErrStat & (u32ChBit | (u32ChBit << DMA_INTSTAT0_REQERR_POS))));
+                if (NULL != pstcCh->pfnErrCallback)
+                {
+                    pstcCh->pfnErrCallback();
+                }
+            }
+            if (0UL != (u32TransStat & (u32ChBit << DMA_INTSTAT1_BTC_POS)))
+            {
+                DMA_ClearTransIntStatus(DMAx, (u32ChBit << DMA_INTSTAT1_BTC_POS));
+                if (NULL != pstcCh->pfnBtcCallback)
+                {
+                    pstcCh->pfnBtcCallback();
+                }
+            }
+            if (0UL != (u32TransStat & u32ChBit))
+            {
+                DMA_ClearTransIntStatus(DMAx, u32ChBit);
+                if (NULL != pstcCh->pfnTcCallback)
+                {
+                    pstcCh->pfnTcCallback();
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Take the AOS software trigger (EVT_AOS_STRG) for a DMA channel.
+ * @param  [in] DMAx DMA unit instance.
+ *   @arg  M4_DMA1 Unit1.
+ *   @arg  M4_DMA2 Unit2.
+ * @param  [in] u8Ch DMA channel.
+ *   @arg  DMA_CH0 ~ DMA_CH7.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok: The channel owns the software trigger, its trigger source is set to EVT_AOS_STRG
+ *   @arg  ErrorOperationInProgress: Another channel owns the software trigger
+ * @note   One software trigger advances every enabled channel on EVT_AOS_STRG, so a single channel may
+ *         use it at a time: DMA_MemCopy(), DMA_MemSet(), DMA_BlitStart() and CRC_DMA_Update() all take
+ *         it here, and a busy owner is reported instead of moving extra blocks on its channel.
+ * @note   Taking it again from the owner succeeds. It is tested and taken with the interrupts masked,
+ *         as in DMA_ChAlloc(). The AOS clock must be enabled.
+ */
+en_result_t DMA_SwTrigAcquire(M4_DMA_TypeDef *DMAx, uint8_t u8Ch)
+{
+    uint32_t u32Primask;
+    uint32_t u32Key;
+    en_result_t enRet = ErrorOperationInProgress;
+
+    DDL_ASSERT(IS_DMA_UNIT(DMAx));
+    DDL_ASSERT(IS_DMA_CH(u8Ch));
+
+    u32Key = DMA_SW_TRIG_KEY(DMAx, u8Ch);
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    if ((DMA_SW_TRIG_FREE == m_u32DmaSwTrigOwner) || (u32Key == m_u32DmaSwTrigOwner))
+    {
+        m_u32DmaSwTrigOwner = u32Key;
+        enRet = Ok;
+    }
+    __set_PRIMASK(u32Primask);
+
+    if (Ok == enRet)
+    {
+        DMA_SetTriggerSrc(DMAx, u8Ch, EVT_AOS_STRG);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Give back the AOS software trigger taken by DMA_SwTrigAcquire().
+ * @param  [in] DMAx DMA unit instance.
+ *   @arg  M4_DMA1 Unit1.
+ *   @arg  M4_DMA2 Unit2.
+ * @param  [in] u8Ch DMA channel.
+ *   @arg  DMA_CH0 ~ DMA_CH7.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok: The software trigger is free
+ *   @arg  ErrorInvalidParameter: The channel does not own the software trigger
+ * @note   The trigger source of the channel is reset (EVT_MAX), the triggers of the next owner no
+ *         longer reach it.
+ */
+en_result_t DMA_SwTrigRelease(M4_DMA_TypeDef *DMAx, uint8_t u8Ch)
+{
+    uint32_t u32Primask;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    DDL_ASSERT(IS_DMA_UNIT(DMAx));
+    DDL_ASSERT(IS_DMA_CH(u8Ch));
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    if (DMA_SW_TRIG_KEY(DMAx, u8Ch) == m_u32DmaSwTrigOwner)
+    {
+        DMA_SetTriggerSrc(DMAx, u8Ch, EVT_MAX);
+        m_u32DmaSwTrigOwner = DMA_SW_TRIG_FREE;
+        enRet = Ok;
+    }
+    __set_PRIMASK(u32Primask);
+
+    return enRet;
+}
+
+/**
+ * @brief  Fire the AOS software trigger for the channel owning it.
+ * @param  [in] DMAx DMA unit instance.
+ *   @arg  M4_DMA1 Unit1.
+ *   @arg  M4_DMA2 Unit2.
+ * @param  [in] u8Ch DMA channel.
+ *   @arg  DMA_CH0 ~ DMA_CH7.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok: The software trigger is fired
+ *   @arg  ErrorInvalidMode: The channel does not own the software trigger, nothing is fired
+ */
+en_result_t DMA_SwTrigger(const M4_DMA_TypeDef *DMAx, uint8_t u8Ch)
+{
+    en_result_t enRet = ErrorInvalidMode;
+
+    DDL_ASSERT(IS_DMA_UNIT(DMAx));
+    DDL_ASSERT(IS_DMA_CH(u8Ch));
+
+    if (DMA_SW_TRIG_KEY(DMAx, u8Ch) == m_u32DmaSwTrigOwner)
+    {
+        AOS_SW_Trigger();
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize DMA LLP chain segment structure.
+ *          Fill each pstcSeg with default value
+ * @param  [in] pstcSeg Pointer to a stc_dma_llp_seg_t structure that
+ *                      contains configuration information.
+ * @retval Ok: DMA LLP chain segment structure initialize successful
+ *         ErrorInvalidParameter: NULL pointer
+ */
+en_result_t DMA_LlpSegStructInit(stc_dma_llp_seg_t *pstcSeg)
+{
+    en_result_t enRet = Ok;
+
+    if (NULL == pstcSeg)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        pstcSeg->u32SrcAddr   = 0x00UL;
+        pstcSeg->u32DestAddr  = 0x00UL;
+        pstcSeg->u32Length    = 0x00UL;
+        pstcSeg->u32DataWidth = DMA_DATAWIDTH_32BIT;
+        pstcSeg->u32SrcInc    = DMA_SRC_ADDR_INC;
+        pstcSeg->u32DestInc   = DMA_DEST_ADDR_INC;
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Initialize a DMA LLP chain on a descriptor array.
+ * @param  [out] pstcChain Pointer to a stc_dma_llp_chain_t structure
+ * @param  [in] astcDesc Descriptor array, word aligned, kept until the chain is no more used
+ * @param  [in] u32DescNum Descriptor count of the array
+ * @param  [in] u32LlpRun Chain mode.
+ *   @arg  DMA_LLP_RUN: A segment is split in blocks of up to 1024 data, the chain runs from one trigger.
+ *   @arg  DMA_LLP_WAIT: Each request transfers one data, a descriptor holds up to 65535 data.
+ * @retval Ok: DMA LLP chain initialize successful
+ *         ErrorInvalidParameter: NULL pointer or u32DescNum == 0
+ */
+en_result_t DMA_LlpChainInit(stc_dma_llp_chain_t *pstcChain, stc_dma_llp_descriptor_t astcDesc[],
+                             uint32_t u32DescNum, uint32_t u32LlpRun)
+{
+    en_result_t enRet = Ok;
+
+    if ((NULL == pstcChain) || (NULL == astcDesc) || (0UL == u32DescNum))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        DDL_ASSERT(IS_DMA_LLP_ADDR((uint32_t)astcDesc));
+        DDL_ASSERT(IS_DMA_LLP_MODE(u32LlpRun));
+
+        pstcChain->pstcDesc   = astcDesc;
+        pstcChain->u32DescNum = u32DescNum;
+        pstcChain->u32DescCnt = 0UL;
+        pstcChain->u32LlpRun  = u32LlpRun;
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Build the linked descriptors of a DMA LLP chain from a segment list.
+ * @param  [in] pstcChain Pointer to a stc_dma_llp_chain_t structure
+ * @param  [in] astcSeg Segment list
+ * @param  [in] u32SegNum Segment count
+ * @param  [in] u32IntEn Interrupt of the chain, raised at the end of the last segment.
+ *   @arg  DMA_INT_ENABLE
+ *   @arg  DMA_INT_DISABLE
+ * @param  [in] enCircular The last descriptor is linked to the first one.
+ *   @arg  Enable
+ *   @arg  Disable
+ * @retval Ok: The chain is built
+ *         ErrorInvalidParameter: NULL pointer, u32SegNum == 0 or a segment length is 0
+ *         ErrorBufferFull: The descriptor array is too small
+ * @note   The descriptors are not modified by the DMA, a built chain is loaded again by DMA_LlpChainLoad()
+ *         to repeat the transfer.
+ */
+en_result_t DMA_LlpChainBuild(stc_dma_llp_chain_t *pstcChain, const stc_dma_llp_seg_t astcSeg[],
+                              uint32_t u32SegNum, uint32_t u32IntEn, en_functional_state_t enCircular)
+{
+    uint32_t i;
+    uint32_t u32Size;
+    uint32_t u32Len;
+    uint32_t u32Cnt;
+    uint32_t u32DescMax;
+    uint32_t u32SrcAddr;
+    uint32_t u32DestAddr;
+    uint32_t u32DescCnt = 0UL;
+    stc_dma_llp_descriptor_t *pstcDesc = NULL;
+    en_result_t enRet = Ok;
+
+    if ((NULL == pstcChain) || (NULL == astcSeg) || (0UL == u32SegNum))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        DDL_ASSERT(IS_DMA_INT_FUNC(u32IntEn));
+        DDL_ASSERT(IS_FUNCTIONAL_STATE(enCircular));
+
+        u32DescMax = (DMA_LLP_RUN == pstcChain->u32LlpRun) ? DMA_LLP_RUN_DESC_MAX : DMA_LLP_WAIT_DESC_MAX;
+        for (i = 0UL; (i < u32SegNum) && (Ok == enRet); i++)
+        {
+            DDL_ASSERT(IS_DMA_DATA_WIDTH(astcSeg[i].u32DataWidth));
+            DDL_ASSERT(IS_DMA_SADDR_MODE(astcSeg[i].u32SrcInc));
+            DDL_ASSERT(IS_DMA_DADDR_MODE(astcSeg[i].u32DestInc));
+
+            if (0UL == astcSeg[i].u32Length)
+            {
+                enRet = ErrorInvalidParameter;
+            }
+            u32Size     = 1UL << (astcSeg[i].u32DataWidth >> DMA_CHCTL_HSIZE_POS);
+            u32Len      = astcSeg[i].u32Length;
+            u32SrcAddr  = astcSeg[i].u32SrcAddr;
+            u32DestAddr = astcSeg[i].u32DestAddr;
+            /* Split the segment in the descriptors */
+            while ((0UL != u32Len) && (Ok == enRet))
+            {
+                if (u32DescCnt >= pstcChain->u32DescNum)
+                {
+                    enRet = ErrorBufferFull;
+                }
+                else
+                {
+                    u32Cnt   = (u32Len > u32DescMax) ? u32DescMax : u32Len;
+                    pstcDesc = &pstcChain->pstcDesc[u32DescCnt];
+                    pstcDesc->SARx = u32SrcAddr;
+                    pstcDesc->DARx = u32DestAddr;
+                    if (DMA_LLP_RUN == pstcChain->u32LlpRun)
+                    {
+                        /* One block, the block size 1024 is written as 0 */
+                        pstcDesc->DTCTLx = (1UL << DMA_DTCTL_CNT_POS) | (u32Cnt & DMA_DTCTL_BLKSIZE);
+                    }
+                    else
+                    {
+                        pstcDesc->DTCTLx = (u32Cnt << DMA_DTCTL_CNT_POS) | 1UL;
+                    }
+                    pstcDesc->RPTx      = 0UL;
+                    pstcDesc->SNSEQCTLx = 0UL;
+                    pstcDesc->DNSEQCTLx = 0UL;
+                    pstcDesc->LLPx      = (uint32_t)&pstcChain->pstcDesc[u32DescCnt + 1UL];
+                    pstcDesc->CHCTLx    = astcSeg[i].u32SrcInc | astcSeg[i].u32DestInc | astcSeg[i].u32DataWidth |
+                                          DMA_LLP_ENABLE | pstcChain->u32LlpRun;
+                    u32SrcAddr  = DMA_LlpNextAddr(u32SrcAddr, astcSeg[i].u32SrcInc >> DMA_CHCTL_SINC_POS, u32Cnt * u32Size);
+                    u32DestAddr = DMA_LlpNextAddr(u32DestAddr, astcSeg[i].u32DestInc >> DMA_CHCTL_DINC_POS, u32Cnt * u32Size);
+                    u32Len -= u32Cnt;
+                    u32DescCnt++;
+                }
+            }
+        }
+
+        if (Ok == enRet)
+        {
+            pstcDesc->CHCTLx |= u32IntEn;
+            if (Enable == enCircular)
+            {
+                pstcDesc->LLPx = (uint32_t)&pstcChain->pstcDesc[0];
+            }
+            else
+            {
+                pstcDesc->LLPx = 0UL;
+                pstcDesc->CHCTLx &= ~DMA_LLP_ENABLE;
+            }
+            pstcChain->u32DescCnt = u32DescCnt;
+        }
+        else
+        {
+            pstcChain->u32DescCnt = 0UL;
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Load the first descriptor of a built DMA LLP chain into a DMA channel.
+ * @param  [in] DMAx DMA unit instance.
+ *   @arg  M4_DMA1 Unit1.
+ *   @arg  M4_DMA2 Unit2.
+ * @param  [in] u8Ch DMA channel.
+ *   @arg  DMA_CH0 ~ DMA_CH7.
+ * @param  [in] pstcChain Pointer to a stc_dma_llp_chain_t structure
+ * @retval Ok: The chain is loaded, it is started by DMA_ChannelCmd()
+ *         ErrorInvalidParameter: NULL pointer or the chain is not built
+ * @note   The channel must be disabled.
+ */
+en_result_t DMA_LlpChainLoad(M4_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_llp_chain_t *pstcChain)
+{
+    en_result_t enRet = Ok;
+
+    DDL_ASSERT(IS_DMA_UNIT(DMAx));
+    DDL_ASSERT(IS_DMA_CH(u8Ch));
+
+    if ((NULL == pstcChain) || (0UL == pstcChain->u32DescCnt))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        DMA_LlpDescLoad(DMAx, u8Ch, &pstcChain->pstcDesc[0]);
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Initialize a DMA memory copy/set engine on a channel.
+ * @param  [out] pstcMem Pointer to a stc_dma_mem_t structure
+ * @param  [in] DMAx DMA unit instance.
+ *   @arg  M4_DMA1 Unit1.
+ *   @arg  M4_DMA2 Unit2.
+ * @param  [in] u8Ch DMA channel, owned by the engine (e.g. taken by DMA_ChAlloc()).
+ *   @arg  DMA_CH0 ~ DMA_CH7.
+ * @param  [in] astcQueue Request queue, kept by the caller, one entry is kept free
+ * @param  [in] u32QueueSize Request count of the queue, 2 at least
+ * @param  [in] astcDesc Descriptor array of the request in progress, word aligned, kept by the caller.
+ *                       A request needs one descriptor per 1024 data, and up to two more.
+ * @param  [in] u32DescNum Descriptor count of the array
+ * @retval Ok: DMA memory engine initialize successful
+ *         ErrorInvalidParameter: NULL pointer, u32QueueSize < 2 or u32DescNum == 0
+ * @note   Every request is started by the AOS software trigger (EVT_AOS_STRG) and runs as an LLP chain.
+ *         The engine owns the software trigger (DMA_SwTrigAcquire()) from the first queued request until
+ *         its queue is empty. The clocks of DMA and AOS must be enabled, and the transfer completed
+ *         interrupt of the channel must call DMA_MemIrqHandler(), directly or as the pfnTcCallback of a
+ *         channel taken by DMA_ChAlloc()/DMA_ChClaim().
+ */
+en_result_t DMA_MemInit(stc_dma_mem_t *pstcMem, M4_DMA_TypeDef *DMAx, uint8_t u8Ch,
+                        stc_dma_mem_req_t astcQueue[], uint32_t u32QueueSize,
+                        stc_dma_llp_descriptor_t astcDesc[], uint32_t u32DescNum)
+{
+    en_result_t enRet;
+
+    DDL_ASSERT(IS_DMA_UNIT(DMAx));
+    DDL_ASSERT(IS_DMA_CH(u8Ch));
+
+    if ((NULL == pstcMem) || (NULL == astcQueue) || (u32QueueSize < 2UL))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        enRet = DMA_LlpChainInit(&pstcMem->stcChain, astcDesc, u32DescNum, DMA_LLP_RUN);
+        if (Ok == enRet)
+        {
+            pstcMem->DMAx         = DMAx;
+            pstcMem->u8Ch         = u8Ch;
+            pstcMem->pstcQueue    = astcQueue;
+            pstcMem->u32QueueSize = u32QueueSize;
+            pstcMem->u32Head      = 0UL;
+            pstcMem->u32Tail      = 0UL;
+            pstcMem->u8Busy       = 0U;
+
+            DMA_ChannelCmd(DMAx, u8Ch, Disable);
+            DMA_ClearTransIntStatus(DMAx, (1UL << u8Ch));
+            DMA_TransIntCmd(DMAx, (1UL << u8Ch), Enable);
+            DMA_Cmd(DMAx, Enable);
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Queue a DMA memory copy.
+ * @param  [in] pstcMem Pointer to a stc_dma_mem_t structure
+ * @param  [in] pvDest Destination, not overlapping the source
+ * @param  [in] pvSrc Source
+ * @param  [in] u32Size Size in bytes
+ * @param  [in] pfnCpltCallback Called by DMA_MemIrqHandler() when the copy is over, may be NULL
+ * @retval Ok: The copy is queued, it is started at once if the engine is idle
+ *         ErrorInvalidParameter: NULL pointer, u32Size == 0 or too few descriptors for the copy
+ *         ErrorBufferFull: The queue is full
+ *         ErrorOperationInProgress: The engine is idle and another channel owns the software trigger,
+ *                                   the copy is not queued
+ * @note   The data width is the widest one allowed by the relative alignment of the addresses,
+ *         the unaligned head and tail bytes are moved in bytes.
+ * @note   The request is queued with the interrupts masked, it may be called from a pfnCpltCallback.
+ */
+en_result_t DMA_MemCopy(stc_dma_mem_t *pstcMem, void *pvDest, const void *pvSrc,
+                        uint32_t u32Size, func_ptr_t pfnCpltCallback)
+{
+    stc_dma_mem_req_t stcReq;
+    en_result_t enRet;
+
+    if ((NULL == pvDest) || (NULL == pvSrc))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        stcReq.u32DestAddr     = (uint32_t)pvDest;
+        stcReq.u32SrcAddr      = (uint32_t)pvSrc;
+        stcReq.u32Size         = u32Size;
+        stcReq.u32Fill         = 0UL;
+        stcReq.pfnCpltCallback = pfnCpltCallback;
+        enRet = DMA_MemPush(pstcMem, &stcReq);
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Queue a DMA memory set.
+ * @param  [in] pstcMem Pointer to a stc_dma_mem_t structure
+ * @param  [in] pvDest Destination
+ * @param  [in] u8Value Byte value
+ * @param  [in] u32Size Size in bytes
+ * @param  [in] pfnCpltCallback Called by DMA_MemIrqHandler() when the set is over, may be NULL
+ * @retval Ok: The set is queued, it is started at once if the engine is idle
+ *         ErrorInvalidParameter: NULL pointer, u32Size == 0 or too few descriptors for the set
+ *         ErrorBufferFull: The queue is full
+ *         ErrorOperationInProgress: The engine is idle and another channel owns the software trigger,
+ *                                   the set is not queued
+ * @note   The value is read from the queue entry, the body aligned on words is written in words.
+ * @note   The request is queued with the interrupts masked, as in DMA_MemCopy().
+ */
+en_result_t DMA_MemSet(stc_dma_mem_t *pstcMem, void *pvDest, uint8_t u8Value,
+                       uint32_t u32Size, func_ptr_t pfnCpltCallback)
+{
+    stc_dma_mem_req_t stcReq;
+    en_result_t enRet;
+
+    if (NULL == pvDest)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        stcReq.u32DestAddr     = (uint32_t)pvDest;
+        stcReq.u32SrcAddr      = 0UL;
+        stcReq.u32Size         = u32Size;
+        stcReq.u32Fill         = (uint32_t)u8Value * 0x01010101UL;
+        stcReq.pfnCpltCallback = pfnCpltCallback;
+        enRet = DMA_MemPush(pstcMem, &stcReq);
+    }
+    return enRet;
+}
+
+/**
+ * @brief  DMA memory engine transfer completed interrupt handler.
+ * @param  [in] pstcMem Pointer to a stc_dma_mem_t structure
+ * @retval None
+ * @note   Call it from the transfer completed interrupt of the channel of the engine, or from the
+ *         pfnTcCallback of the channel when DMA_ChIrqHandler() dispatches it and has cleared the flag.
+ *         The next request is started, then the callback of the finished request is called. The
+ *         software trigger is given back when the queue is empty.
+ */
+void DMA_MemIrqHandler(stc_dma_mem_t *pstcMem)
+{
+    uint32_t u32Head;
+    func_ptr_t pfnCpltCallback;
+
+    if (NULL != pstcMem)
+    {
+        if (Set == DMA_ChTcTake(pstcMem->DMAx, pstcMem->u8Ch))
+        {
+            u32Head = pstcMem->u32Head;
+            if (u32Head != pstcMem->u32Tail)
+            {
+                pfnCpltCallback = pstcMem->pstcQueue[u32Head].pfnCpltCallback;
+                u32Head++;
+                pstcMem->u32Head = (u32Head < pstcMem->u32QueueSize) ? u32Head : 0UL;
+                if (pstcMem->u32Head != pstcMem->u32Tail)
+                {
+                    DMA_MemStart(pstcMem);
+                }
+                else
+                {
+                    pstcMem->u8Busy = 0U;
+                    (void)DMA_SwTrigRelease(pstcMem->DMAx, pstcMem->u8Ch);
+                }
+                if (NULL != pfnCpltCallback)
+                {
+                    pfnCpltCallback();
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Set the default value of a DMA ping-pong stream initialization structure.
+ * @param  [out] pstcStreamInit Pointer to a stc_dma_stream_init_t structure
+ * @retval Ok: DMA stream structure initialize successful
+ *         ErrorInvalidParameter: NULL pointer
+ */
+en_result_t DMA_StreamStructInit(stc_dma_stream_init_t *pstcStreamInit)
+{
+    en_result_t enRet = Ok;
+
+    if (NULL == pstcStreamInit)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        pstcStreamInit->u32Dir           = DMA_STREAM_PERIPH_TO_MEM;
+        pstcStreamInit->u32PeriphAddr    = 0x00UL;
+        pstcStreamInit->u32PeriphRptSize = 0x00UL;
+        pstcStreamInit->u32Buf0Addr      = 0x00UL;
+        pstcStreamInit->u32Buf1Addr      = 0x00UL;
+        pstcStreamInit->u32BufLen        = 0x00UL;
+        pstcStreamInit->u32BlockSize     = 1UL;
+        pstcStreamInit->u32DataWidth     = DMA_DATAWIDTH_8BIT;
+        pstcStreamInit->pfnHalfCallback  = NULL;
+        pstcStreamInit->pfnFullCallback  = NULL;
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Initialize a DMA ping-pong stream on a channel.
+ * @param  [out] pstcStream Pointer to a stc_dma_stream_t structure, kept while the stream runs
+ * @param  [in] DMAx DMA unit instance.
+ *   @arg  M4_DMA1 Unit1.
+ *   @arg  M4_DMA2 Unit2.
+ * @param  [in] u8Ch DMA channel, owned by the stream (e.g. taken by DMA_ChAlloc()).
+ *   @arg  DMA_CH0 ~ DMA_CH7.
+ * @param  [in] enTrigSrc Request of the peripheral, @ref en_event_src_t
+ * @param  [in] pstcStreamInit Pointer to a stc_dma_stream_init_t structure
+ * @retval Ok: DMA stream initialize successful
+ *         ErrorInvalidParameter: NULL pointer, block size out of range, buffer length 0, not a multiple
+ *                                of the block size or longer than 65535 blocks
+ * @note   The two buffers are linked to each other by LLP in wait mode, so the DMA goes on with the
+ *         other buffer at the next request without any software action.
+ *         The transfer completed interrupt of the channel must call DMA_StreamIrqHandler().
+ */
+en_result_t DMA_StreamInit(stc_dma_stream_t *pstcStream, M4_DMA_TypeDef *DMAx, uint8_t u8Ch,
+                           en_event_src_t enTrigSrc, const stc_dma_stream_init_t *pstcStreamInit)
+{
+    uint32_t i;
+    uint32_t u32Rpt = 0UL;
+    uint32_t u32PeriphCtl = 0UL;
+    uint32_t au32BufAddr[2U];
+    stc_dma_llp_descriptor_t *pstcDesc;
+    en_result_t enRet = Ok;
+
+    DDL_ASSERT(IS_DMA_UNIT(DMAx));
+    DDL_ASSERT(IS_DMA_CH(u8Ch));
+
+    if ((NULL == pstcStream) || (NULL == pstcStreamInit))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else if ((0UL == pstcStreamInit->u32BlockSize) || (!IS_DMA_BLKSZ(pstcStreamInit->u32BlockSize)) ||
+             (0UL == pstcStreamInit->u32BufLen) ||
+             (0UL != (pstcStreamInit->u32BufLen % pstcStreamInit->u32BlockSize)) ||
+             ((pstcStreamInit->u32BufLen / pstcStreamInit->u32BlockSize) > DMA_STREAM_BLK_CNT_MAX))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        DDL_ASSERT(IS_DMA_BLKSZ(pstcStreamInit->u32PeriphRptSize));
+        DDL_ASSERT(IS_DMA_DATA_WIDTH(pstcStreamInit->u32DataWidth));
+        DDL_ASSERT(IS_DMA_LLP_ADDR((uint32_t)&pstcStream->astcDesc[0]));
+
+        au32BufAddr[0U] = pstcStreamInit->u32Buf0Addr;
+        au32BufAddr[1U] = pstcStreamInit->u32Buf1Addr;
+        /* Peripheral side: fixed, or increased and reloaded every u32PeriphRptSize data */
+        if (0UL != pstcStreamInit->u32PeriphRptSize)
+        {
+            u32Rpt = pstcStreamInit->u32PeriphRptSize & DMA_RPT_SRPT;
+            u32PeriphCtl = (DMA_STREAM_PERIPH_TO_MEM == pstcStreamInit->u32Dir) ?
+                           (DMA_SRC_ADDR_INC | DMA_SRC_RPT_ENABLE) : (DMA_DEST_ADDR_INC | DMA_DEST_RPT_ENABLE);
+        }
+
+        for (i = 0UL; i < 2UL; i++)
+        {
+            pstcDesc = &pstcStream->astcDesc[i];
+            if (DMA_STREAM_PERIPH_TO_MEM == pstcStreamInit->u32Dir)
+            {
+                pstcDesc->SARx   = pstcStreamInit->u32PeriphAddr;
+                pstcDesc->DARx   = au32BufAddr[i];
+                pstcDesc->RPTx   = u32Rpt;
+                pstcDesc->CHCTLx = u32PeriphCtl | DMA_DEST_ADDR_INC;
+            }
+            else
+            {
+                pstcDesc->SARx   = au32BufAddr[i];
+                pstcDesc->DARx   = pstcStreamInit->u32PeriphAddr;
+                pstcDesc->RPTx   = u32Rpt << DMA_RPT_DRPT_POS;
+                pstcDesc->CHCTLx = u32PeriphCtl | DMA_SRC_ADDR_INC;
+            }
+            /* The block size 1024 is written as 0 */
+            pstcDesc->DTCTLx    = ((pstcStreamInit->u32BufLen / pstcStreamInit->u32BlockSize) << DMA_DTCTL_CNT_POS) |
+                                  (pstcStreamInit->u32BlockSize & DMA_DTCTL_BLKSIZE);
+            pstcDesc->SNSEQCTLx = 0UL;
+            pstcDesc->DNSEQCTLx = 0UL;
+            pstcDesc->LLPx      = (uint32_t)&pstcStream->astcDesc[1UL - i];
+            pstcDesc->CHCTLx   |= pstcStreamInit->u32DataWidth | DMA_LLP_ENABLE | DMA_LLP_WAIT | DMA_INT_ENABLE;
+        }
+
+        pstcStream->DMAx            = DMAx;
+        pstcStream->u8Ch            = u8Ch;
+        pstcStream->pfnHalfCallback = pstcStreamInit->pfnHalfCallback;
+        pstcStream->pfnFullCallback = pstcStreamInit->pfnFullCallback;
+        pstcStream->u32Index        = DMA_STREAM_BUF0;
+        pstcStream->au8Ready[0U]    = 0U;
+        pstcStream->au8Ready[1U]    = 0U;
+        pstcStream->u32OverrunCnt   = 0UL;
+
+        DMA_ChannelCmd(DMAx, u8Ch, Disable);
+        DMA_SetTriggerSrc(DMAx, u8Ch, enTrigSrc);
+        DMA_ClearTransIntStatus(DMAx, (1UL << u8Ch));
+        DMA_TransIntCmd(DMAx, (1UL << u8Ch), Enable);
+        DMA_Cmd(DMAx, Enable);
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Start a DMA ping-pong stream from the buffer 0.
+ * @param  [in] pstcStream Pointer to a stc_dma_stream_t structure
+ * @retval Ok: The stream is started
+ *         ErrorInvalidParameter: NULL pointer
+ * @note   Both buffers are released and the overrun count is cleared.
+ */
+en_result_t DMA_StreamStart(stc_dma_stream_t *pstcStream)
+{
+    en_result_t enRet = Ok;
+
+    if (NULL == pstcStream)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        DMA_ChannelCmd(pstcStream->DMAx, pstcStream->u8Ch, Disable);
+        pstcStream->u32Index      = DMA_STREAM_BUF0;
+        pstcStream->au8Ready[0U]  = 0U;
+        pstcStream->au8Ready[1U]  = 0U;
+        pstcStream->u32OverrunCnt = 0UL;
+        DMA_ClearTransIntStatus(pstcStream->DMAx, (1UL << pstcStream->u8Ch));
+        DMA_LlpDescLoad(pstcStream->DMAx, pstcStream->u8Ch, &pstcStream->astcDesc[0U]);
+        DMA_ChannelCmd(pstcStream->DMAx, pstcStream->u8Ch, Enable);
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Stop a DMA ping-pong stream.
+ * @param  [in] pstcStream Pointer to a stc_dma_stream_t structure
+ * @retval Ok: The stream is stopped
+ *         ErrorInvalidParameter: NULL pointer
+ */
+en_result_t DMA_StreamStop(const stc_dma_stream_t *pstcStream)
+{
+    en_result_t enRet = Ok;
+
+    if (NULL == pstcStream)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        DMA_ChannelCmd(pstcStream->DMAx, pstcStream->u8Ch, Disable);
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Release a buffer of a DMA ping-pong stream once its data are consumed (or refilled).
+ * @param  [in] pstcStream Pointer to a stc_dma_stream_t structure
+ * @param  [in] u32Buf Buffer reported by the half or full callback.
+ *   @arg  DMA_STREAM_BUF0
+ *   @arg  DMA_STREAM_BUF1
+ * @retval Ok: The buffer is released
+ *         ErrorInvalidParameter: NULL pointer or invalid buffer
+ *         ErrorInvalidMode: The buffer is not done
+ * @note   A buffer done again before being released is counted as an overrun.
+ */
+en_result_t DMA_StreamRelease(stc_dma_stream_t *pstcStream, uint32_t u32Buf)
+{
+    en_result_t enRet = Ok;
+
+    if ((NULL == pstcStream) || (u32Buf > DMA_STREAM_BUF1))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        if (0U == pstcStream->au8Ready[u32Buf])
+        {
+            enRet = ErrorInvalidMode;
+        }
+        else
+        {
+            pstcStream->au8Ready[u32Buf] = 0U;
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Get the overrun count of a DMA ping-pong stream.
+ * @param  [in] pstcStream Pointer to a stc_dma_stream_t structure
+ * @retval Buffers done again before being released since DMA_StreamStart(), 0 for a NULL pointer
+ */
+uint32_t DMA_StreamGetOverrunCnt(const stc_dma_stream_t *pstcStream)
+{
+    uint32_t u32Cnt = 0UL;
+
+    if (NULL != pstcStream)
+    {
+        u32Cnt = pstcStream->u32OverrunCnt;
+    }
+    return u32Cnt;
+}
+
+/**
+ * @brief  DMA ping-pong stream transfer completed interrupt handler.
+ * @param  [in] pstcStream Pointer to a stc_dma_stream_t structure
+ * @retval None
+ * @note   Call it from the transfer completed interrupt of the channel of the stream, or from the
+ *         pfnTcCallback of the channel when DMA_ChIrqHandler() dispatches it and has cleared the flag.
+ *         It must be served within the time of one buffer, the buffer done is known by alternation.
+ */
+void DMA_StreamIrqHandler(stc_dma_stream_t *pstcStream)
+{
+    uint32_t u32Buf;
+
+    if (NULL != pstcStream)
+    {
+        if (Set == DMA_ChTcTake(pstcStream->DMAx, pstcStream->u8Ch))
+        {
+            u32Buf = pstcStream->u32Index;
+            pstcStream->u32Index = 1UL - u32Buf;
+            if (0U != pstcStream->au8Ready[u32Buf])
+            {
+                pstcStream->u32OverrunCnt++;
+            }
+            pstcStream->au8Ready[u32Buf] = 1U;
+
+            if (DMA_STREAM_BUF0 == u32Buf)
+            {
+                if (NULL != pstcStream->pfnHalfCallback)
+                {
+                    pstcStream->pfnHalfCallback();
+                }
+            }
+            else
+            {
+                if (NULL != pstcStream->pfnFullCallback)
+                {
+                    pstcStream->pfnFullCallback();
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Set the default value of a DMA 2D transfer structure.
+ * @param  [out] pstcBlit Pointer to a stc_dma_blit_t structure
+ * @retval Ok: DMA 2D transfer structure initialize successful
+ *         ErrorInvalidParameter: NULL pointer
+ */
+en_result_t DMA_BlitStructInit(stc_dma_blit_t *pstcBlit)
+{
+    en_result_t enRet = Ok;
+
+    if (NULL == pstcBlit)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        pstcBlit->u32SrcAddr    = 0x00UL;
+        pstcBlit->u32DestAddr   = 0x00UL;
+        pstcBlit->u32Width      = 0x00UL;
+        pstcBlit->u32Height     = 0x00UL;
+        pstcBlit->u32SrcStride  = 0x00UL;
+        pstcBlit->u32DestStride = 0x00UL;
+        pstcBlit->u32DataWidth  = DMA_DATAWIDTH_32BIT;
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Build the LLP chain of a DMA 2D transfer (blit) of a rectangle.
+ * @param  [in] pstcChain Pointer to a stc_dma_llp_chain_t structure, initialized in DMA_LLP_RUN mode
+ * @param  [in] pstcBlit Pointer to a stc_dma_blit_t structure
+ * @param  [in] u32IntEn Interrupt of the transfer, raised at the end of the last row.
+ *   @arg  DMA_INT_ENABLE
+ *   @arg  DMA_INT_DISABLE
+ * @retval Ok: The chain is built
+ *         ErrorInvalidParameter: NULL pointer, width or height is 0
+ *         ErrorInvalidMode: The chain is not in DMA_LLP_RUN mode
+ *         ErrorBufferFull: The descriptor array is too small
+ * @note   When a row holds up to 1024 data and the strides are multiples of the data width, not smaller
+ *         than a row, the non-sequence mode jumps from a row to the next one: a descriptor moves as many
+ *         whole rows as fit in a block of 1024 data. Otherwise every row has its own descriptors, split
+ *         in blocks of up to 1024 data.
+ */
+en_result_t DMA_BlitBuild(stc_dma_llp_chain_t *pstcChain, const stc_dma_blit_t *pstcBlit, uint32_t u32IntEn)
+{
+    uint32_t u32Size;
+    uint32_t u32SrcOfs;
+    uint32_t u32DestOfs;
+    uint32_t u32Rows;
+    uint32_t u32Cnt;
+    uint32_t u32Row = 0UL;
+    uint32_t u32Col = 0UL;
+    uint32_t u32DescNeed;
+    uint32_t u32DescCnt = 0UL;
+    uint32_t u32NonSeqCtl = 0UL;
+    stc_dma_llp_descriptor_t *pstcDesc = NULL;
+    en_result_t enRet = Ok;
+
+    if ((NULL == pstcChain) || (NULL == pstcBlit) || (0UL == pstcBlit->u32Width) || (0UL == pstcBlit->u32Height))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else if (DMA_LLP_RUN != pstcChain->u32LlpRun)
+    {
+        enRet = ErrorInvalidMode;
+    }
+    else
+    {
+        DDL_ASSERT(IS_DMA_INT_FUNC(u32IntEn));
+        DDL_ASSERT(IS_DMA_DATA_WIDTH(pstcBlit->u32DataWidth));
+
+        u32Size    = 1UL << (pstcBlit->u32DataWidth >> DMA_CHCTL_HSIZE_POS);
+        u32SrcOfs  = DMA_BlitNonSeqOfs(pstcBlit->u32SrcStride, pstcBlit->u32Width, u32Size);
+        u32DestOfs = DMA_BlitNonSeqOfs(pstcBlit->u32DestStride, pstcBlit->u32Width, u32Size);
+
+        if ((pstcBlit->u32Width <= DMA_LLP_RUN_DESC_MAX) && (0UL != u32SrcOfs) && (0UL != u32DestOfs))
+        {
+            /* Whole rows in a block, the offset 1 is the sequential address */
+            u32Rows = DMA_LLP_RUN_DESC_MAX / pstcBlit->u32Width;
+            u32DescNeed = (pstcBlit->u32Height + u32Rows - 1UL) / u32Rows;
+            if (1UL != u32SrcOfs)
+            {
+                u32NonSeqCtl |= DMA_SRC_NS_ENABLE;
+            }
+            if (1UL != u32DestOfs)
+            {
+                u32NonSeqCtl |= DMA_DEST_NS_ENABLE;
+            }
+        }
+        else
+        {
+            /* Row by row */
+            u32Rows = 0UL;
+            u32DescNeed = pstcBlit->u32Height *
+                          ((pstcBlit->u32Width + DMA_LLP_RUN_DESC_MAX - 1UL) / DMA_LLP_RUN_DESC_MAX);
+        }
+
+        if (u32DescNeed > pstcChain->u32DescNum)
+        {
+            pstcChain->u32DescCnt = 0UL;
+            enRet = ErrorBufferFull;
+        }
+        else
+        {
+            while (u32Row < pstcBlit->u32Height)
+            {
+                pstcDesc = &pstcChain->pstcDesc[u32DescCnt];
+                pstcDesc->SARx = pstcBlit->u32SrcAddr + (u32Row * pstcBlit->u32SrcStride) + (u32Col * u32Size);
+                pstcDesc->DARx = pstcBlit->u32DestAddr + (u32Row * pstcBlit->u32DestStride) + (u32Col * u32Size);
+                if (0UL != u32Rows)
+                {
+                    u32Cnt = pstcBlit->u32Height - u32Row;
+                    u32Cnt = ((u32Cnt < u32Rows) ? u32Cnt : u32Rows) * pstcBlit->u32Width;
+                    u32Row += u32Cnt / pstcBlit->u32Width;
+                }
+                else
+                {
+                    u32Cnt = pstcBlit->u32Width - u32Col;
+                    u32Cnt = (u32Cnt < DMA_LLP_RUN_DESC_MAX) ? u32Cnt : DMA_LLP_RUN_DESC_MAX;
+                    u32Col += u32Cnt;
+                    if (u32Col >= pstcBlit->u32Width)
+                    {
+                        u32Col = 0UL;
+                        u32Row++;
+                    }
+                }
+                /* One block, the block size 1024 is written as 0 */
+                pstcDesc->DTCTLx    = (1UL << DMA_DTCTL_CNT_POS) | (u32Cnt & DMA_DTCTL_BLKSIZE);
+                pstcDesc->RPTx      = 0UL;
+                /* The address jumps by the offset from the last data of a row to the first one of the next row */
+                pstcDesc->SNSEQCTLx = (0UL != (u32NonSeqCtl & DMA_SRC_NS_ENABLE)) ?
+                                      ((pstcBlit->u32Width << DMA_SNSEQCTL_SNSCNT_POS) | u32SrcOfs) : 0UL;
+                pstcDesc->DNSEQCTLx = (0UL != (u32NonSeqCtl & DMA_DEST_NS_ENABLE)) ?
+                                      ((pstcBlit->u32Width << DMA_DNSEQCTL_DNSCNT_POS) | u32DestOfs) : 0UL;
+                pstcDesc->LLPx      = (uint32_t)&pstcChain->pstcDesc[u32DescCnt + 1UL];
+                pstcDesc->CHCTLx    = DMA_SRC_ADDR_INC | DMA_DEST_ADDR_INC | pstcBlit->u32DataWidth | u32NonSeqCtl |
+                                      DMA_LLP_ENABLE | DMA_LLP_RUN;
+                u32DescCnt++;
+            }
+
+            pstcDesc->CHCTLx |= u32IntEn;
+            pstcDesc->CHCTLx &= ~DMA_LLP_ENABLE;
+            pstcDesc->LLPx    = 0UL;
+            pstcChain->u32DescCnt = u32DescCnt;
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Start a built DMA 2D transfer by the AOS software trigger.
+ * @param  [in] DMAx DMA unit instance.
+ *   @arg  M4_DMA1 Unit1.
+ *   @arg  M4_DMA2 Unit2.
+ * @param  [in] u8Ch DMA channel.
+ *   @arg  DMA_CH0 ~ DMA_CH7.
+ * @param  [in] pstcChain Pointer to a stc_dma_llp_chain_t structure built by DMA_BlitBuild()
+ * @retval Ok: The transfer is started, its end is the transfer completed flag of the channel
+ *         ErrorInvalidParameter: NULL pointer or the chain is not built
+ *         ErrorOperationInProgress: Another channel owns the software trigger, nothing is started
+ * @note   The channel takes the software trigger with DMA_SwTrigAcquire(), which sets its trigger to
+ *         EVT_AOS_STRG. Give it back with DMA_SwTrigRelease() once the transfer completed flag is set.
+ *         The clocks of DMA and AOS must be enabled.
+ */
+en_result_t DMA_BlitStart(M4_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_llp_chain_t *pstcChain)
+{
+    en_result_t enRet;
+
+    DDL_ASSERT(IS_DMA_UNIT(DMAx));
+    DDL_ASSERT(IS_DMA_CH(u8Ch));
+
+    if ((NULL == pstcChain) || (0UL == pstcChain->u32DescCnt))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        enRet = DMA_SwTrigAcquire(DMAx, u8Ch);
+        if (Ok == enRet)
+        {
+            DMA_ChannelCmd(DMAx, u8Ch, Disable);
+            DMA_ClearTransIntStatus(DMAx, (1UL << u8Ch));
+            DMA_LlpDescLoad(DMAx, u8Ch, &pstcChain->pstcDesc[0]);
+            DMA_Cmd(DMAx, Enable);
+            DMA_ChannelCmd(DMAx, u8Ch, Enable);
+            enRet = DMA_SwTrigger(DMAx, u8Ch);
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DMA_Local_Functions DMA Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Non-sequence offset from the last data of a row to the first data of the next row.
+ * @param  [in] u32Stride Bytes from a row to the next one
+ * @param  [in] u32Width Data count of a row
+ * @param  [in] u32Size Bytes of a data
+ * @retval Offset in data, 0 when the rows cannot be reached by the non-sequence mode
+ */
+static uint32_t DMA_BlitNonSeqOfs(uint32_t u32Stride, uint32_t u32Width, uint32_t u32Size)
+{
+    uint32_t u32Ofs = 0UL;
+
+    if ((0UL == (u32Stride % u32Size)) && ((u32Stride / u32Size) >= u32Width))
+    {
+        u32Ofs = (u32Stride / u32Size) - u32Width + 1UL;
+        if (u32Ofs > DMA_NS_OFFSET_MAX)
+        {
+            u32Ofs = 0UL;
+        }
+    }
+    return u32Ofs;
+}
+
+/**
+ * @brief  Load a LLP descriptor into the registers of a DMA channel.
+ * @param  [in] DMAx DMA unit instance.
+ * @param  [in] u8Ch DMA channel.
+ * @param  [in] pstcDesc Pointer to the descriptor
+ * @retval None
+ */
+static void DMA_LlpDescLoad(M4_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_llp_descriptor_t *pstcDesc)
+{
+    WRITE_REG32(DMA_CH_REG(DMAx->SAR0, u8Ch), pstcDesc->SARx);
+    WRITE_REG32(DMA_CH_REG(DMAx->DAR0, u8Ch), pstcDesc->DARx);
+    WRITE_REG32(DMA_CH_REG(DMAx->DTCTL0, u8Ch), pstcDesc->DTCTLx);
+    WRITE_REG32(DMA_CH_REG(DMAx->RPT0, u8Ch), pstcDesc->RPTx);
+    WRITE_REG32(DMA_CH_REG(DMAx->SNSEQCTL0, u8Ch), pstcDesc->SNSEQCTLx);
+    WRITE_REG32(DMA_CH_REG(DMAx->DNSEQCTL0, u8Ch), pstcDesc->DNSEQCTLx);
+    WRITE_REG32(DMA_CH_REG(DMAx->LLP0, u8Ch), pstcDesc->LLPx);
+    WRITE_REG32(DMA_CH_REG(DMAx->CHCTL0, u8Ch), pstcDesc->CHCTLx);
+}
+
+/**
+ * @brief  Split a memory request in segments of the widest data width.
+ * @param  [in] pstcReq Pointer to the request
+ * @param  [out] astcSeg Segments, DMA_MEM_SEG_NUM at most
+ * @param  [out] pu32DescCnt Descriptor count of the segments in LLP run mode
+ * @retval Segment count
+ */
+static uint32_t DMA_MemSplit(const stc_dma_mem_req_t *pstcReq, stc_dma_llp_seg_t astcSeg[], uint32_t *pu32DescCnt)
+{
+    uint32_t i;
+    uint32_t u32Align;
+    uint32_t u32Size;
+    uint32_t u32Len;
+    uint32_t u32SrcAddr = pstcReq->u32SrcAddr;
+    uint32_t u32SrcInc = DMA_SRC_ADDR_INC;
+    uint32_t u32DestAddr = pstcReq->u32DestAddr;
+    uint32_t u32Remain = pstcReq->u32Size;
+    uint32_t u32SegCnt = 0UL;
+
+    if (0UL == u32SrcAddr)
+    {
+        /* Memory set: the word of the queue entry is read again and again */
+        u32SrcAddr = (uint32_t)&pstcReq->u32Fill;
+        u32SrcInc  = DMA_SRC_ADDR_FIX;
+        u32Align   = 0UL;
+    }
+    else
+    {
+        u32Align = u32SrcAddr ^ u32DestAddr;
+    }
+    /* Widest width keeping both addresses aligned */
+    u32Size = ((0UL == (u32Align & 0x03UL)) ? 4UL : ((0UL == (u32Align & 0x01UL)) ? 2UL : 1UL));
+
+    *pu32DescCnt = 0UL;
+    for (i = 0UL; (i < DMA_MEM_SEG_NUM) && (0UL != u32Remain); i++)
+    {
+        /* Head bytes up to the aligned body, the body, then the tail bytes */
+        if ((0UL == i) && (0UL != (u32DestAddr & (u32Size - 1UL))))
+        {
+            u32Len = u32Size - (u32DestAddr & (u32Size - 1UL));
+            u32Len = (u32Len < u32Remain) ? u32Len : u32Remain;
+            astcSeg[u32SegCnt].u32DataWidth = DMA_DATAWIDTH_8BIT;
+            astcSeg[u32SegCnt].u32Length    = u32Len;
+        }
+        else if ((2UL != i) && (u32Remain >= u32Size))
+        {
+            u32Len = u32Remain & ~(u32Size - 1UL);
+            astcSeg[u32SegCnt].u32DataWidth = (4UL == u32Size) ? DMA_DATAWIDTH_32BIT :
+                                              ((2UL == u32Size) ? DMA_DATAWIDTH_16BIT : DMA_DATAWIDTH_8BIT);
+            astcSeg[u32SegCnt].u32Length    = u32Len / u32Size;
+        }
+        else
+        {
+            u32Len = u32Remain;
+            astcSeg[u32SegCnt].u32DataWidth = DMA_DATAWIDTH_8BIT;
+            astcSeg[u32SegCnt].u32Length    = u32Len;
+        }
+        astcSeg[u32SegCnt].u32SrcAddr  = u32SrcAddr;
+        astcSeg[u32SegCnt].u32DestAddr = u32DestAddr;
+        astcSeg[u32SegCnt].u32SrcInc   = u32SrcInc;
+        astcSeg[u32SegCnt].u32DestInc  = DMA_DEST_ADDR_INC;
+        *pu32DescCnt += (astcSeg[u32SegCnt].u32Length + DMA_LLP_RUN_DESC_MAX - 1UL) / DMA_LLP_RUN_DESC_MAX;
+        if (DMA_SRC_ADDR_INC == u32SrcInc)
+        {
+            u32SrcAddr += u32Len;
+        }
+        u32DestAddr += u32Len;
+        u32Remain   -= u32Len;
+        u32SegCnt++;
+    }
+    return u32SegCnt;
+}
+
+/**
+ * @brief  Push a request in the queue of a DMA memory engine, and start it if the engine is idle.
+ * @param  [in] pstcMem Pointer to a stc_dma_mem_t structure
+ * @param  [in] pstcReq Pointer to the request
+ * @retval Ok: The request is queued
+ *         ErrorInvalidParameter: NULL pointer, size 0 or too few descriptors for the request
+ *         ErrorBufferFull: The queue is full
+ *         ErrorOperationInProgress: The engine is idle and the software trigger is owned by another channel
+ * @note   The queue and the engine state are updated with the interrupts masked: DMA_MemIrqHandler()
+ *         and the callbacks it calls may queue requests at the same time as the thread.
+ */
+static en_result_t DMA_MemPush(stc_dma_mem_t *pstcMem, const stc_dma_mem_req_t *pstcReq)
+{
+    uint32_t u32Tail;
+    uint32_t u32DescCnt;
+    uint32_t u32Primask;
+    stc_dma_llp_seg_t astcSeg[DMA_MEM_SEG_NUM];
+    en_result_t enRet = Ok;
+
+    if ((NULL == pstcMem) || (0UL == pstcReq->u32Size))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        (void)DMA_MemSplit(pstcReq, astcSeg, &u32DescCnt);
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        u32Tail = pstcMem->u32Tail + 1UL;
+        u32Tail = (u32Tail < pstcMem->u32QueueSize) ? u32Tail : 0UL;
+        if (u32DescCnt > pstcMem->stcChain.u32DescNum)
+        {
+            enRet = ErrorInvalidParameter;
+        }
+        else if (u32Tail == pstcMem->u32Head)
+        {
+            enRet = ErrorBufferFull;
+        }
+        else if ((0U == pstcMem->u8Busy) && (Ok != DMA_SwTrigAcquire(pstcMem->DMAx, pstcMem->u8Ch)))
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            pstcMem->pstcQueue[pstcMem->u32Tail] = *pstcReq;
+            pstcMem->u32Tail = u32Tail;
+            if (0U == pstcMem->u8Busy)
+            {
+                pstcMem->u8Busy = 1U;
+                DMA_MemStart(pstcMem);
+            }
+        }
+        __set_PRIMASK(u32Primask);
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Start the request at the head of the queue of a DMA memory engine.
+ * @param  [in] pstcMem Pointer to a stc_dma_mem_t structure
+ * @retval None
+ */
+static void DMA_MemStart(stc_dma_mem_t *pstcMem)
+{
+    uint32_t u32SegCnt;
+    uint32_t u32DescCnt;
+    stc_dma_llp_seg_t astcSeg[DMA_MEM_SEG_NUM];
+
+    u32SegCnt = DMA_MemSplit(&pstcMem->pstcQueue[pstcMem->u32Head], astcSeg, &u32DescCnt);
+    (void)DMA_LlpChainBuild(&pstcMem->stcChain, astcSeg, u32SegCnt, DMA_INT_ENABLE, Disable);
+    (void)DMA_LlpChainLoad(pstcMem->DMAx, pstcMem->u8Ch, &pstcMem->stcChain);
+    DMA_ChannelCmd(pstcMem->DMAx, pstcMem->u8Ch, Enable);
+    (void)DMA_SwTrigger(pstcMem->DMAx, pstcMem->u8Ch);
+}
+
+/**
+ * @brief  Get the address following a part of a segment.
+ * @param  [in] u32Addr Start address of the part
+ * @param  [in] u32Inc Address mode: 0 fix, 1 increment, 2 decrement
+ * @param  [in] u32Size Size of the part in bytes
+ * @retval Start address of the next part
+ */
+static uint32_t DMA_LlpNextAddr(uint32_t u32Addr, uint32_t u32Inc, uint32_t u32Size)
+{
+    uint32_t u32NextAddr = u32Addr;
+
+    if (1UL == u32Inc)
+    {
+        u32NextAddr += u32Size;
+    }
+    else if (2UL == u32Inc)
+    {
+        u32NextAddr -= u32Size;
+    }
+    else
+    {
+        /* Fixed address */
+    }
+    return u32NextAddr;
+}
+
+/**
+ * @brief  Set up a channel reserved for its owner: bind its trigger source and unmask its interrupts.
+ * @param  [in] pstcCh Pointer to a @ref stc_dma_ch_t structure
+ * @param  [in] enSrc Trigger source of the channel, @ref en_event_src_t
+ * @retval None
+ */
+static void DMA_ChRegister(const stc_dma_ch_t *pstcCh, en_event_src_t enSrc)
+{
+    uint32_t u32ChBit = 1UL << pstcCh->u8Ch;
+
+    DMA_SetTriggerSrc(pstcCh->DMAx, pstcCh->u8Ch, enSrc);
+    DMA_ClearTransIntStatus(pstcCh->DMAx, (u32ChBit | (u32ChBit << DMA_INTSTAT1_BTC_POS)));
+    DMA_ClearErrIntStatus(pstcCh->DMAx, (u32ChBit | (u32ChBit << DMA_INTSTAT0_REQERR_POS)));
+    DMA_TransIntCmd(pstcCh->DMAx, u32ChBit, (NULL != pstcCh->pfnTcCallback) ? Enable : Disable);
+    DMA_TransIntCmd(pstcCh->DMAx, (u32ChBit << DMA_INTSTAT1_BTC_POS), (NULL != pstcCh->pfnBtcCallback) ? Enable : Disable);
+    DMA_ErrIntCmd(pstcCh->DMAx, (u32ChBit | (u32ChBit << DMA_INTSTAT0_REQERR_POS)),
+                  (NULL != pstcCh->pfnErrCallback) ? Enable : Disable);
+}
+
+/**
+ * @brief  Take the transfer completed event of a channel for its interrupt handler.
+ * @param  [in] DMAx DMA unit instance.
+ * @param  [in] u8Ch DMA channel.
+ * @retval Set: The transfer is completed, the flag is cleared
+ *         Reset: No transfer completed
+ * @note   A channel owned through DMA_ChAlloc()/DMA_ChClaim() gets its handler called by
+ *         DMA_ChIrqHandler() on the transfer completed flag, which it has already cleared.
+ */
+static en_flag_status_t DMA_ChTcTake(M4_DMA_TypeDef *DMAx, uint8_t u8Ch)
+{
+    en_flag_status_t enTc = Reset;
+
+    if (NULL != m_apstcDmaCh[DMA_UNIT_IDX(DMAx)][u8Ch])
+    {
+        enTc = Set;
+    }
+    else if (Set == DMA_GetTransIntStatus(DMAx, (1UL << u8Ch)))
+    {
+        DMA_ClearTransIntStatus(DMAx, (1UL << u8Ch));
+        enTc = Set;
+    }
+    else
+    {
+        /* Not completed */
+    }
+
+    return enTc;
+}
+
 /**
  * @}
  */
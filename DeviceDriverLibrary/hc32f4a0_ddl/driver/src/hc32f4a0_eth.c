@@ -9,6 +9,17 @@
    2020-06-12       Yangjp          First version
    2020-07-03       Yangjp          Optimize stc_eth_mac_init_t structure
    2020-08-11       Yangjp          Fix a known potential risk in ETH_Init function
+   2026-10-17       Yangjp          1. Add zero-copy scatter-gather transmit
+                                    2. Add Tx completion reclaim and completion queue
+                                    3. Add zero-copy receive with Rx buffer pool
+                                    4. Add Rx interrupt coalescing and batched receive
+                                    5. Add non-blocking PHY link state machine
+                                    6. Add per-frame Tx checksum insertion and Rx checksum status
+                                    7. Add PTP clock servo, nanosecond time and PPS alignment
+                                    8. Fix ETH_PTP_UpdateBasicIncValue() not updating the addend
+                                    9. Add multicast address and VLAN filter manager
+                                    10. Add L3/L4 flow table
+                                    11. Add MMC statistics collector
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -120,12 +131,36 @@
 /* Ethernet DMA Tx/Rx descriptors Buffer2 Size Shift */
 #define ETH_DMADESC_BUFFER2_SIZESHIFT                       (16UL)
 
+/* Ethernet DMA Tx descriptors status of a completed frame */
+#define ETH_DMATXDESC_CPLT_STATUS_MASK                      (ETH_DMATXDESC_TTSS | 0x0001FFFFUL)
+
 /* Ethernet Remote Wake-up frame register length */
 #define ETH_WAKEUP_REGISTER_LENGTH                          (8U)
 
 /* Ethernet PTP PPS channel 1 time register address Shift */
 #define ETH_PTP_PPS1_TIME_REG_ADDRSHIFT                     (0x64U)
 
+/* Ethernet MAC filter manager */
+#define ETH_MAC_FILTER_SLOT_MAX                             (4UL)
+#define ETH_MAC_FILTER_SLOT_INDEX(__SLOT__)                 ((uint32_t)(__SLOT__) * ETH_MAC_ADDRESS1)
+#define ETH_MAC_HASH_CRC32_POLY                             (0xEDB88320UL)
+
+/* Ethernet flow table */
+#define ETH_FLOW_FRAME_TYPE_OFFSET                          (12UL)
+#define ETH_FLOW_FRAME_TYPE_IPV4                            (0x0800U)
+#define ETH_FLOW_FRAME_TYPE_VLAN                            (0x8100U)
+#define ETH_FLOW_IPV4_HEADER_MIN                            (20UL)
+#define ETH_FLOW_IPV4_FRAG_OFFSET                           (0x1FFFU)
+
+/* Ethernet statistics */
+#define ETH_STAT_RATE_PERIOD                                (1000UL)
+
+/* Ethernet PTP time conversion */
+#define ETH_PTP_NS_PER_SEC                                  (1000000000UL)
+#define ETH_PTP_SUBSEC_MASK                                 (0x7FFFFFFFUL)
+#define ETH_PTP_SUBSEC_HEX_SHIFT                            (31U)
+#define ETH_PTP_SERVO_GAIN_SHIFT                            (16U)
+
 /* Wait timeout(ms) */
 #define ETH_TIMEOUT_WRITE_REGISTER                          (50UL)
 #define ETH_TIMEOUT_SOFTWARE_RESET                          (200UL)
@@ -175,6 +210,10 @@
 (   ((x) == ETH_RX_MODE_POLLING)                            ||                 \
     ((x) == ETH_RX_MODE_INTERRUPT))
 
+#define IS_ETH_PHY_INIT_MODE(x)                                                \
+(   ((x) == ETH_PHY_INIT_MODE_BLOCKING)                     ||                 \
+    ((x) == ETH_PHY_INIT_MODE_NONBLOCKING))
+
 #define IS_ETH_MAC_MEDIA_INTERFACE(x)                                          \
 (   ((x) == ETH_MAC_MEDIA_INTERFACE_MII)                    ||                 \
     ((x) == ETH_MAC_MEDIA_INTERFACE_RMII))
@@ -374,6 +413,14 @@
     ((x) == ETH_MAC_L3_SA_FILTER_NORMAL)                    ||                 \
     ((x) == ETH_MAC_L3_SA_FILTER_INVERSE))
 
+#define IS_ETH_FLOW_PROTOCOL(x)                                                \
+(   ((x) == ETH_FLOW_PROTOCOL_TCP)                          ||                 \
+    ((x) == ETH_FLOW_PROTOCOL_UDP))
+
+#define IS_ETH_FLOW_HW_FILTER_MODE(x)                                          \
+(   ((x) == ETH_FLOW_HW_FILTER_OFF)                         ||                 \
+    ((x) == ETH_FLOW_HW_FILTER_DEDICATED))
+
 #define IS_ETH_MAC_L3_ADDR_FILTER_PROTOCOL(x)                                  \
 (   ((x) == ETH_MAC_L3_ADDR_FILTER_PROTOCOL_IPV4)           ||                 \
     ((x) == ETH_MAC_L3_ADDR_FILTER_PROTOCOL_IPV6))
@@ -404,6 +451,8 @@
     ((x) == ETH_MAC_ADDRESS3)                               ||                 \
     ((x) == ETH_MAC_ADDRESS4))
 
+#define IS_ETH_MAC_FILTER_SLOT_NUM(x)                       ((x) <= ETH_MAC_FILTER_SLOT_MAX)
+
 #define IS_ETH_MAC_ADDRESS_FILTER(x)                                           \
 (   ((x) == ETH_MAC_ADDRESS_FILTER_DISABLE)                 ||                 \
     ((x) == ETH_MAC_ADDRESS_FILTER_PERFECT_DA)              ||                 \
@@ -828,10 +877,33 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+/**
+ * @addtogroup ETH_Local_Functions
+ * @{
+ */
+static en_result_t ETH_DMA_TxReclaimFrame(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_tx_cplt_t *pstcCplt);
+static uint8_t *ETH_DMA_RxPoolGet(stc_eth_dma_rx_pool_t *pstcPool);
+static uint32_t ETH_DMA_RxChecksumStatus(uint32_t u32Status, uint32_t u32ExtendStatus);
+static uint32_t ETH_PTP_NsToSubSec(uint32_t u32Ns);
+static uint32_t ETH_MAC_HashCrc32(const uint8_t au8Data[], uint32_t u32BitLen);
+static void ETH_FLOW_UpdateHwFilter(stc_eth_flow_table_t *pstcTable);
+static uint32_t ETH_STAT_Rate(uint64_t u64Total, uint64_t u64Base, uint32_t u32Time);
+static void ETH_MAC_FilterHashCmd(uint32_t u32Index, en_functional_state_t enNewSta);
+static void ETH_MAC_FilterVlanHashCmd(uint32_t u32Index, en_functional_state_t enNewSta);
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/* MMC counters folded by the statistics collector */
+static const uint16_t m_au16StatMmcReg[] = {
+    ETH_MMC_REG_RXUNGFR, ETH_MMC_REG_RXMUGFR, ETH_MMC_REG_RXBRGFR,
+    ETH_MMC_REG_TXUNGFR, ETH_MMC_REG_TXMUGFR, ETH_MMC_REG_TXBRGFR,
+    ETH_MMC_REG_RXCREFR, ETH_MMC_REG_RXALEFR, ETH_MMC_REG_RXRUEFR, ETH_MMC_REG_RXLEEFR, ETH_MMC_REG_RXOREFR,
+    ETH_MMC_REG_TXDEEFR, ETH_MMC_REG_TXLCEFR, ETH_MMC_REG_TXECEFR, ETH_MMC_REG_TXCAEFR, ETH_MMC_REG_TXEDEFR,
+};
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -902,7 +974,10 @@ en_result_t ETH_Init(stc_eth_handle_t *pstcEthHandle, stc_eth_init_t *pstcEthIni
         DDL_ASSERT(IS_ETH_MAC_CHECKSUM_MODE(pstcEthHandle->stcCommInit.u32ChecksumMode));
         DDL_ASSERT(IS_ETH_RX_MODE(pstcEthHandle->stcCommInit.u32RxMode));
         DDL_ASSERT(IS_ETH_MAC_MEDIA_INTERFACE(pstcEthHandle->stcCommInit.u32MediaInterface));
+        DDL_ASSERT(IS_ETH_PHY_INIT_MODE(pstcEthHandle->stcCommInit.u32PhyInitMode));
 
+        pstcEthHandle->u32PhyLinkState = ETH_PHY_LINK_STATE_RESET;
+        pstcEthHandle->u32PhyLinkTime  = 0UL;
         /* Select MII or RMII Mode*/
         MODIFY_REG32(M4_ETH->MAC_IFCONFR, ETH_MAC_IFCONFR_IFSEL, pstcEthHandle->stcCommInit.u32MediaInterface);
         /* ETH software reset */
@@ -944,6 +1019,13 @@ en_result_t ETH_Init(stc_eth_handle_t *pstcEthHandle, stc_eth_init_t *pstcEthIni
             {
                 enRet = ErrorTimeout;
             }
+            else if (ETH_PHY_INIT_MODE_NONBLOCKING == pstcEthHandle->stcCommInit.u32PhyInitMode)
+            {
+                /* ETH_PHY_LinkProcess() completes the PHY configuration,
+                   the MAC uses the configured duplex mode and speed until the link is up */
+                DDL_ASSERT(IS_ETH_MAC_SPEED(pstcEthHandle->stcCommInit.u32Speed));
+                DDL_ASSERT(IS_ETH_MAC_DUPLEX_MODE(pstcEthHandle->stcCommInit.u32DuplexMode));
+            }
             else
             {
                 /* Delay to assure PHY reset */
@@ -1053,6 +1135,16 @@ en_result_t ETH_Init(stc_eth_handle_t *pstcEthHandle, stc_eth_init_t *pstcEthIni
                         DDL_DelayMS(PHY_CONFIG_DELAY);
                     }
                 }
+
+                /* ETH_PHY_LinkProcess() follows the link changes from here */
+                if ((Ok == enRet) && (ETH_AUTO_NEGOTIATION_DISABLE != pstcEthHandle->stcCommInit.u16AutoNegotiation))
+                {
+                    pstcEthHandle->u32PhyLinkState = ETH_PHY_LINK_STATE_UP;
+                }
+                else
+                {
+                    pstcEthHandle->u32PhyLinkState = ETH_PHY_LINK_STATE_DOWN;
+                }
             }
 
             /* Auto-negotiation failed */
@@ -1116,6 +1208,7 @@ en_result_t ETH_CommStructInit(stc_eth_comm_init_t *pstcCommInit)
         pstcCommInit->u32DuplexMode      = ETH_MAC_MODE_FULLDUPLEX;
         pstcCommInit->u32ChecksumMode    = ETH_MAC_CHECKSUM_MODE_HARDWARE;
         pstcCommInit->u32RxMode          = ETH_RX_MODE_POLLING;
+        pstcCommInit->u32PhyInitMode     = ETH_PHY_INIT_MODE_BLOCKING;
     }
 
     return enRet;
@@ -1355,6 +1448,156 @@ en_result_t ETH_PHY_LoopBackCmd(stc_eth_handle_t *pstcEthHandle, en_functional_s
     return enRet;
 }
 
+/**
+ * @brief  Run the PHY link state machine: reset -> link up -> auto-negotiation
+ *         completed -> MAC duplex mode and speed configured.
+ * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @param  [in] u32ElapsedTime              Time(ms) elapsed since the last call, 0 from the PHY interrupt
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Process success
+ *           - ErrorInvalidParameter: pstcEthHandle == NULL
+ *           - ErrorTimeout: PHY register access timeout
+ * @note   Call it periodically (every 10~100ms) and on the PHY link change interrupt,
+ *         the link state is read by ETH_PHY_GetLinkState().
+ */
+en_result_t ETH_PHY_LinkProcess(stc_eth_handle_t *pstcEthHandle, uint32_t u32ElapsedTime)
+{
+    en_result_t enRet = Ok;
+    uint16_t u16PhyReg = 0U;
+    uint32_t u32State;
+
+    if (NULL == pstcEthHandle)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        /* Check parameters */
+        DDL_ASSERT(IS_ETH_PHY_ADDRESS(pstcEthHandle->stcCommInit.u16PHYAddress));
+        DDL_ASSERT(IS_ETH_AUTO_NEGOTIATION(pstcEthHandle->stcCommInit.u16AutoNegotiation));
+
+        u32State = pstcEthHandle->u32PhyLinkState;
+        if (pstcEthHandle->u32PhyLinkTime < (0xFFFFFFFFUL - u32ElapsedTime))
+        {
+            pstcEthHandle->u32PhyLinkTime += u32ElapsedTime;
+        }
+        else
+        {
+            pstcEthHandle->u32PhyLinkTime = 0xFFFFFFFFUL;
+        }
+
+        if (ETH_PHY_LINK_STATE_RESET == u32State)
+        {
+            if (pstcEthHandle->u32PhyLinkTime >= PHY_RESET_DELAY)
+            {
+                if (ETH_AUTO_NEGOTIATION_DISABLE == pstcEthHandle->stcCommInit.u16AutoNegotiation)
+                {
+                    enRet = ETH_PHY_WriteRegister(pstcEthHandle, PHY_BCR,
+                                                  ((uint16_t)(pstcEthHandle->stcCommInit.u32DuplexMode >> 3U) |
+                                                  (uint16_t)(pstcEthHandle->stcCommInit.u32Speed >> 1U)));
+                }
+                if (Ok == enRet)
+                {
+                    u32State = ETH_PHY_LINK_STATE_DOWN;
+                }
+            }
+        }
+        else
+        {
+            enRet = ETH_PHY_ReadRegister(pstcEthHandle, PHY_BSR, &u16PhyReg);
+            if (Ok == enRet)
+            {
+                if (PHY_LINK_STATUS != (u16PhyReg & PHY_LINK_STATUS))
+                {
+                    u32State = ETH_PHY_LINK_STATE_DOWN;
+                }
+                else if (ETH_PHY_LINK_STATE_DOWN == u32State)
+                {
+                    if (ETH_AUTO_NEGOTIATION_DISABLE == pstcEthHandle->stcCommInit.u16AutoNegotiation)
+                    {
+                        ETH_MAC_SetDuplexSpeed(pstcEthHandle->stcCommInit.u32DuplexMode, pstcEthHandle->stcCommInit.u32Speed);
+                        u32State = ETH_PHY_LINK_STATE_UP;
+                    }
+                    else
+                    {
+                        /* Enable Auto-Negotiation */
+                        enRet = ETH_PHY_WriteRegister(pstcEthHandle, PHY_BCR, PHY_AUTONEGOTIATION);
+                        if (Ok == enRet)
+                        {
+                            u32State = ETH_PHY_LINK_STATE_AUTONEGO;
+                        }
+                    }
+                }
+                else if (ETH_PHY_LINK_STATE_AUTONEGO == u32State)
+                {
+                    if (PHY_AUTONEGO_COMPLETE == (u16PhyReg & PHY_AUTONEGO_COMPLETE))
+                    {
+                        /* Configure ETH duplex mode and speed according to the result of automatic negotiation */
+                        if (0U != (u16PhyReg & (uint16_t)(PHY_100BASE_TX_FD | PHY_10BASE_T_FD)))
+                        {
+                            pstcEthHandle->stcCommInit.u32DuplexMode = ETH_MAC_MODE_FULLDUPLEX;
+                        }
+                        else
+                        {
+                            pstcEthHandle->stcCommInit.u32DuplexMode = ETH_MAC_MODE_HALFDUPLEX;
+                        }
+                        if (0U != (u16PhyReg & (uint16_t)(PHY_100BASE_TX_FD | PHY_100BASE_TX_HD)))
+                        {
+                            pstcEthHandle->stcCommInit.u32Speed = ETH_MAC_SPEED_100M;
+                        }
+                        else
+                        {
+                            pstcEthHandle->stcCommInit.u32Speed = ETH_MAC_SPEED_10M;
+                        }
+                        ETH_MAC_SetDuplexSpeed(pstcEthHandle->stcCommInit.u32DuplexMode, pstcEthHandle->stcCommInit.u32Speed);
+                        u32State = ETH_PHY_LINK_STATE_UP;
+                    }
+                    else if (pstcEthHandle->u32PhyLinkTime >= ETH_TIMEOUT_AUTONEGO_COMPLETE)
+                    {
+                        /* Restart Auto-Negotiation */
+                        enRet = ETH_PHY_WriteRegister(pstcEthHandle, PHY_BCR,
+                                                      (PHY_AUTONEGOTIATION | PHY_RESTART_AUTONEGOTIATION));
+                        pstcEthHandle->u32PhyLinkTime = 0UL;
+                    }
+                    else
+                    {
+                        /* Wait for the auto-negotiation */
+                    }
+                }
+                else
+                {
+                    /* Link up */
+                }
+            }
+        }
+
+        if (u32State != pstcEthHandle->u32PhyLinkState)
+        {
+            pstcEthHandle->u32PhyLinkState = u32State;
+            pstcEthHandle->u32PhyLinkTime  = 0UL;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the PHY link state.
+ * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @retval An uint32_t value of @ref ETH_PHY_Link_State
+ */
+uint32_t ETH_PHY_GetLinkState(const stc_eth_handle_t *pstcEthHandle)
+{
+    uint32_t u32State = ETH_PHY_LINK_STATE_DOWN;
+
+    if (NULL != pstcEthHandle)
+    {
+        u32State = pstcEthHandle->u32PhyLinkState;
+    }
+
+    return u32State;
+}
+
 /******************************************************************************/
 /*                             MAC Functions                                  */
 /******************************************************************************/
@@ -1971,117 +2214,178 @@ void ETH_MACADDR_SetFilterMask(uint32_t u32Index, uint32_t u32Mask)
 }
 
 /******************************************************************************/
-/*                        MAC L3L4 Filter Functions                           */
+/*                       MAC Filter Manager Functions                         */
 /******************************************************************************/
 /**
- * @brief  De-Initialize MAC L3L4 Filter.
- * @param  None
- * @retval None
+ * @brief  Get the MAC hash table bit of a destination address.
+ * @param  [in] au8Addr                     Pointer to MAC address buffer(6 bytes).
+ * @retval uint32_t                         Bit index (0 ~ 63), the bits 32 ~ 63 are in the hash table high register
  */
-void ETH_MAC_L3L4FilterDeInit(void)
+uint32_t ETH_MAC_GetAddrHashIndex(const uint8_t au8Addr[])
 {
-    WRITE_REG32(bM4_ETH->MAC_FLTCTLR_b.IPFE, Disable);
-    WRITE_REG32(M4_ETH->MAC_L34CTLR,  0UL);
-    WRITE_REG32(M4_ETH->MAC_L4PORTR,  0UL);
-    WRITE_REG32(M4_ETH->MAC_L3ADDRR0, 0UL);
-    WRITE_REG32(M4_ETH->MAC_L3ADDRR1, 0UL);
-    WRITE_REG32(M4_ETH->MAC_L3ADDRR2, 0UL);
-    WRITE_REG32(M4_ETH->MAC_L3ADDRR3, 0UL);
+    /* Upper 6 bits of the bit-reversed CRC32 of the address */
+    return (ETH_MAC_HashCrc32(au8Addr, (ETH_MAC_ADDRESS_BYTE_LENGTH * 8UL)) >> 26U);
 }
 
 /**
- * @brief  Initialize MAC L3L4 Filter.
- * @param  [in] pstcL3L4FilterInit          Pointer to a @ref stc_eth_l3l4_filter_config_t structure
+ * @brief  Get the VLAN hash table bit of a VLAN tag.
+ * @param  [in] u16VlanTag                  VLAN tag
+ * @param  [in] u32Comparison               Bits of the VLAN tag used by the filter
+ *         This parameter can be one of the following values:
+ *           @arg ETH_MAC_RXVLAN_COMPARISON_16BIT:  16 bits
+ *           @arg ETH_MAC_RXVLAN_COMPARISON_12BIT:  12 bits (VLAN ID)
+ * @retval uint32_t                         Bit index (0 ~ 15)
+ */
+uint32_t ETH_MAC_GetVlanHashIndex(uint16_t u16VlanTag, uint32_t u32Comparison)
+{
+    uint8_t au8Tag[2];
+    uint32_t u32BitLen = 16UL;
+
+    /* Check parameters */
+    DDL_ASSERT(IS_ETH_MAC_RXVLAN_COMPARISON(u32Comparison));
+
+    if (ETH_MAC_RXVLAN_COMPARISON_12BIT == u32Comparison)
+    {
+        u32BitLen = 12UL;
+    }
+    au8Tag[0] = (uint8_t)(u16VlanTag & 0x00FFU);
+    au8Tag[1] = (uint8_t)(u16VlanTag >> 8U);
+
+    /* Upper 4 bits of the bit-reversed CRC32 of the tag */
+    return (ETH_MAC_HashCrc32(au8Tag, u32BitLen) >> 28U);
+}
+
+/**
+ * @brief  Initialize a MAC filter manager and the filters it owns.
+ * @param  [out] pstcFilter                 Pointer to a @ref stc_eth_mac_filter_t structure
+ * @param  [in] u32SlotNum                  Perfect filter slots owned by the manager, from ETH_MAC_ADDRESS1.
+ *                                          This parameter must be a number between Min_Data = 0 and Max_Data = 4
  * @retval An en_result_t enumeration value:
- *           - Ok: MAC L3L4 Filter Initialize success
- *           - ErrorInvalidParameter: pstcL3L4FilterInit == NULL
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcFilter == NULL
+ * @note   The multicast frames are filtered by the perfect filter and the hash table,
+ *         the VLAN tag filter is enabled while a VLAN tag is subscribed.
  */
-en_result_t ETH_MAC_L3L4FilterInit(const stc_eth_l3l4_filter_config_t *pstcL3L4FilterInit)
+en_result_t ETH_MAC_FilterInit(stc_eth_mac_filter_t *pstcFilter, uint32_t u32SlotNum)
 {
+    uint32_t i;
     en_result_t enRet = Ok;
 
-    if (NULL == pstcL3L4FilterInit)
+    if (NULL == pstcFilter)
     {
         enRet = ErrorInvalidParameter;
     }
     else
     {
         /* Check parameters */
-        DDL_ASSERT(IS_ETH_MAC_L4_DESTPORT_FILTER(pstcL3L4FilterInit->u32L4DestPortFilter));
-        DDL_ASSERT(IS_ETH_MAC_L4_SOURCEPORT_FILTER(pstcL3L4FilterInit->u32L4SourcePortFilter));
-        DDL_ASSERT(IS_ETH_MAC_L4_PORT_FILTER_PROTOCOL(pstcL3L4FilterInit->u32L4PortFilterProtocol));
-        DDL_ASSERT(IS_ETH_MAC_L3_DA_FILTER_MASK(pstcL3L4FilterInit->u32L3Ipv4DAFilterMask));
-        DDL_ASSERT(IS_ETH_MAC_L3_SA_FILTER_MASK(pstcL3L4FilterInit->u32L3Ipv4SAFilterMask));
-        DDL_ASSERT(IS_ETH_MAC_L3_DA_SA_FILTER_MASK(pstcL3L4FilterInit->u32L3Ipv6AddrFilterMask));
-        DDL_ASSERT(IS_ETH_MAC_L3_DA_FILTER(pstcL3L4FilterInit->u32L3DAFilter));
-        DDL_ASSERT(IS_ETH_MAC_L3_SA_FILTER(pstcL3L4FilterInit->u32L3SAFilter));
-        DDL_ASSERT(IS_ETH_MAC_L3_ADDR_FILTER_PROTOCOL(pstcL3L4FilterInit->u32L3AddrFilterProtocol));
+        DDL_ASSERT(IS_ETH_MAC_FILTER_SLOT_NUM(u32SlotNum));
 
-        /* Set L3/L4 control register */
-        if (ETH_MAC_L3_ADDR_FILTER_PROTOCOL_IPV4 != pstcL3L4FilterInit->u32L3AddrFilterProtocol)
-        {
-            WRITE_REG32(M4_ETH->MAC_L34CTLR,
-                        (pstcL3L4FilterInit->u32L4DestPortFilter     | pstcL3L4FilterInit->u32L4SourcePortFilter   |
-                         pstcL3L4FilterInit->u32L4PortFilterProtocol | pstcL3L4FilterInit->u32L3Ipv6AddrFilterMask |
-                         pstcL3L4FilterInit->u32L3DAFilter           | pstcL3L4FilterInit->u32L3SAFilter           |
-                         pstcL3L4FilterInit->u32L3AddrFilterProtocol));
-            WRITE_REG32(M4_ETH->MAC_L3ADDRR0, pstcL3L4FilterInit->au32L3Ipv6AddrFilterValue[0]);
-            WRITE_REG32(M4_ETH->MAC_L3ADDRR1, pstcL3L4FilterInit->au32L3Ipv6AddrFilterValue[1]);
-            WRITE_REG32(M4_ETH->MAC_L3ADDRR2, pstcL3L4FilterInit->au32L3Ipv6AddrFilterValue[2]);
-            WRITE_REG32(M4_ETH->MAC_L3ADDRR3, pstcL3L4FilterInit->au32L3Ipv6AddrFilterValue[3]);
-        }
-        /* IPv4 protocol*/
-        else
+        (void)memset(pstcFilter, 0, sizeof(stc_eth_mac_filter_t));
+        pstcFilter->u32SlotNum = u32SlotNum;
+        for (i=1UL; i<=u32SlotNum; i++)
         {
-            WRITE_REG32(M4_ETH->MAC_L34CTLR,
-                        (pstcL3L4FilterInit->u32L4DestPortFilter     | pstcL3L4FilterInit->u32L4SourcePortFilter |
-                         pstcL3L4FilterInit->u32L4PortFilterProtocol | pstcL3L4FilterInit->u32L3Ipv4DAFilterMask |
-                         pstcL3L4FilterInit->u32L3Ipv4SAFilterMask   | pstcL3L4FilterInit->u32L3DAFilter         |
-                         pstcL3L4FilterInit->u32L3SAFilter           | pstcL3L4FilterInit->u32L3AddrFilterProtocol));
-            WRITE_REG32(M4_ETH->MAC_L3ADDRR0, pstcL3L4FilterInit->u32L3Ipv4SAFilterValue);
-            WRITE_REG32(M4_ETH->MAC_L3ADDRR1, pstcL3L4FilterInit->u32L3Ipv4DAFilterValue);
+            ETH_MACADDR_SetFilterMode(ETH_MAC_FILTER_SLOT_INDEX(i), ETH_MAC_ADDRESS_FILTER_DISABLE);
         }
-        WRITE_REG32(M4_ETH->MAC_L4PORTR, ((((uint32_t)pstcL3L4FilterInit->u16L4DestProtFilterValue) << ETH_MAC_L4PORTR_L4DPVAL_POS) |
-                    pstcL3L4FilterInit->u16L4SourceProtFilterValue));
+        ETH_MAC_SetHashTable(0UL, 0UL);
+        MODIFY_REG32(M4_ETH->MAC_FLTCTLR, (ETH_MAC_FLTCTLR_PMF | ETH_MAC_FLTCTLR_HMC | ETH_MAC_FLTCTLR_HPF | ETH_MAC_FLTCTLR_VTFE),
+                     ETH_MAC_MULTICASTFRAME_FILTER_PERFECTHASHTABLE);
+        ETH_MAC_SetRxVlanHashTable(0U);
+        CLEAR_REG32_BIT(M4_ETH->MAC_VTAFLTR, ETH_MAC_VTAFLTR_VTHM);
     }
 
     return enRet;
 }
 
 /**
- * @brief  Set the fields of structure stc_eth_l3l4_filter_config_t to default values.
- * @param  [out] pstcL3L4FilterInit         Pointer to a @ref stc_eth_l3l4_filter_config_t structure
+ * @brief  Subscribe a multicast address.
+ * @param  [in] pstcFilter                  Pointer to a @ref stc_eth_mac_filter_t structure
+ * @param  [in] au8Addr                     Pointer to MAC address buffer(6 bytes).
  * @retval An en_result_t enumeration value:
- *           - Ok: Structure Initialize success
- *           - ErrorInvalidParameter: pstcL3L4FilterInit == NULL
+ *           - Ok: Subscribe success
+ *           - ErrorInvalidParameter: pstcFilter == NULL or au8Addr == NULL or not a multicast address
+ *           - ErrorBufferFull: No free entry
+ * @note   The first addresses take the free perfect filter slots, the other ones the hash table.
  */
-en_result_t ETH_MAC_L3L4FilterStructInit(stc_eth_l3l4_filter_config_t *pstcL3L4FilterInit)
+en_result_t ETH_MAC_FilterAddAddr(stc_eth_mac_filter_t *pstcFilter, const uint8_t au8Addr[])
 {
+    uint32_t i;
+    uint32_t u32Entry = ARRAY_SZ(pstcFilter->au16AddrRefCnt);
+    uint32_t u32Free = ARRAY_SZ(pstcFilter->au16AddrRefCnt);
+    uint32_t u32Slot;
     en_result_t enRet = Ok;
-    uint8_t i;
 
-    if (NULL == pstcL3L4FilterInit)
+    if ((NULL == pstcFilter) || (NULL == au8Addr) || (0U == (au8Addr[0] & 0x01U)))
     {
         enRet = ErrorInvalidParameter;
     }
     else
     {
-        pstcL3L4FilterInit->u32L4DestPortFilter        = ETH_MAC_L4_DESTPORT_FILTER_DISABLE;
-        pstcL3L4FilterInit->u32L4SourcePortFilter      = ETH_MAC_L4_SOURCEPORT_FILTER_DISABLE;
-        pstcL3L4FilterInit->u32L4PortFilterProtocol    = ETH_MAC_L4_PORT_FILTER_PROTOCOL_TCP;
-        pstcL3L4FilterInit->u32L3Ipv4DAFilterMask      = ETH_MAC_L3_DA_FILTER_MASK_NONE;
-        pstcL3L4FilterInit->u32L3Ipv4SAFilterMask      = ETH_MAC_L3_SA_FILTER_MASK_NONE;
-        pstcL3L4FilterInit->u32L3Ipv6AddrFilterMask    = ETH_MAC_L3_DA_SA_FILTER_MASK_NONE;
-        pstcL3L4FilterInit->u32L3DAFilter              = ETH_MAC_L3_DA_FILTER_DISABLE;
-        pstcL3L4FilterInit->u32L3SAFilter              = ETH_MAC_L3_SA_FILTER_DISABLE;
-        pstcL3L4FilterInit->u32L3AddrFilterProtocol    = ETH_MAC_L3_ADDR_FILTER_PROTOCOL_IPV4;
-        pstcL3L4FilterInit->u16L4DestProtFilterValue   = 0U;
-        pstcL3L4FilterInit->u16L4SourceProtFilterValue = 0U;
-        pstcL3L4FilterInit->u32L3Ipv4DAFilterValue     = 0UL;
-        pstcL3L4FilterInit->u32L3Ipv4SAFilterValue     = 0UL;
-        for (i=0U; i<4U; i++)
+        for (i=0UL; i<ARRAY_SZ(pstcFilter->au16AddrRefCnt); i++)
         {
-            pstcL3L4FilterInit->au32L3Ipv6AddrFilterValue[i] = 0UL;
+            if (0U == pstcFilter->au16AddrRefCnt[i])
+            {
+                if (u32Free == ARRAY_SZ(pstcFilter->au16AddrRefCnt))
+                {
+                    u32Free = i;
+                }
+            }
+            else if (0 == memcmp(pstcFilter->aau8Addr[i], au8Addr, ETH_MAC_ADDRESS_BYTE_LENGTH))
+            {
+                u32Entry = i;
+                break;
+            }
+            else
+            {
+                /* Other address */
+            }
+        }
+
+        if (u32Entry != ARRAY_SZ(pstcFilter->au16AddrRefCnt))
+        {
+            if (0xFFFFU == pstcFilter->au16AddrRefCnt[u32Entry])
+            {
+                enRet = ErrorBufferFull;
+            }
+            else
+            {
+                pstcFilter->au16AddrRefCnt[u32Entry]++;
+            }
+        }
+        else if (u32Free == ARRAY_SZ(pstcFilter->au16AddrRefCnt))
+        {
+            enRet = ErrorBufferFull;
+        }
+        else
+        {
+            (void)memcpy(pstcFilter->aau8Addr[u32Free], au8Addr, ETH_MAC_ADDRESS_BYTE_LENGTH);
+            pstcFilter->au16AddrRefCnt[u32Free] = 1U;
+            pstcFilter->au8AddrSlot[u32Free]    = 0U;
+            for (u32Slot=1UL; u32Slot<=pstcFilter->u32SlotNum; u32Slot++)
+            {
+                if (0UL == (pstcFilter->u32SlotUsed & (1UL << u32Slot)))
+                {
+                    break;
+                }
+            }
+
+            if (u32Slot <= pstcFilter->u32SlotNum)
+            {
+                /* Perfect filter */
+                pstcFilter->u32SlotUsed |= (1UL << u32Slot);
+                pstcFilter->au8AddrSlot[u32Free] = (uint8_t)u32Slot;
+                (void)ETH_MACADDR_SetAddress(ETH_MAC_FILTER_SLOT_INDEX(u32Slot), pstcFilter->aau8Addr[u32Free]);
+                ETH_MACADDR_SetFilterMode(ETH_MAC_FILTER_SLOT_INDEX(u32Slot), ETH_MAC_ADDRESS_FILTER_PERFECT_DA);
+            }
+            else
+            {
+                /* Hash table */
+                i = ETH_MAC_GetAddrHashIndex(au8Addr);
+                if (0U == pstcFilter->au8HashCnt[i])
+                {
+                    ETH_MAC_FilterHashCmd(i, Enable);
+                }
+                pstcFilter->au8HashCnt[i]++;
+            }
         }
     }
 
@@ -2089,552 +2393,1837 @@ en_result_t ETH_MAC_L3L4FilterStructInit(stc_eth_l3l4_filter_config_t *pstcL3L4F
 }
 
 /**
- * @brief  Enable or disable MAC L3L4 Filter function.
- * @param  [in] enNewSta                    The function new state.
- *           @arg This parameter can be: Enable or Disable.
- * @retval None
+ * @brief  Unsubscribe a multicast address.
+ * @param  [in] pstcFilter                  Pointer to a @ref stc_eth_mac_filter_t structure
+ * @param  [in] au8Addr                     Pointer to MAC address buffer(6 bytes).
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Unsubscribe success
+ *           - ErrorInvalidParameter: pstcFilter == NULL or au8Addr == NULL or the address is not subscribed
+ * @note   A freed perfect filter slot is handed over to an address of the hash table.
  */
-void ETH_MAC_L3L4FilterCmd(en_functional_state_t enNewSta)
+en_result_t ETH_MAC_FilterDelAddr(stc_eth_mac_filter_t *pstcFilter, const uint8_t au8Addr[])
 {
-    /* Check parameters */
-    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewSta));
-
-    WRITE_REG32(bM4_ETH->MAC_FLTCTLR_b.IPFE, enNewSta);
-}
+    uint32_t i;
+    uint32_t u32Entry;
+    uint32_t u32Slot;
+    uint32_t u32Index;
+    en_result_t enRet = Ok;
 
-/**
- * @brief  Set L4 port filter protocol.
- * @param  [in] u32PortProtocol             MAC L4 port filter protocol.
- *         This parameter can be one of the following values:
- *           @arg ETH_MAC_L4_PORT_FILTER_PROTOCOL_TCP:  Port filter for TCP frame
- *           @arg ETH_MAC_L4_PORT_FILTER_PROTOCOL_UDP:  Port filter for UDP frame
- * @retval None
- */
-void ETH_MAC_SetPortFilterProtocol(uint32_t u32PortProtocol)
-{
-    /* Check parameters */
-    DDL_ASSERT(IS_ETH_MAC_L4_PORT_FILTER_PROTOCOL(u32PortProtocol));
+    if ((NULL == pstcFilter) || (NULL == au8Addr))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        for (u32Entry=0UL; u32Entry<ARRAY_SZ(pstcFilter->au16AddrRefCnt); u32Entry++)
+        {
+            if ((0U != pstcFilter->au16AddrRefCnt[u32Entry]) &&
+                (0 == memcmp(pstcFilter->aau8Addr[u32Entry], au8Addr, ETH_MAC_ADDRESS_BYTE_LENGTH)))
+            {
+                break;
+            }
+        }
 
-    WRITE_REG32(bM4_ETH->MAC_L34CTLR_b.L4PEN, (u32PortProtocol >> ETH_MAC_L34CTLR_L4PEN_POS));
-}
+        if (u32Entry == ARRAY_SZ(pstcFilter->au16AddrRefCnt))
+        {
+            enRet = ErrorInvalidParameter;
+        }
+        else
+        {
+            pstcFilter->au16AddrRefCnt[u32Entry]--;
+            if (0U == pstcFilter->au16AddrRefCnt[u32Entry])
+            {
+                u32Slot = pstcFilter->au8AddrSlot[u32Entry];
+                if (0UL != u32Slot)
+                {
+                    pstcFilter->au8AddrSlot[u32Entry] = 0U;
+                    /* Move an address of the hash table to the perfect filter */
+                    for (i=0UL; i<ARRAY_SZ(pstcFilter->au16AddrRefCnt); i++)
+                    {
+                        if ((0U != pstcFilter->au16AddrRefCnt[i]) && (0U == pstcFilter->au8AddrSlot[i]))
+                        {
+                            break;
+                        }
+                    }
 
-/**
- * @brief  Set L4 Destination port filter value.
- * @param  [in] u16Port                     The value of Destination port.
- * @retval None
- */
-void ETH_MAC_SetDestPortFilterVal(uint16_t u16Port)
-{
-    MODIFY_REG32(M4_ETH->MAC_L4PORTR, ETH_MAC_L4PORTR_L4DPVAL, ((uint32_t)u16Port << 16U));
-}
+                    if (i < ARRAY_SZ(pstcFilter->au16AddrRefCnt))
+                    {
+                        pstcFilter->au8AddrSlot[i] = (uint8_t)u32Slot;
+                        (void)ETH_MACADDR_SetAddress(ETH_MAC_FILTER_SLOT_INDEX(u32Slot), pstcFilter->aau8Addr[i]);
+                        u32Index = ETH_MAC_GetAddrHashIndex(pstcFilter->aau8Addr[i]);
+                        pstcFilter->au8HashCnt[u32Index]--;
+                        if (0U == pstcFilter->au8HashCnt[u32Index])
+                        {
+                            ETH_MAC_FilterHashCmd(u32Index, Disable);
+                        }
+                    }
+                    else
+                    {
+                        ETH_MACADDR_SetFilterMode(ETH_MAC_FILTER_SLOT_INDEX(u32Slot), ETH_MAC_ADDRESS_FILTER_DISABLE);
+                        pstcFilter->u32SlotUsed &= ~(1UL << u32Slot);
+                    }
+                }
+                else
+                {
+                    u32Index = ETH_MAC_GetAddrHashIndex(au8Addr);
+                    pstcFilter->au8HashCnt[u32Index]--;
+                    if (0U == pstcFilter->au8HashCnt[u32Index])
+                    {
+                        ETH_MAC_FilterHashCmd(u32Index, Disable);
+                    }
+                }
+            }
+        }
+    }
 
-/**
- * @brief  Set L4 Source port filter value.
- * @param  [in] u16Port                     The value of Source port.
- * @retval None
- */
-void ETH_MAC_SetSrcPortFilterVal(uint16_t u16Port)
-{
-    MODIFY_REG32(M4_ETH->MAC_L4PORTR, ETH_MAC_L4PORTR_L4SPVAL, u16Port);
+    return enRet;
 }
 
 /**
- * @brief  Set L3 address filter protocol.
- * @param  [in] u32AddrProtocol             MAC L3 address filter protocol.
- *         This parameter can be one of the following values:
- *           @arg ETH_MAC_L3_ADDR_FILTER_PROTOCOL_IPV4: Ip Address filter for IPv4
- *           @arg ETH_MAC_L3_ADDR_FILTER_PROTOCOL_IPV6: Ip Address filter for IPv6
- * @retval None
+ * @brief  Subscribe a VLAN tag.
+ * @param  [in] pstcFilter                  Pointer to a @ref stc_eth_mac_filter_t structure
+ * @param  [in] u16VlanTag                  VLAN tag
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Subscribe success
+ *           - ErrorInvalidParameter: pstcFilter == NULL
+ *           - ErrorBufferFull: No free entry
+ * @note   The tag bits compared are set by ETH_MAC_SetRxVlanComparison(), it must not change
+ *         while VLAN tags are subscribed.
  */
-void ETH_MAC_SetAddrFilterProtocol(uint32_t u32AddrProtocol)
+en_result_t ETH_MAC_FilterAddVlan(stc_eth_mac_filter_t *pstcFilter, uint16_t u16VlanTag)
 {
-    /* Check parameters */
-    DDL_ASSERT(IS_ETH_MAC_L3_ADDR_FILTER_PROTOCOL(u32AddrProtocol));
+    uint32_t i;
+    uint32_t u32Entry = ARRAY_SZ(pstcFilter->au16VlanRefCnt);
+    uint32_t u32Free = ARRAY_SZ(pstcFilter->au16VlanRefCnt);
+    uint32_t u32Index;
+    en_result_t enRet = Ok;
 
-    WRITE_REG32(bM4_ETH->MAC_L34CTLR_b.L3PEN, u32AddrProtocol);
-}
+    if (NULL == pstcFilter)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        for (i=0UL; i<ARRAY_SZ(pstcFilter->au16VlanRefCnt); i++)
+        {
+            if (0U == pstcFilter->au16VlanRefCnt[i])
+            {
+                if (u32Free == ARRAY_SZ(pstcFilter->au16VlanRefCnt))
+                {
+                    u32Free = i;
+                }
+            }
+            else if (u16VlanTag == pstcFilter->au16Vlan[i])
+            {
+                u32Entry = i;
+                break;
+            }
+            else
+            {
+                /* Other VLAN tag */
+            }
+        }
 
-/**
- * @brief  Set L3 Destination address filter value of IPv4.
- * @param  [in] u32Addr                     The value of Destination address.
- * @retval None
- */
-void ETH_MAC_SetIpv4DestAddrFilterVal(uint32_t u32Addr)
-{
-    WRITE_REG32(M4_ETH->MAC_L3ADDRR1, u32Addr);
-}
+        if (u32Entry != ARRAY_SZ(pstcFilter->au16VlanRefCnt))
+        {
+            if (0xFFFFU == pstcFilter->au16VlanRefCnt[u32Entry])
+            {
+                enRet = ErrorBufferFull;
+            }
+            else
+            {
+                pstcFilter->au16VlanRefCnt[u32Entry]++;
+            }
+        }
+        else if (u32Free == ARRAY_SZ(pstcFilter->au16VlanRefCnt))
+        {
+            enRet = ErrorBufferFull;
+        }
+        else
+        {
+            pstcFilter->au16Vlan[u32Free]       = u16VlanTag;
+            pstcFilter->au16VlanRefCnt[u32Free] = 1U;
+            u32Index = ETH_MAC_GetVlanHashIndex(u16VlanTag, READ_REG32_BIT(M4_ETH->MAC_VTAFLTR, ETH_MAC_VTAFLTR_VTAL));
+            if (0U == pstcFilter->au8VlanHashCnt[u32Index])
+            {
+                ETH_MAC_FilterVlanHashCmd(u32Index, Enable);
+            }
+            pstcFilter->au8VlanHashCnt[u32Index]++;
+            pstcFilter->u32VlanCnt++;
+            if (1UL == pstcFilter->u32VlanCnt)
+            {
+                /* The tag register keeps a subscribed tag, the others pass by the hash table */
+                MODIFY_REG32(M4_ETH->MAC_VTAFLTR, (ETH_MAC_VTAFLTR_VTHM | ETH_MAC_VTAFLTR_VLFLT),
+                             (ETH_MAC_VTAFLTR_VTHM | (uint32_t)u16VlanTag));
+                SET_REG32_BIT(M4_ETH->MAC_FLTCTLR, ETH_MAC_FLTCTLR_VTFE);
+            }
+        }
+    }
 
-/**
- * @brief  Set L3 Source address filter value of IPv4.
- * @param  [in] u32Addr                     The value of Source address.
- * @retval None
- */
-void ETH_MAC_SetIpv4SrcAddrFilterVal(uint32_t u32Addr)
-{
-    WRITE_REG32(M4_ETH->MAC_L3ADDRR0, u32Addr);
+    return enRet;
 }
 
 /**
- * @brief  Set L3 Destination/Source Address filter value of IPv6.
- * @param  [in] au32Addr                    Pointer to Destination/Source Address buffer(4 words).
+ * @brief  Unsubscribe a VLAN tag.
+ * @param  [in] pstcFilter                  Pointer to a @ref stc_eth_mac_filter_t structure
+ * @param  [in] u16VlanTag                  VLAN tag
  * @retval An en_result_t enumeration value:
- *           - Ok: Set Address filter value success
- *           - ErrorInvalidParameter: au32Addr == NULL
+ *           - Ok: Unsubscribe success
+ *           - ErrorInvalidParameter: pstcFilter == NULL or the VLAN tag is not subscribed
+ * @note   The VLAN tag filter is disabled with the last VLAN tag.
  */
-en_result_t ETH_MAC_SetIpv6AddrFilterVal(const uint32_t au32Addr[])
+en_result_t ETH_MAC_FilterDelVlan(stc_eth_mac_filter_t *pstcFilter, uint16_t u16VlanTag)
 {
+    uint32_t i;
+    uint32_t u32Entry;
+    uint32_t u32Index;
     en_result_t enRet = Ok;
 
-    if (NULL == au32Addr)
+    if (NULL == pstcFilter)
     {
         enRet = ErrorInvalidParameter;
     }
     else
     {
-        WRITE_REG32(M4_ETH->MAC_L3ADDRR0, au32Addr[0]);
-        WRITE_REG32(M4_ETH->MAC_L3ADDRR1, au32Addr[1]);
-        WRITE_REG32(M4_ETH->MAC_L3ADDRR2, au32Addr[2]);
-        WRITE_REG32(M4_ETH->MAC_L3ADDRR3, au32Addr[3]);
+        for (u32Entry=0UL; u32Entry<ARRAY_SZ(pstcFilter->au16VlanRefCnt); u32Entry++)
+        {
+            if ((0U != pstcFilter->au16VlanRefCnt[u32Entry]) && (u16VlanTag == pstcFilter->au16Vlan[u32Entry]))
+            {
+                break;
+            }
+        }
+
+        if (u32Entry == ARRAY_SZ(pstcFilter->au16VlanRefCnt))
+        {
+            enRet = ErrorInvalidParameter;
+        }
+        else
+        {
+            pstcFilter->au16VlanRefCnt[u32Entry]--;
+            if (0U == pstcFilter->au16VlanRefCnt[u32Entry])
+            {
+                u32Index = ETH_MAC_GetVlanHashIndex(u16VlanTag, READ_REG32_BIT(M4_ETH->MAC_VTAFLTR, ETH_MAC_VTAFLTR_VTAL));
+                pstcFilter->au8VlanHashCnt[u32Index]--;
+                if (0U == pstcFilter->au8VlanHashCnt[u32Index])
+                {
+                    ETH_MAC_FilterVlanHashCmd(u32Index, Disable);
+                }
+                pstcFilter->u32VlanCnt--;
+                if (0UL == pstcFilter->u32VlanCnt)
+                {
+                    CLEAR_REG32_BIT(M4_ETH->MAC_FLTCTLR, ETH_MAC_FLTCTLR_VTFE);
+                    CLEAR_REG32_BIT(M4_ETH->MAC_VTAFLTR, (ETH_MAC_VTAFLTR_VTHM | ETH_MAC_VTAFLTR_VLFLT));
+                }
+                else if (u16VlanTag == READ_REG32_BIT(M4_ETH->MAC_VTAFLTR, ETH_MAC_VTAFLTR_VLFLT))
+                {
+                    for (i=0UL; i<ARRAY_SZ(pstcFilter->au16VlanRefCnt); i++)
+                    {
+                        if (0U != pstcFilter->au16VlanRefCnt[i])
+                        {
+                            ETH_MAC_SetRxVlanTagVal(pstcFilter->au16Vlan[i]);
+                            break;
+                        }
+                    }
+                }
+                else
+                {
+                    /* The tag register keeps another VLAN tag */
+                }
+            }
+        }
     }
 
     return enRet;
 }
 
 /******************************************************************************/
-/*                              DMA Functions                                 */
+/*                        MAC L3L4 Filter Functions                           */
 /******************************************************************************/
 /**
- * @brief  De-Initialize DMA.
+ * @brief  De-Initialize MAC L3L4 Filter.
  * @param  None
  * @retval None
  */
-void ETH_DMA_DeInit(void)
+void ETH_MAC_L3L4FilterDeInit(void)
 {
-    WRITE_REG32(M4_ETH->DMA_BUSMODR, 0x00020101UL);
-    WRITE_REG32(M4_ETH->DMA_OPRMODR, 0U);
-    WRITE_REG32(M4_ETH->DMA_INTENAR, 0U);
-    WRITE_REG32(M4_ETH->DMA_REVWDTR, 0U);
-    WRITE_REG32(M4_ETH->DMA_TXDLADR, 0U);
-    WRITE_REG32(M4_ETH->DMA_RXDLADR, 0U);
+    WRITE_REG32(bM4_ETH->MAC_FLTCTLR_b.IPFE, Disable);
+    WRITE_REG32(M4_ETH->MAC_L34CTLR,  0UL);
+    WRITE_REG32(M4_ETH->MAC_L4PORTR,  0UL);
+    WRITE_REG32(M4_ETH->MAC_L3ADDRR0, 0UL);
+    WRITE_REG32(M4_ETH->MAC_L3ADDRR1, 0UL);
+    WRITE_REG32(M4_ETH->MAC_L3ADDRR2, 0UL);
+    WRITE_REG32(M4_ETH->MAC_L3ADDRR3, 0UL);
 }
 
 /**
- * @brief  Initialize DMA.
- * @param  [in] pstcDmaInit                 Pointer to a @ref stc_eth_dma_init_t structure
+ * @brief  Initialize MAC L3L4 Filter.
+ * @param  [in] pstcL3L4FilterInit          Pointer to a @ref stc_eth_l3l4_filter_config_t structure
  * @retval An en_result_t enumeration value:
- *           - Ok: DMA Initialize success
- *           - ErrorInvalidParameter: pstcDmaInit == NULL
+ *           - Ok: MAC L3L4 Filter Initialize success
+ *           - ErrorInvalidParameter: pstcL3L4FilterInit == NULL
  */
-en_result_t ETH_DMA_Init(const stc_eth_dma_init_t *pstcDmaInit)
+en_result_t ETH_MAC_L3L4FilterInit(const stc_eth_l3l4_filter_config_t *pstcL3L4FilterInit)
 {
     en_result_t enRet = Ok;
 
-    if (NULL == pstcDmaInit)
+    if (NULL == pstcL3L4FilterInit)
     {
         enRet = ErrorInvalidParameter;
     }
     else
     {
         /* Check parameters */
-        DDL_ASSERT(IS_ETH_DMA_BURST_MODE(pstcDmaInit->u32BurstMode));
-        DDL_ASSERT(IS_ETH_DMA_ADDRESS_ALIGN(pstcDmaInit->u32AddressAlign));
-        DDL_ASSERT(IS_ETH_DMA_RX_BURST_LENGTH(pstcDmaInit->u32RxDMABurstLength));
-        DDL_ASSERT(IS_ETH_DMA_TX_BURST_LENGTH(pstcDmaInit->u32TxDMABurstLength));
-        DDL_ASSERT(IS_ETH_DMA_ENHANCE_DESCRIPTOR(pstcDmaInit->u32EnhanceDescriptor));
-        DDL_ASSERT(IS_ETH_DMA_DESC_SKIP_LENGTH(pstcDmaInit->u32DescriptorSkipLength));
-        DDL_ASSERT(IS_ETH_DMA_PRIORITY_ARBITRATION(pstcDmaInit->u32DMAArbitration));
-        DDL_ASSERT(IS_ETH_DMA_DROP_CHECKSUM_ERRORFRAME(pstcDmaInit->u32DropChecksumErrorFrame));
-        DDL_ASSERT(IS_ETH_DMA_RECEIVE_STORE_FORWARD(pstcDmaInit->u32ReceiveStoreForward));
-        DDL_ASSERT(IS_ETH_DMA_FLUSH_RECEIVEDFRAME(pstcDmaInit->u32FlushReceiveFrame));
-        DDL_ASSERT(IS_ETH_DMA_TRANSMIT_STORE_FORWARD(pstcDmaInit->u32TransmitStoreForward));
-        DDL_ASSERT(IS_ETH_DMA_TRANSMIT_THRESHOLD(pstcDmaInit->u32TransmitThreshold));
-        DDL_ASSERT(IS_ETH_DMA_FORWARD_ERRORFRAME(pstcDmaInit->u32ForwardErrorFrame));
-        DDL_ASSERT(IS_ETH_DMA_FORWARD_UNDERSIZE_GOODFRAME(pstcDmaInit->u32ForwardUndersizeGoodFrame));
-        DDL_ASSERT(IS_ETH_DMA_DROP_JUMBO_FRAME(pstcDmaInit->u32DropJumboFrame));
-        DDL_ASSERT(IS_ETH_DMA_RECEIVE_THRESHOLD(pstcDmaInit->u32ReceiveThreshold));
-        DDL_ASSERT(IS_ETH_DMA_SECONDFRAME_OPERARTE(pstcDmaInit->u32SecondFrameOperate));
+        DDL_ASSERT(IS_ETH_MAC_L4_DESTPORT_FILTER(pstcL3L4FilterInit->u32L4DestPortFilter));
+        DDL_ASSERT(IS_ETH_MAC_L4_SOURCEPORT_FILTER(pstcL3L4FilterInit->u32L4SourcePortFilter));
+        DDL_ASSERT(IS_ETH_MAC_L4_PORT_FILTER_PROTOCOL(pstcL3L4FilterInit->u32L4PortFilterProtocol));
+        DDL_ASSERT(IS_ETH_MAC_L3_DA_FILTER_MASK(pstcL3L4FilterInit->u32L3Ipv4DAFilterMask));
+        DDL_ASSERT(IS_ETH_MAC_L3_SA_FILTER_MASK(pstcL3L4FilterInit->u32L3Ipv4SAFilterMask));
+        DDL_ASSERT(IS_ETH_MAC_L3_DA_SA_FILTER_MASK(pstcL3L4FilterInit->u32L3Ipv6AddrFilterMask));
+        DDL_ASSERT(IS_ETH_MAC_L3_DA_FILTER(pstcL3L4FilterInit->u32L3DAFilter));
+        DDL_ASSERT(IS_ETH_MAC_L3_SA_FILTER(pstcL3L4FilterInit->u32L3SAFilter));
+        DDL_ASSERT(IS_ETH_MAC_L3_ADDR_FILTER_PROTOCOL(pstcL3L4FilterInit->u32L3AddrFilterProtocol));
+
+        /* Set L3/L4 control register */
+        if (ETH_MAC_L3_ADDR_FILTER_PROTOCOL_IPV4 != pstcL3L4FilterInit->u32L3AddrFilterProtocol)
+        {
+            WRITE_REG32(M4_ETH->MAC_L34CTLR,
+                        (pstcL3L4FilterInit->u32L4DestPortFilter     | pstcL3L4FilterInit->u32L4SourcePortFilter   |
+                         pstcL3L4FilterInit->u32L4PortFilterProtocol | pstcL3L4FilterInit->u32L3Ipv6AddrFilterMask |
+                         pstcL3L4FilterInit->u32L3DAFilter           | pstcL3L4FilterInit->u32L3SAFilter           |
+                         pstcL3L4FilterInit->u32L3AddrFilterProtocol));
+            WRITE_REG32(M4_ETH->MAC_L3ADDRR0, pstcL3L4FilterInit->au32L3Ipv6AddrFilterValue[0]);
+            WRITE_REG32(M4_ETH->MAC_L3ADDRR1, pstcL3L4FilterInit->au32L3Ipv6AddrFilterValue[1]);
+            WRITE_REG32(M4_ETH->MAC_L3ADDRR2, pstcL3L4FilterInit->au32L3Ipv6AddrFilterValue[2]);
+            WRITE_REG32(M4_ETH->MAC_L3ADDRR3, pstcL3L4FilterInit->au32L3Ipv6AddrFilterValue[3]);
+        }
+        /* IPv4 protocol*/
+        else
+        {
+            WRITE_REG32(M4_ETH->MAC_L34CTLR,
+                        (pstcL3L4FilterInit->u32L4DestPortFilter     | pstcL3L4FilterInit->u32L4SourcePortFilter |
+                         pstcL3L4FilterInit->u32L4PortFilterProtocol | pstcL3L4FilterInit->u32L3Ipv4DAFilterMask |
+                         pstcL3L4FilterInit->u32L3Ipv4SAFilterMask   | pstcL3L4FilterInit->u32L3DAFilter         |
+                         pstcL3L4FilterInit->u32L3SAFilter           | pstcL3L4FilterInit->u32L3AddrFilterProtocol));
+            WRITE_REG32(M4_ETH->MAC_L3ADDRR0, pstcL3L4FilterInit->u32L3Ipv4SAFilterValue);
+            WRITE_REG32(M4_ETH->MAC_L3ADDRR1, pstcL3L4FilterInit->u32L3Ipv4DAFilterValue);
+        }
+        WRITE_REG32(M4_ETH->MAC_L4PORTR, ((((uint32_t)pstcL3L4FilterInit->u16L4DestProtFilterValue) << ETH_MAC_L4PORTR_L4DPVAL_POS) |
+                    pstcL3L4FilterInit->u16L4SourceProtFilterValue));
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set the fields of structure stc_eth_l3l4_filter_config_t to default values.
+ * @param  [out] pstcL3L4FilterInit         Pointer to a @ref stc_eth_l3l4_filter_config_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Structure Initialize success
+ *           - ErrorInvalidParameter: pstcL3L4FilterInit == NULL
+ */
+en_result_t ETH_MAC_L3L4FilterStructInit(stc_eth_l3l4_filter_config_t *pstcL3L4FilterInit)
+{
+    en_result_t enRet = Ok;
+    uint8_t i;
+
+    if (NULL == pstcL3L4FilterInit)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        pstcL3L4FilterInit->u32L4DestPortFilter        = ETH_MAC_L4_DESTPORT_FILTER_DISABLE;
+        pstcL3L4FilterInit->u32L4SourcePortFilter      = ETH_MAC_L4_SOURCEPORT_FILTER_DISABLE;
+        pstcL3L4FilterInit->u32L4PortFilterProtocol    = ETH_MAC_L4_PORT_FILTER_PROTOCOL_TCP;
+        pstcL3L4FilterInit->u32L3Ipv4DAFilterMask      = ETH_MAC_L3_DA_FILTER_MASK_NONE;
+        pstcL3L4FilterInit->u32L3Ipv4SAFilterMask      = ETH_MAC_L3_SA_FILTER_MASK_NONE;
+        pstcL3L4FilterInit->u32L3Ipv6AddrFilterMask    = ETH_MAC_L3_DA_SA_FILTER_MASK_NONE;
+        pstcL3L4FilterInit->u32L3DAFilter              = ETH_MAC_L3_DA_FILTER_DISABLE;
+        pstcL3L4FilterInit->u32L3SAFilter              = ETH_MAC_L3_SA_FILTER_DISABLE;
+        pstcL3L4FilterInit->u32L3AddrFilterProtocol    = ETH_MAC_L3_ADDR_FILTER_PROTOCOL_IPV4;
+        pstcL3L4FilterInit->u16L4DestProtFilterValue   = 0U;
+        pstcL3L4FilterInit->u16L4SourceProtFilterValue = 0U;
+        pstcL3L4FilterInit->u32L3Ipv4DAFilterValue     = 0UL;
+        pstcL3L4FilterInit->u32L3Ipv4SAFilterValue     = 0UL;
+        for (i=0U; i<4U; i++)
+        {
+            pstcL3L4FilterInit->au32L3Ipv6AddrFilterValue[i] = 0UL;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Enable or disable MAC L3L4 Filter function.
+ * @param  [in] enNewSta                    The function new state.
+ *           @arg This parameter can be: Enable or Disable.
+ * @retval None
+ */
+void ETH_MAC_L3L4FilterCmd(en_functional_state_t enNewSta)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewSta));
+
+    WRITE_REG32(bM4_ETH->MAC_FLTCTLR_b.IPFE, enNewSta);
+}
+
+/**
+ * @brief  Set L4 port filter protocol.
+ * @param  [in] u32PortProtocol             MAC L4 port filter protocol.
+ *         This parameter can be one of the following values:
+ *           @arg ETH_MAC_L4_PORT_FILTER_PROTOCOL_TCP:  Port filter for TCP frame
+ *           @arg ETH_MAC_L4_PORT_FILTER_PROTOCOL_UDP:  Port filter for UDP frame
+ * @retval None
+ */
+void ETH_MAC_SetPortFilterProtocol(uint32_t u32PortProtocol)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_ETH_MAC_L4_PORT_FILTER_PROTOCOL(u32PortProtocol));
+
+    WRITE_REG32(bM4_ETH->MAC_L34CTLR_b.L4PEN, (u32PortProtocol >> ETH_MAC_L34CTLR_L4PEN_POS));
+}
+
+/**
+ * @brief  Set L4 Destination port filter value.
+ * @param  [in] u16Port                     The value of Destination port.
+ * @retval None
+ */
+void ETH_MAC_SetDestPortFilterVal(uint16_t u16Port)
+{
+    MODIFY_REG32(M4_ETH->MAC_L4PORTR, ETH_MAC_L4PORTR_L4DPVAL, ((uint32_t)u16Port << 16U));
+}
+
+/**
+ * @brief  Set L4 Source port filter value.
+ * @param  [in] u16Port                     The value of Source port.
+ * @retval None
+ */
+void ETH_MAC_SetSrcPortFilterVal(uint16_t u16Port)
+{
+    MODIFY_REG32(M4_ETH->MAC_L4PORTR, ETH_MAC_L4PORTR_L4SPVAL, u16Port);
+}
+
+/**
+ * @brief  Set L3 address filter protocol.
+ * @param  [in] u32AddrProtocol             MAC L3 address filter protocol.
+ *         This parameter can be one of the following values:
+ *           @arg ETH_MAC_L3_ADDR_FILTER_PROTOCOL_IPV4: Ip Address filter for IPv4
+ *           @arg ETH_MAC_L3_ADDR_FILTER_PROTOCOL_IPV6: Ip Address filter for IPv6
+ * @retval None
+ */
+void ETH_MAC_SetAddrFilterProtocol(uint32_t u32AddrProtocol)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_ETH_MAC_L3_ADDR_FILTER_PROTOCOL(u32AddrProtocol));
+
+    WRITE_REG32(bM4_ETH->MAC_L34CTLR_b.L3PEN, u32AddrProtocol);
+}
+
+/**
+ * @brief  Set L3 Destination address filter value of IPv4.
+ * @param  [in] u32Addr                     The value of Destination address.
+ * @retval None
+ */
+void ETH_MAC_SetIpv4DestAddrFilterVal(uint32_t u32Addr)
+{
+    WRITE_REG32(M4_ETH->MAC_L3ADDRR1, u32Addr);
+}
+
+/**
+ * @brief  Set L3 Source address filter value of IPv4.
+ * @param  [in] u32Addr                     The value of Source address.
+ * @retval None
+ */
+void ETH_MAC_SetIpv4SrcAddrFilterVal(uint32_t u32Addr)
+{
+    WRITE_REG32(M4_ETH->MAC_L3ADDRR0, u32Addr);
+}
+
+/**
+ * @brief  Set L3 Destination/Source Address filter value of IPv6.
+ * @param  [in] au32Addr                    Pointer to Destination/Source Address buffer(4 words).
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Set Address filter value success
+ *           - ErrorInvalidParameter: au32Addr == NULL
+ */
+en_result_t ETH_MAC_SetIpv6AddrFilterVal(const uint32_t au32Addr[])
+{
+    en_result_t enRet = Ok;
+
+    if (NULL == au32Addr)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        WRITE_REG32(M4_ETH->MAC_L3ADDRR0, au32Addr[0]);
+        WRITE_REG32(M4_ETH->MAC_L3ADDRR1, au32Addr[1]);
+        WRITE_REG32(M4_ETH->MAC_L3ADDRR2, au32Addr[2]);
+        WRITE_REG32(M4_ETH->MAC_L3ADDRR3, au32Addr[3]);
+    }
+
+    return enRet;
+}
+
+/******************************************************************************/
+/*                           Flow Table Functions                             */
+/******************************************************************************/
+/**
+ * @brief  Initialize a flow table.
+ * @param  [out] pstcTable                  Pointer to a @ref stc_eth_flow_table_t structure
+ * @param  [in] u32HwMode                   Use of the L3/L4 filter
+ *         This parameter can be one of the following values:
+ *           @arg ETH_FLOW_HW_FILTER_OFF:       Match every frame in software
+ *           @arg ETH_FLOW_HW_FILTER_DEDICATED: Program the L3/L4 filter while the table holds a single rule
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcTable == NULL
+ * @note   The MAC drops the frames failing the L3/L4 filter, ETH_FLOW_HW_FILTER_DEDICATED may only be
+ *         given when the receive path carries nothing but the flow of the rule. The filter is disabled
+ *         again as soon as a second rule is added, the frames of the other rules would be lost.
+ */
+en_result_t ETH_FLOW_TableInit(stc_eth_flow_table_t *pstcTable, uint32_t u32HwMode)
+{
+    en_result_t enRet = Ok;
+
+    if (NULL == pstcTable)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        /* Check parameters */
+        DDL_ASSERT(IS_ETH_FLOW_HW_FILTER_MODE(u32HwMode));
+
+        (void)memset(pstcTable, 0, sizeof(stc_eth_flow_table_t));
+        pstcTable->u32HwRule = ETH_FLOW_RULE_NONE;
+        pstcTable->u32HwMode = u32HwMode;
+        if (ETH_FLOW_HW_FILTER_OFF != u32HwMode)
+        {
+            ETH_MAC_L3L4FilterDeInit();
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set the fields of structure stc_eth_flow_rule_t to default values.
+ * @param  [out] pstcRule                   Pointer to a @ref stc_eth_flow_rule_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Structure Initialize success
+ *           - ErrorInvalidParameter: pstcRule == NULL
+ */
+en_result_t ETH_FLOW_RuleStructInit(stc_eth_flow_rule_t *pstcRule)
+{
+    en_result_t enRet = Ok;
+
+    if (NULL == pstcRule)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        pstcRule->u32Protocol = ETH_FLOW_PROTOCOL_UDP;
+        pstcRule->u32DestAddr = 0UL;
+        pstcRule->u16DestPort = 0U;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Add a rule to the flow table.
+ * @param  [in] pstcTable                   Pointer to a @ref stc_eth_flow_table_t structure
+ * @param  [in] pstcRule                    Pointer to a @ref stc_eth_flow_rule_t structure
+ * @param  [out] pu32RuleId                 Pointer to the ID of the rule, the lowest free ID is taken
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Add success
+ *           - ErrorInvalidParameter: pstcTable == NULL or pstcRule == NULL or pu32RuleId == NULL
+ *           - ErrorBufferFull: The table is full
+ */
+en_result_t ETH_FLOW_AddRule(stc_eth_flow_table_t *pstcTable, const stc_eth_flow_rule_t *pstcRule, uint32_t *pu32RuleId)
+{
+    uint32_t i;
+    en_result_t enRet = ErrorBufferFull;
+
+    if ((NULL == pstcTable) || (NULL == pstcRule) || (NULL == pu32RuleId))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        /* Check parameters */
+        DDL_ASSERT(IS_ETH_FLOW_PROTOCOL(pstcRule->u32Protocol));
+
+        for (i=0UL; i<ARRAY_SZ(pstcTable->astcRule); i++)
+        {
+            if (0UL == (pstcTable->u32RuleMask & (1UL << i)))
+            {
+                pstcTable->astcRule[i]   = *pstcRule;
+                pstcTable->u32RuleMask  |= (1UL << i);
+                *pu32RuleId = i;
+                ETH_FLOW_UpdateHwFilter(pstcTable);
+                enRet = Ok;
+                break;
+            }
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Delete a rule from the flow table.
+ * @param  [in] pstcTable                   Pointer to a @ref stc_eth_flow_table_t structure
+ * @param  [in] u32RuleId                   ID of the rule
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Delete success
+ *           - ErrorInvalidParameter: pstcTable == NULL or the rule is not valid
+ */
+en_result_t ETH_FLOW_DelRule(stc_eth_flow_table_t *pstcTable, uint32_t u32RuleId)
+{
+    en_result_t enRet = Ok;
+
+    if ((NULL == pstcTable) || (u32RuleId >= ARRAY_SZ(pstcTable->astcRule)) ||
+        (0UL == (pstcTable->u32RuleMask & (1UL << u32RuleId))))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        pstcTable->u32RuleMask &= ~(1UL << u32RuleId);
+        ETH_FLOW_UpdateHwFilter(pstcTable);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Find the rule matching a received frame.
+ * @param  [in] pstcTable                   Pointer to a @ref stc_eth_flow_table_t structure
+ * @param  [in] au8Frame                    Pointer to the frame, from the destination MAC address
+ * @param  [in] u32Length                   Length of the frame
+ * @param  [in] u32ExtendStatus             RDES4 of the frame, 0 if it is not valid (normal descriptor or
+ *                                          ETH_DMARXDESC_DAS_ESA cleared)
+ * @retval uint32_t                         ID of the matched rule with the highest priority, ETH_FLOW_RULE_NONE if no rule matched
+ * @note   A frame matched by the L3/L4 filter is dispatched from RDES4 without parsing its headers.
+ */
+uint32_t ETH_FLOW_Lookup(const stc_eth_flow_table_t *pstcTable, const uint8_t au8Frame[],
+                         uint32_t u32Length, uint32_t u32ExtendStatus)
+{
+    uint32_t i;
+    uint32_t u32Offset;
+    uint32_t u32HeaderLen;
+    uint32_t u32Protocol;
+    uint32_t u32DestAddr;
+    uint32_t u32DestPort = 0UL;
+    uint32_t u32PortValid = 0UL;
+    uint32_t u32Match;
+    uint32_t u32RuleId = ETH_FLOW_RULE_NONE;
+    const stc_eth_flow_rule_t *pstcRule;
+
+    if ((NULL != pstcTable) && (NULL != au8Frame))
+    {
+        /* Hardware filter */
+        if (ETH_FLOW_RULE_NONE != pstcTable->u32HwRule)
+        {
+            pstcRule = &pstcTable->astcRule[pstcTable->u32HwRule];
+            u32Match = ETH_DMARXDESC_IPV4DR;
+            if (0UL != pstcRule->u32DestAddr)
+            {
+                u32Match |= ETH_DMARXDESC_L3FMS;
+            }
+            if (0U != pstcRule->u16DestPort)
+            {
+                u32Match |= ETH_DMARXDESC_L4FMS;
+            }
+            if ((u32Match == (u32ExtendStatus & u32Match)) &&
+                (((ETH_FLOW_PROTOCOL_UDP == pstcRule->u32Protocol) ? ETH_DMARXDESC_IPPT_UDP : ETH_DMARXDESC_IPPT_TCP) ==
+                 (u32ExtendStatus & ETH_DMARXDESC_IPPT)))
+            {
+                u32RuleId = pstcTable->u32HwRule;
+            }
+        }
+
+        /* Parse the Ethernet and IPv4 headers */
+        u32Offset = ETH_FLOW_FRAME_TYPE_OFFSET;
+        if ((ETH_FLOW_RULE_NONE == u32RuleId) && (u32Length >= (u32Offset + 2UL)) &&
+            (ETH_FLOW_FRAME_TYPE_VLAN == (((uint16_t)au8Frame[u32Offset] << 8U) | au8Frame[u32Offset + 1UL])))
+        {
+            u32Offset += 4UL;
+        }
+        if ((ETH_FLOW_RULE_NONE == u32RuleId) && (u32Length >= (u32Offset + 2UL + ETH_FLOW_IPV4_HEADER_MIN)) &&
+            (ETH_FLOW_FRAME_TYPE_IPV4 == (((uint16_t)au8Frame[u32Offset] << 8U) | au8Frame[u32Offset + 1UL])) &&
+            (0x40U == (au8Frame[u32Offset + 2UL] & 0xF0U)))
+        {
+            u32Offset   += 2UL;
+            u32HeaderLen = ((uint32_t)au8Frame[u32Offset] & 0x0FUL) << 2U;
+            u32Protocol  = au8Frame[u32Offset + 9UL];
+            u32DestAddr  = ((uint32_t)au8Frame[u32Offset + 16UL] << 24U) | ((uint32_t)au8Frame[u32Offset + 17UL] << 16U) |
+                           ((uint32_t)au8Frame[u32Offset + 18UL] << 8U)  | (uint32_t)au8Frame[u32Offset + 19UL];
+            /* The port is only carried by the first fragment */
+            if ((u32HeaderLen >= ETH_FLOW_IPV4_HEADER_MIN) && (u32Length >= (u32Offset + u32HeaderLen + 4UL)) &&
+                (0U == ((((uint16_t)au8Frame[u32Offset + 6UL] << 8U) | au8Frame[u32Offset + 7UL]) & ETH_FLOW_IPV4_FRAG_OFFSET)))
+            {
+                u32DestPort  = ((uint32_t)au8Frame[u32Offset + u32HeaderLen + 2UL] << 8U) | au8Frame[u32Offset + u32HeaderLen + 3UL];
+                u32PortValid = 1UL;
+            }
+
+            for (i=0UL; i<ARRAY_SZ(pstcTable->astcRule); i++)
+            {
+                pstcRule = &pstcTable->astcRule[i];
+                if ((0UL != (pstcTable->u32RuleMask & (1UL << i))) && (u32Protocol == pstcRule->u32Protocol) &&
+                    ((0UL == pstcRule->u32DestAddr) || (u32DestAddr == pstcRule->u32DestAddr)) &&
+                    ((0U == pstcRule->u16DestPort) || ((0UL != u32PortValid) && (u32DestPort == pstcRule->u16DestPort))))
+                {
+                    u32RuleId = i;
+                    break;
+                }
+            }
+        }
+    }
+
+    return u32RuleId;
+}
+
+/******************************************************************************/
+/*                              DMA Functions                                 */
+/******************************************************************************/
+/**
+ * @brief  De-Initialize DMA.
+ * @param  None
+ * @retval None
+ */
+void ETH_DMA_DeInit(void)
+{
+    WRITE_REG32(M4_ETH->DMA_BUSMODR, 0x00020101UL);
+    WRITE_REG32(M4_ETH->DMA_OPRMODR, 0U);
+    WRITE_REG32(M4_ETH->DMA_INTENAR, 0U);
+    WRITE_REG32(M4_ETH->DMA_REVWDTR, 0U);
+    WRITE_REG32(M4_ETH->DMA_TXDLADR, 0U);
+    WRITE_REG32(M4_ETH->DMA_RXDLADR, 0U);
+}
+
+/**
+ * @brief  Initialize DMA.
+ * @param  [in] pstcDmaInit                 Pointer to a @ref stc_eth_dma_init_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: DMA Initialize success
+ *           - ErrorInvalidParameter: pstcDmaInit == NULL
+ */
+en_result_t ETH_DMA_Init(const stc_eth_dma_init_t *pstcDmaInit)
+{
+    en_result_t enRet = Ok;
+
+    if (NULL == pstcDmaInit)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        /* Check parameters */
+        DDL_ASSERT(IS_ETH_DMA_BURST_MODE(pstcDmaInit->u32BurstMode));
+        DDL_ASSERT(IS_ETH_DMA_ADDRESS_ALIGN(pstcDmaInit->u32AddressAlign));
+        DDL_ASSERT(IS_ETH_DMA_RX_BURST_LENGTH(pstcDmaInit->u32RxDMABurstLength));
+        DDL_ASSERT(IS_ETH_DMA_TX_BURST_LENGTH(pstcDmaInit->u32TxDMABurstLength));
+        DDL_ASSERT(IS_ETH_DMA_ENHANCE_DESCRIPTOR(pstcDmaInit->u32EnhanceDescriptor));
+        DDL_ASSERT(IS_ETH_DMA_DESC_SKIP_LENGTH(pstcDmaInit->u32DescriptorSkipLength));
+        DDL_ASSERT(IS_ETH_DMA_PRIORITY_ARBITRATION(pstcDmaInit->u32DMAArbitration));
+        DDL_ASSERT(IS_ETH_DMA_DROP_CHECKSUM_ERRORFRAME(pstcDmaInit->u32DropChecksumErrorFrame));
+        DDL_ASSERT(IS_ETH_DMA_RECEIVE_STORE_FORWARD(pstcDmaInit->u32ReceiveStoreForward));
+        DDL_ASSERT(IS_ETH_DMA_FLUSH_RECEIVEDFRAME(pstcDmaInit->u32FlushReceiveFrame));
+        DDL_ASSERT(IS_ETH_DMA_TRANSMIT_STORE_FORWARD(pstcDmaInit->u32TransmitStoreForward));
+        DDL_ASSERT(IS_ETH_DMA_TRANSMIT_THRESHOLD(pstcDmaInit->u32TransmitThreshold));
+        DDL_ASSERT(IS_ETH_DMA_FORWARD_ERRORFRAME(pstcDmaInit->u32ForwardErrorFrame));
+        DDL_ASSERT(IS_ETH_DMA_FORWARD_UNDERSIZE_GOODFRAME(pstcDmaInit->u32ForwardUndersizeGoodFrame));
+        DDL_ASSERT(IS_ETH_DMA_DROP_JUMBO_FRAME(pstcDmaInit->u32DropJumboFrame));
+        DDL_ASSERT(IS_ETH_DMA_RECEIVE_THRESHOLD(pstcDmaInit->u32ReceiveThreshold));
+        DDL_ASSERT(IS_ETH_DMA_SECONDFRAME_OPERARTE(pstcDmaInit->u32SecondFrameOperate));
+
+        /* Set Bus mode register */
+        MODIFY_REG32(M4_ETH->DMA_BUSMODR, ETH_DMA_BUSMODR_CLEAR_MASK,
+                     (pstcDmaInit->u32BurstMode        | pstcDmaInit->u32AddressAlign      | pstcDmaInit->u32RxDMABurstLength     |
+                      pstcDmaInit->u32TxDMABurstLength | pstcDmaInit->u32EnhanceDescriptor | pstcDmaInit->u32DescriptorSkipLength |
+                      pstcDmaInit->u32DMAArbitration   | ETH_DMA_BUSMODR_SPBL));
+        /* Set Operation mode register */
+        MODIFY_REG32(M4_ETH->DMA_OPRMODR, ETH_DMA_OPRMODR_CLEAR_MASK,
+                     (pstcDmaInit->u32DropChecksumErrorFrame    | pstcDmaInit->u32ReceiveStoreForward | pstcDmaInit->u32FlushReceiveFrame |
+                      pstcDmaInit->u32TransmitStoreForward      | pstcDmaInit->u32TransmitThreshold   | pstcDmaInit->u32ForwardErrorFrame |
+                      pstcDmaInit->u32ForwardUndersizeGoodFrame | pstcDmaInit->u32DropJumboFrame      | pstcDmaInit->u32ReceiveThreshold  |
+                      pstcDmaInit->u32SecondFrameOperate));
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set the fields of structure stc_eth_dma_init_t to default values.
+ * @param  [out] pstcDmaInit                Pointer to a @ref stc_eth_dma_init_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Structure Initialize success
+ *           - ErrorInvalidParameter: pstcDmaInit == NULL
+ */
+en_result_t ETH_DMA_StructInit(stc_eth_dma_init_t *pstcDmaInit)
+{
+    en_result_t enRet = Ok;
+
+    if (NULL == pstcDmaInit)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        pstcDmaInit->u32BurstMode                 = ETH_DMA_BURST_MODE_FIXED;
+        pstcDmaInit->u32AddressAlign              = ETH_DMA_ADDRESS_ALIGN_DISABLE;
+        pstcDmaInit->u32RxDMABurstLength          = ETH_DMA_RX_BURST_LENGTH_32BEAT;
+        pstcDmaInit->u32TxDMABurstLength          = ETH_DMA_TX_BURST_LENGTH_32BEAT;
+        pstcDmaInit->u32EnhanceDescriptor         = ETH_DMA_ENHANCE_DESCRIPTOR_ENABLE;
+        pstcDmaInit->u32DescriptorSkipLength      = 0U;
+        pstcDmaInit->u32DMAArbitration            = ETH_DMA_ARBITRATION_LOOP_RXTX_1_1;
+        pstcDmaInit->u32DropChecksumErrorFrame    = ETH_DMA_DROP_CHECKSUM_ERRORFRAME_ENABLE;
+        pstcDmaInit->u32ReceiveStoreForward       = ETH_DMA_RECEIVE_STORE_FORWARD_ENABLE;
+        pstcDmaInit->u32FlushReceiveFrame         = ETH_DMA_FLUSH_RECEIVEDFRAME_ENABLE;
+        pstcDmaInit->u32TransmitStoreForward      = ETH_DMA_TRANSMIT_STORE_FORWARD_ENABLE;
+        pstcDmaInit->u32TransmitThreshold         = ETH_DMA_TRANSMIT_THRESHOLD_64BYTE;
+        pstcDmaInit->u32ForwardErrorFrame         = ETH_DMA_FORWARD_ERRORFRAME_DISABLE;
+        pstcDmaInit->u32ForwardUndersizeGoodFrame = ETH_DMA_FORWARD_UNDERSIZE_GOODFRAME_DISABLE;
+        pstcDmaInit->u32DropJumboFrame            = ETH_DMA_DROP_JUMBO_FRAME_DISABLE;
+        pstcDmaInit->u32ReceiveThreshold          = ETH_DMA_RECEIVE_THRESHOLD_64BYTE;
+        pstcDmaInit->u32SecondFrameOperate        = ETH_DMA_SECONDFRAME_OPERARTE_ENABLE;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set DMA software reset.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Software reset success
+ *           - ErrorTimeout: Reset timeout
+ */
+en_result_t ETH_DMA_SoftwareReset(void)
+{
+    __IO uint32_t u32Count;
+    en_result_t enRet = Ok;
+
+    WRITE_REG32(bM4_ETH->DMA_BUSMODR_b.SWR, 1U);
+    u32Count = ETH_TIMEOUT_SOFTWARE_RESET * (HCLK_VALUE / 20000UL);
+    do
+    {
+        if (u32Count-- == 0UL)
+        {
+            enRet = ErrorTimeout;
+            break;
+        }
+    } while (0UL != READ_REG32(bM4_ETH->DMA_BUSMODR_b.SWR));
+
+    return enRet;
+}
+
+/**
+ * @brief  Set DMA Transmit priority ratio.
+ * @param  [in] u32PrioRatio                Priority ratio
+ *         This parameter can be one of the following values:
+ *           @arg ETH_DMA_ARBITRATION_LOOP_RXTX_1_1:        Rx:Tx = 1:1
+ *           @arg ETH_DMA_ARBITRATION_LOOP_RXTX_2_1:        Rx:Tx = 2:1
+ *           @arg ETH_DMA_ARBITRATION_LOOP_RXTX_3_1:        Rx:Tx = 3:1
+ *           @arg ETH_DMA_ARBITRATION_LOOP_RXTX_4_1:        Rx:Tx = 4:1
+ *           @arg ETH_DMA_ARBITRATION_LOOP_TXRX_1_1:        Tx:Rx = 1:1
+ *           @arg ETH_DMA_ARBITRATION_LOOP_TXRX_2_1:        Tx:Rx = 2:1
+ *           @arg ETH_DMA_ARBITRATION_LOOP_TXRX_3_1:        Tx:Rx = 3:1
+ *           @arg ETH_DMA_ARBITRATION_LOOP_TXRX_4_1:        Tx:Rx = 4:1
+ *           @arg ETH_DMA_ARBITRATION_FIXED_RXPRIORTX:      Fixed priority: Rx is higher than Tx
+ *           @arg ETH_DMA_ARBITRATION_FIXED_TXPRIORRX:      Fixed priority: Tx is higher than Rx
+ * @retval None
+ */
+void ETH_DMA_SetTransPrioRatio(uint32_t u32PrioRatio)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_ETH_DMA_PRIORITY_ARBITRATION(u32PrioRatio));
+
+    MODIFY_REG32(M4_ETH->DMA_BUSMODR,
+                 (ETH_DMA_BUSMODR_TXPR | ETH_DMA_BUSMODR_PRAT | ETH_DMA_BUSMODR_DMAA),
+                 u32PrioRatio);
+}
+
+/**
+ * @brief  Set DMA Rx watchdog counter.
+ * @param  [in] u8Value                     The value of Watchdog timer
+ * @retval None
+ */
+void ETH_DMA_SetRxWatchdogCounter(uint8_t u8Value)
+{
+    WRITE_REG32(M4_ETH->DMA_REVWDTR, u8Value);
+}
+
+/**
+ * @brief  Flush transmit FIFO.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Flush transmit FIFO success
+ *           - ErrorTimeout: Flush timeout
+ */
+en_result_t ETH_DMA_FlushTransmitFIFO(void)
+{
+    __IO uint32_t u32Count;
+    en_result_t enRet = Ok;
+
+    WRITE_REG32(bM4_ETH->DMA_OPRMODR_b.FTF, 1U);
+    u32Count = ETH_TIMEOUT_WRITE_REGISTER * (HCLK_VALUE / 20000UL);
+    do
+    {
+        if (u32Count-- == 0UL)
+        {
+            enRet = ErrorTimeout;
+            break;
+        }
+    } while (0UL != READ_REG32(bM4_ETH->DMA_OPRMODR_b.FTF));
+
+    return enRet;
+}
+
+/**
+ * @brief  Enable or disable DMA transmit.
+ * @param  [in] enNewSta                    The function new state.
+ *           @arg This parameter can be: Enable or Disable.
+ * @retval None
+ */
+void ETH_DMA_TransmitCmd(en_functional_state_t enNewSta)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewSta));
+
+    WRITE_REG32(bM4_ETH->DMA_OPRMODR_b.STT, enNewSta);
+}
+
+/**
+ * @brief  Enable or disable DMA receive.
+ * @param  [in] enNewSta                    The function new state.
+ *           @arg This parameter can be: Enable or Disable.
+ * @retval None
+ */
+void ETH_DMA_ReceiveCmd(en_functional_state_t enNewSta)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewSta));
+
+    WRITE_REG32(bM4_ETH->DMA_OPRMODR_b.STR, enNewSta);
+}
+
+/**
+ * @brief  Enable or disable DMA interrupt.
+ * @param  [in] u32IntSrc                   DMA interrupt source
+ *         This parameter can be one or any combination of the following values:
+ *           @arg ETH_DMA_INT_NIE:          Normal interrupt summary
+ *           @arg ETH_DMA_INT_AIE:          Abnormal interrupt summary
+ *           @arg ETH_DMA_INT_ERE:          Early receive interrupt
+ *           @arg ETH_DMA_INT_FBE:          Fatal bus error interrupt
+ *           @arg ETH_DMA_INT_ETE:          Early transmit interrupt
+ *           @arg ETH_DMA_INT_RWE:          Receive watchdog timeout interrupt
+ *           @arg ETH_DMA_INT_RSE:          Receive process stopped interrupt
+ *           @arg ETH_DMA_INT_RUE:          Receive buffer unavailable interrupt
+ *           @arg ETH_DMA_INT_RIE:          Receive interrupt
+ *           @arg ETH_DMA_INT_UNE:          Transmit Underflow interrupt
+ *           @arg ETH_DMA_INT_OVE:          Receive Overflow interrupt
+ *           @arg ETH_DMA_INT_TJE:          Transmit jabber timeout interrupt
+ *           @arg ETH_DMA_INT_TUE:          Transmit buffer unavailable interrupt
+ *           @arg ETH_DMA_INT_TSE:          Transmit process stopped interrupt
+ *           @arg ETH_DMA_INT_TIE:          Transmit interrupt
+ * @param  [in] enNewSta                    The function new state.
+ *           @arg This parameter can be: Enable or Disable.
+ * @retval None
+ */
+void ETH_DMA_IntCmd(uint32_t u32IntSrc, en_functional_state_t enNewSta)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_ETH_DMA_INTERRUPT(u32IntSrc));
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewSta));
+
+    if (Disable != enNewSta)
+    {
+        SET_REG32_BIT(M4_ETH->DMA_INTENAR, u32IntSrc);
+    }
+    else
+    {
+        CLEAR_REG32_BIT(M4_ETH->DMA_INTENAR, u32IntSrc);
+    }
+}
+
+/**
+ * @brief  Get DMA flag status.
+ * @param  [in] u32Flag                     DMA flag type
+ *         This parameter can be one or any combination of the following values:
+ *           @arg ETH_DMA_FLAG_PTPS:        Time-stamp trigger status
+ *           @arg ETH_DMA_FLAG_PMTS:        PMT trigger status
+ *           @arg ETH_DMA_FLAG_MMCS:        MMC trigger status
+ *           @arg ETH_DMA_FLAG_NIS:         Normal interrupt summary flag
+ *           @arg ETH_DMA_FLAG_AIS:         Abnormal interrupt summary flag
+ *           @arg ETH_DMA_FLAG_ERS:         Early receive flag
+ *           @arg ETH_DMA_FLAG_FBS:         Fatal bus error flag
+ *           @arg ETH_DMA_FLAG_ETS:         Early transmit flag
+ *           @arg ETH_DMA_FLAG_RWS:         Receive watchdog timeout flag
+ *           @arg ETH_DMA_FLAG_RSS:         Receive stopped flag
+ *           @arg ETH_DMA_FLAG_RUS:         Receive buffer unavailable flag
+ *           @arg ETH_DMA_FLAG_RIS:         Receive flag
+ *           @arg ETH_DMA_FLAG_UNS:         Transmit Underflow flag
+ *           @arg ETH_DMA_FLAG_OVS:         Receive Overflow flag
+ *           @arg ETH_DMA_FLAG_TJS:         Transmit jabber timeout flag
+ *           @arg ETH_DMA_FLAG_TUS:         Transmit buffer unavailable flag
+ *           @arg ETH_DMA_FLAG_TSS:         Transmit stopped flag
+ *           @arg ETH_DMA_FLAG_TIS:         Transmit interrupt flag
+ * @retval An en_flag_status_t enumeration value:
+ *           - Set: Flag is set
+ *           - Reset: Flag is reset
+ */
+en_flag_status_t ETH_DMA_GetStatus(uint32_t u32Flag)
+{
+    en_flag_status_t enFlagSta = Reset;
+
+    /* Check parameters */
+    DDL_ASSERT(IS_ETH_DMA_FLAG(u32Flag));
+
+    if (0UL != (READ_REG32_BIT(M4_ETH->DMA_DMASTSR, u32Flag)))
+    {
+        enFlagSta = Set;
+    }
+
+    return enFlagSta;
+}
+
+/**
+ * @brief  Get DMA overflow flag status.
+ * @param  [in] u32Flag                     DMA overflow flag type
+ *         This parameter can be one of the following values:
+ *           @arg ETH_DMA_OVERFLOW_RXFIFO_COUNTER:          Overflow bit for FIFO overflow counter
+ *           @arg ETH_DMA_OVERFLOW_MISSFRAME_COUNTER:       Overflow bit for miss frame counter
+ * @retval An en_flag_status_t enumeration value:
+ *           - Set: Flag is set
+ *           - Reset: Flag is reset
+ */
+en_flag_status_t ETH_DMA_GetOvfStatus(uint32_t u32Flag)
+{
+    en_flag_status_t enFlagSta = Reset;
+
+    /* Check parameters */
+    DDL_ASSERT(IS_ETH_DMA_MISS_FRAME_TYPE(u32Flag));
+
+    if (0UL != (READ_REG32_BIT(M4_ETH->DMA_RFRCNTR, u32Flag)))
+    {
+        enFlagSta = Set;
+    }
+
+    return enFlagSta;
+}
+
+/******************************************************************************/
+/*                          DMA descriptor Functions                          */
+/******************************************************************************/
+/**
+ * @brief  Initializes DMA Tx descriptor in chain mode.
+ * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @param  [in] astcTxDescTab               Pointer to the first Tx desc list
+ * @param  [in] au8TxBuffer                 Pointer to the first TxBuffer list, or NULL for a zero-copy
+ *                                          list which is used by ETH_DMA_SetTransmitSegments()
+ * @param  [in] u32TxBufferCnt              Number of the Tx desc in the list
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initializes Tx chain mode success
+ *           - ErrorInvalidParameter: pstcEthHandle == NULL or astcTxDescTab == NULL or
+ *                                    u32TxBufferCnt == 0
+ */
+en_result_t ETH_DMA_TxDescListInit(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_desc_t astcTxDescTab[], const uint8_t au8TxBuffer[], uint32_t u32TxBufferCnt)
+{
+    uint32_t i;
+    stc_eth_dma_desc_t *pstcTxDesc;
+    en_result_t enRet = Ok;
+
+    if ((NULL == pstcEthHandle) || (NULL == astcTxDescTab) || (0UL== u32TxBufferCnt))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        /* Set the DMATxDesc pointer with the first in the astcTxDescTab list */
+        pstcEthHandle->stcTxDesc          = astcTxDescTab;
+        pstcEthHandle->stcTxCpltDesc      = astcTxDescTab;
+        pstcEthHandle->u32TxDescQueued    = 0UL;
+        pstcEthHandle->u32TxDescReclaimed = 0UL;
+        pstcEthHandle->u32TxDescCnt       = (NULL == au8TxBuffer) ? u32TxBufferCnt : 0UL;
+
+        /* Fill each DMATxDesc descriptor */
+        for (i=0U; i<u32TxBufferCnt; i++)
+        {
+            pstcTxDesc = &astcTxDescTab[i];
+            /* Set Second Address Chained */
+            pstcTxDesc->u32ControlStatus = ETH_DMATXDESC_TSAC;
+            /* Set Buffer1 address pointer */
+            if (NULL != au8TxBuffer)
+            {
+                pstcTxDesc->u32Buffer1Addr = (uint32_t)(&au8TxBuffer[i * ETH_TXBUF_SIZE]);
+            }
+            else
+            {
+                pstcTxDesc->u32Buffer1Addr = 0UL;
+            }
+            /* Set the DMA Tx descriptors checksum insertion */
+            if (ETH_MAC_CHECKSUM_MODE_HARDWARE == pstcEthHandle->stcCommInit.u32ChecksumMode)
+            {
+                SET_REG32_BIT(pstcTxDesc->u32ControlStatus, ETH_DMATXDESC_CIC_TCPUDPICMP_FULL);
+            }
+
+            /* Initialize the next descriptor with the Next Descriptor Polling */
+            if (i < (u32TxBufferCnt - 1U))
+            {
+                pstcTxDesc->u32Buffer2NextDescAddr = (uint32_t)(&astcTxDescTab[i + 1U]);
+            }
+            else
+            {
+                pstcTxDesc->u32Buffer2NextDescAddr = (uint32_t)astcTxDescTab;
+            }
+        }
+
+        /* Set Transmit Descriptor List Address Register */
+        WRITE_REG32(M4_ETH->DMA_TXDLADR, (uint32_t)astcTxDescTab);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initializes DMA Rx descriptor in chain mode.
+ * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @param  [in] astcRxDescTab               Pointer to the first Rx desc list
+ * @param  [in] au8RxBuffer                 Pointer to the first RxBuffer list
+ * @param  [in] u32RxBufferCnt              Number of the Rx desc in the list
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initializes Rx chain mode success
+ *           - ErrorInvalidParameter: pstcEthHandle == NULL or astcRxDescTab == NULL or
+ *                                    au8RxBuffer == NULL or u32RxBufferCnt == 0
+ */
+en_result_t ETH_DMA_RxDescListInit(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_desc_t astcRxDescTab[], const uint8_t au8RxBuffer[], uint32_t u32RxBufferCnt)
+{
+    uint32_t i;
+    stc_eth_dma_desc_t *pstcRxDesc;
+    en_result_t enRet = Ok;
+
+    if ((NULL == pstcEthHandle) || (NULL == astcRxDescTab) || (NULL == au8RxBuffer) || (0UL == u32RxBufferCnt))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        /* Set the DMARxDesc pointer with the first in the astcRxDescTab list */
+        pstcEthHandle->stcRxDesc    = astcRxDescTab;
+        pstcEthHandle->pstcRxPool   = NULL;
+        pstcEthHandle->u32RxDescCnt = u32RxBufferCnt;
+
+        /* Fill each DMARxDesc descriptor */
+        for (i=0UL; i<u32RxBufferCnt; i++)
+        {
+            pstcRxDesc = &astcRxDescTab[i];
+            /* Set Own bit of the Rx descriptor */
+            pstcRxDesc->u32ControlStatus     = ETH_DMARXDESC_OWN;
+            /* Set Buffer1 size and Second Address Chained */
+            pstcRxDesc->u32ControlBufferSize = ETH_RXBUF_SIZE | ETH_DMARXDESC_RSAC;
+            /* Set Buffer1 address pointer */
+            pstcRxDesc->u32Buffer1Addr       = (uint32_t)(&au8RxBuffer[i * ETH_RXBUF_SIZE]);
+            /* Set the DMA Rx Descriptor interrupt */
+            if (ETH_RX_MODE_INTERRUPT == pstcEthHandle->stcCommInit.u32RxMode)
+            {
+                CLEAR_REG32_BIT(pstcRxDesc->u32ControlBufferSize, ETH_DMARXDESC_DIC);
+            }
+
+            /* Initialize the next descriptor with the Next Descriptor Polling */
+            if (i < (u32RxBufferCnt - 1U))
+            {
+                pstcRxDesc->u32Buffer2NextDescAddr = (uint32_t)(&astcRxDescTab[i + 1U]);
+            }
+            else
+            {
+                pstcRxDesc->u32Buffer2NextDescAddr = (uint32_t)astcRxDescTab;
+            }
+        }
+
+        /* Set Receive Descriptor List Address Register */
+        WRITE_REG32(M4_ETH->DMA_RXDLADR, (uint32_t)astcRxDescTab);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set DMA transmit frame.
+ * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @param  [in] u32FrameLength              Total of data to be transmit
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Set transmit frame success
+ *           - ErrorInvalidParameter: pstcEthHandle == NULL
+ *           - ErrorInvalidMode: Descriptor is owned by the DMA, or the Tx list is a zero-copy list
+ * @note   The checksum insertion follows the checksum mode of ETH_Init().
+ */
+en_result_t ETH_DMA_SetTransmitFrame(stc_eth_handle_t *pstcEthHandle, uint32_t u32FrameLength)
+{
+    en_result_t enRet;
+
+    if (NULL == pstcEthHandle)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else if (ETH_MAC_CHECKSUM_MODE_HARDWARE == pstcEthHandle->stcCommInit.u32ChecksumMode)
+    {
+        enRet = ETH_DMA_SetTransmitFrameChecksum(pstcEthHandle, u32FrameLength, ETH_DMATXDESC_CHECKSUM_TCPUDPICMP_FULL);
+    }
+    else
+    {
+        enRet = ETH_DMA_SetTransmitFrameChecksum(pstcEthHandle, u32FrameLength, ETH_DMATXDESC_CHECKSUM_BYPASS);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set DMA transmit frame with the checksum insertion of the frame.
+ * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @param  [in] u32FrameLength              Total of data to be transmit
+ * @param  [in] u32ChecksumMode             Checksum insertion of the frame
+ *         This parameter can be one of the following values:
+ *           @arg ETH_DMATXDESC_CHECKSUM_BYPASS:                Checksum Engine is bypassed
+ *           @arg ETH_DMATXDESC_CHECKSUM_IPV4HEADER:            IPv4 header checksum insertion
+ *           @arg ETH_DMATXDESC_CHECKSUM_TCPUDPICMP_SEGMENT:    TCP/UDP/ICMP Checksum Insertion calculated over segment only
+ *           @arg ETH_DMATXDESC_CHECKSUM_TCPUDPICMP_FULL:       TCP/UDP/ICMP Checksum Insertion fully calculated
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Set transmit frame success
+ *           - ErrorInvalidParameter: pstcEthHandle == NULL
+ *           - ErrorInvalidMode: Descriptor is owned by the DMA, or the Tx list is a zero-copy list
+ */
+en_result_t ETH_DMA_SetTransmitFrameChecksum(stc_eth_handle_t *pstcEthHandle, uint32_t u32FrameLength, uint32_t u32ChecksumMode)
+{
+    uint32_t i;
+    uint32_t u32BufCnt;
+    uint32_t u32Size;
+    en_result_t enRet = Ok;
+
+    if ((NULL == pstcEthHandle) || (0U == u32FrameLength))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        DDL_ASSERT(IS_ETH_DMATXDESC_CHECKSUM_CONTROL(u32ChecksumMode));
+
+        /* Check if the descriptor is owned by the CPU and has a driver buffer */
+        if ((0UL != (pstcEthHandle->stcTxDesc->u32ControlStatus & ETH_DMATXDESC_OWN)) ||
+            (0UL != pstcEthHandle->u32TxDescCnt))
+        {
+            enRet = ErrorInvalidMode;
+        }
+        else
+        {
+            /* Get the number of needed Tx buffers for the current frame */
+            if (u32FrameLength > ETH_TXBUF_SIZE)
+            {
+                u32BufCnt = u32FrameLength / ETH_TXBUF_SIZE;
+                if (0UL != (u32FrameLength % ETH_TXBUF_SIZE))
+                {
+                    u32BufCnt++;
+                }
+            }
+            else
+            {
+                u32BufCnt = 1U;
+            }
+
+            if (1U == u32BufCnt)
+            {
+                /* Set checksum insertion */
+                MODIFY_REG32(pstcEthHandle->stcTxDesc->u32ControlStatus, ETH_DMATXDESC_CIC, u32ChecksumMode);
+                /* Set FIRST and LAST segment */
+                SET_REG32_BIT(pstcEthHandle->stcTxDesc->u32ControlStatus, (ETH_DMATXDESC_TFS | ETH_DMATXDESC_TLS));
+                /* Set frame size */
+                MODIFY_REG32(pstcEthHandle->stcTxDesc->u32ControlBufferSize, ETH_DMATXDESC_TBS1, (u32FrameLength & ETH_DMATXDESC_TBS1));
+                /* Set Own bit of the Tx descriptor */
+                SET_REG32_BIT(pstcEthHandle->stcTxDesc->u32ControlStatus, ETH_DMATXDESC_OWN);
+                /* Point to next descriptor */
+                pstcEthHandle->stcTxDesc = (stc_eth_dma_desc_t *)(pstcEthHandle->stcTxDesc->u32Buffer2NextDescAddr);
+            }
+            else
+            {
+                for (i=0U; i<u32BufCnt; i++)
+                {
+                    /* Set checksum insertion */
+                    MODIFY_REG32(pstcEthHandle->stcTxDesc->u32ControlStatus, ETH_DMATXDESC_CIC, u32ChecksumMode);
+                    /* Clear FIRST and LAST segment bits */
+                    CLEAR_REG32_BIT(pstcEthHandle->stcTxDesc->u32ControlStatus, (ETH_DMATXDESC_TFS | ETH_DMATXDESC_TLS));
+                    if (0U == i)
+                    {
+                        /* Set the FIRST segment bit */
+                        SET_REG32_BIT(pstcEthHandle->stcTxDesc->u32ControlStatus, ETH_DMATXDESC_TFS);
+                    }
+
+                    if ((u32BufCnt - 1U) == i)
+                    {
+                        /* Set the last segment bit */
+                        SET_REG32_BIT(pstcEthHandle->stcTxDesc->u32ControlStatus, ETH_DMATXDESC_TLS);
+                        u32Size = u32FrameLength - (u32BufCnt - 1U) * ETH_TXBUF_SIZE;
+                        MODIFY_REG32(pstcEthHandle->stcTxDesc->u32ControlBufferSize, ETH_DMATXDESC_TBS1, (u32Size & ETH_DMATXDESC_TBS1));
+                    }
+                    else
+                    {
+                        /* Set frame size */
+                        MODIFY_REG32(pstcEthHandle->stcTxDesc->u32ControlBufferSize, ETH_DMATXDESC_TBS1, (ETH_TXBUF_SIZE & ETH_DMATXDESC_TBS1));
+                    }
+
+                    /* Set Own bit of the Tx descriptor */
+                    SET_REG32_BIT(pstcEthHandle->stcTxDesc->u32ControlStatus, ETH_DMATXDESC_OWN);
+                    /* Pointer to next descriptor */
+                    pstcEthHandle->stcTxDesc = (stc_eth_dma_desc_t *)(pstcEthHandle->stcTxDesc->u32Buffer2NextDescAddr);
+                }
+            }
+
+            /* When Tx Buffer unavailable flag is set: clear it and resume transmission */
+            if (0UL != (READ_REG32_BIT(M4_ETH->DMA_DMASTSR, ETH_DMA_DMASTSR_TUS)))
+            {
+                /* Clear DMA TUS flag */
+                /* Resume DMA transmit */
+                WRITE_REG32(M4_ETH->DMA_TXPOLLR, 0U);
+            }
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get DMA receive frame.
+ * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Get receive frame success
+ *           - ErrorInvalidParameter: pstcEthHandle == NULL
+ *           - Error: Not completed frame received
+ */
+en_result_t ETH_DMA_GetReceiveFrame(stc_eth_handle_t *pstcEthHandle)
+{
+    en_result_t enRet = Error;
+
+    if (NULL == pstcEthHandle)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        /* Check if segment is not owned by DMA */
+        if (0UL == (pstcEthHandle->stcRxDesc->u32ControlStatus & ETH_DMARXDESC_OWN))
+        {
+            /* Check if last segment */
+            if (0UL != (pstcEthHandle->stcRxDesc->u32ControlStatus & ETH_DMARXDESC_RLS))
+            {
+                pstcEthHandle->stcRxFrame.u32SegCount++;
+                pstcEthHandle->stcRxFrame.pstcLSDesc = pstcEthHandle->stcRxDesc;
+                /* Check if last segment is first segment */
+                if (1U == pstcEthHandle->stcRxFrame.u32SegCount)
+                {
+                    pstcEthHandle->stcRxFrame.pstcFSDesc = pstcEthHandle->stcRxDesc;
+                }
+
+                /* Get the Frame Length of the received packet: Strip FCS */
+                pstcEthHandle->stcRxFrame.u32Length = ((pstcEthHandle->stcRxDesc->u32ControlStatus & ETH_DMARXDESC_FRAL) >> ETH_DMARXDESC_FRAME_LENGTHSHIFT) - 4U;
+                /* Get the address of the buffer start address */
+                pstcEthHandle->stcRxFrame.u32Buffer = (pstcEthHandle->stcRxFrame.pstcFSDesc)->u32Buffer1Addr;
+                /* Get the checksum status */
+                pstcEthHandle->stcRxFrame.u32ChecksumStatus = ETH_DMA_RxChecksumStatus(pstcEthHandle->stcRxDesc->u32ControlStatus,
+                                                                                       pstcEthHandle->stcRxDesc->u32ExtendStatus);
+                /* Pointer to next descriptor */
+                pstcEthHandle->stcRxDesc              = (stc_eth_dma_desc_t*)(pstcEthHandle->stcRxDesc->u32Buffer2NextDescAddr);
+                /* Get success */
+                enRet = Ok;
+            }
+            /* Check if first segment */
+            else if (0UL != (pstcEthHandle->stcRxDesc->u32ControlStatus & ETH_DMARXDESC_RFS))
+            {
+                pstcEthHandle->stcRxFrame.pstcFSDesc  = pstcEthHandle->stcRxDesc;
+                pstcEthHandle->stcRxFrame.pstcLSDesc  = NULL;
+                pstcEthHandle->stcRxFrame.u32SegCount = 1U;
+                /* Point to next descriptor */
+                pstcEthHandle->stcRxDesc = (stc_eth_dma_desc_t*)(pstcEthHandle->stcRxDesc->u32Buffer2NextDescAddr);
+            }
+            /* Check if intermediate segment */
+            else
+            {
+                pstcEthHandle->stcRxFrame.u32SegCount++;
+                /* Point to next descriptor */
+                pstcEthHandle->stcRxDesc = (stc_eth_dma_desc_t*)(pstcEthHandle->stcRxDesc->u32Buffer2NextDescAddr);
+            }
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get DMA receive frame in interrupt mode.
+ * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Get receive frame success
+ *           - ErrorInvalidParameter: pstcEthHandle == NULL
+ *           - Error: Not completed frame received
+ */
+en_result_t ETH_DMA_GetReceiveFrame_Interrupt(stc_eth_handle_t *pstcEthHandle)
+{
+    uint32_t u32DescCnt = 0U;
+    en_result_t enRet = Error;
+
+    if (NULL == pstcEthHandle)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        /* Scan descriptor owned by CPU */
+        while ((0UL == (pstcEthHandle->stcRxDesc->u32ControlStatus & ETH_DMARXDESC_OWN)) && (u32DescCnt < ETH_RXBUF_SIZE))
+        {
+            u32DescCnt++;
+            /* Check if first segment in frame */
+            if (ETH_DMARXDESC_RFS == (pstcEthHandle->stcRxDesc->u32ControlStatus & (ETH_DMARXDESC_RFS | ETH_DMARXDESC_RLS)))
+            {
+                pstcEthHandle->stcRxFrame.pstcFSDesc  = pstcEthHandle->stcRxDesc;
+                pstcEthHandle->stcRxFrame.pstcLSDesc  = NULL;
+                pstcEthHandle->stcRxFrame.u32SegCount = 1U;
+                /* Point to next descriptor */
+                pstcEthHandle->stcRxDesc = (stc_eth_dma_desc_t*)(pstcEthHandle->stcRxDesc->u32Buffer2NextDescAddr);
+            }
+            /* Check if intermediate segment */
+            else if (0UL == (pstcEthHandle->stcRxDesc->u32ControlStatus & (ETH_DMARXDESC_RFS | ETH_DMARXDESC_RLS)))
+            {
+                pstcEthHandle->stcRxFrame.u32SegCount++;
+                /* Point to next descriptor */
+                pstcEthHandle->stcRxDesc = (stc_eth_dma_desc_t*)(pstcEthHandle->stcRxDesc->u32Buffer2NextDescAddr);
+            }
+            /* Last segment */
+            else
+            {
+                pstcEthHandle->stcRxFrame.u32SegCount++;
+                /* Last segment */
+                pstcEthHandle->stcRxFrame.pstcLSDesc = pstcEthHandle->stcRxDesc;
+                /* Check if last segment is first segment */
+                if (1U == pstcEthHandle->stcRxFrame.u32SegCount)
+                {
+                    pstcEthHandle->stcRxFrame.pstcFSDesc = pstcEthHandle->stcRxDesc;
+                }
 
-        /* Set Bus mode register */
-        MODIFY_REG32(M4_ETH->DMA_BUSMODR, ETH_DMA_BUSMODR_CLEAR_MASK,
-                     (pstcDmaInit->u32BurstMode        | pstcDmaInit->u32AddressAlign      | pstcDmaInit->u32RxDMABurstLength     |
-                      pstcDmaInit->u32TxDMABurstLength | pstcDmaInit->u32EnhanceDescriptor | pstcDmaInit->u32DescriptorSkipLength |
-                      pstcDmaInit->u32DMAArbitration   | ETH_DMA_BUSMODR_SPBL));
-        /* Set Operation mode register */
-        MODIFY_REG32(M4_ETH->DMA_OPRMODR, ETH_DMA_OPRMODR_CLEAR_MASK,
-                     (pstcDmaInit->u32DropChecksumErrorFrame    | pstcDmaInit->u32ReceiveStoreForward | pstcDmaInit->u32FlushReceiveFrame |
-                      pstcDmaInit->u32TransmitStoreForward      | pstcDmaInit->u32TransmitThreshold   | pstcDmaInit->u32ForwardErrorFrame |
-                      pstcDmaInit->u32ForwardUndersizeGoodFrame | pstcDmaInit->u32DropJumboFrame      | pstcDmaInit->u32ReceiveThreshold  |
-                      pstcDmaInit->u32SecondFrameOperate));
+                /* Get the Frame Length of the received packet: Strip FCS */
+                pstcEthHandle->stcRxFrame.u32Length = ((pstcEthHandle->stcRxDesc->u32ControlStatus & ETH_DMARXDESC_FRAL) >> ETH_DMARXDESC_FRAME_LENGTHSHIFT) - 4U;
+                /* Get the address of the buffer start address */
+                pstcEthHandle->stcRxFrame.u32Buffer = (pstcEthHandle->stcRxFrame.pstcFSDesc)->u32Buffer1Addr;
+                /* Get the checksum status */
+                pstcEthHandle->stcRxFrame.u32ChecksumStatus = ETH_DMA_RxChecksumStatus(pstcEthHandle->stcRxDesc->u32ControlStatus,
+                                                                                       pstcEthHandle->stcRxDesc->u32ExtendStatus);
+                /* Pointer to next descriptor */
+                pstcEthHandle->stcRxDesc = (stc_eth_dma_desc_t*)(pstcEthHandle->stcRxDesc->u32Buffer2NextDescAddr);
+                /* Get success */
+                enRet = Ok;
+            }
+        }
     }
 
     return enRet;
 }
 
 /**
- * @brief  Set the fields of structure stc_eth_dma_init_t to default values.
- * @param  [out] pstcDmaInit                Pointer to a @ref stc_eth_dma_init_t structure
+ * @brief  Fill each stc_eth_dma_tx_frame_t member with default value.
+ * @param  [out] pstcTxFrame                Pointer to a @ref stc_eth_dma_tx_frame_t structure
  * @retval An en_result_t enumeration value:
- *           - Ok: Structure Initialize success
- *           - ErrorInvalidParameter: pstcDmaInit == NULL
+ *           - Ok: stc_eth_dma_tx_frame_t member initialize success
+ *           - ErrorInvalidParameter: pstcTxFrame == NULL
  */
-en_result_t ETH_DMA_StructInit(stc_eth_dma_init_t *pstcDmaInit)
+en_result_t ETH_DMA_TxFrameStructInit(stc_eth_dma_tx_frame_t *pstcTxFrame)
 {
     en_result_t enRet = Ok;
 
-    if (NULL == pstcDmaInit)
+    if (NULL == pstcTxFrame)
     {
         enRet = ErrorInvalidParameter;
     }
     else
     {
-        pstcDmaInit->u32BurstMode                 = ETH_DMA_BURST_MODE_FIXED;
-        pstcDmaInit->u32AddressAlign              = ETH_DMA_ADDRESS_ALIGN_DISABLE;
-        pstcDmaInit->u32RxDMABurstLength          = ETH_DMA_RX_BURST_LENGTH_32BEAT;
-        pstcDmaInit->u32TxDMABurstLength          = ETH_DMA_TX_BURST_LENGTH_32BEAT;
-        pstcDmaInit->u32EnhanceDescriptor         = ETH_DMA_ENHANCE_DESCRIPTOR_ENABLE;
-        pstcDmaInit->u32DescriptorSkipLength      = 0U;
-        pstcDmaInit->u32DMAArbitration            = ETH_DMA_ARBITRATION_LOOP_RXTX_1_1;
-        pstcDmaInit->u32DropChecksumErrorFrame    = ETH_DMA_DROP_CHECKSUM_ERRORFRAME_ENABLE;
-        pstcDmaInit->u32ReceiveStoreForward       = ETH_DMA_RECEIVE_STORE_FORWARD_ENABLE;
-        pstcDmaInit->u32FlushReceiveFrame         = ETH_DMA_FLUSH_RECEIVEDFRAME_ENABLE;
-        pstcDmaInit->u32TransmitStoreForward      = ETH_DMA_TRANSMIT_STORE_FORWARD_ENABLE;
-        pstcDmaInit->u32TransmitThreshold         = ETH_DMA_TRANSMIT_THRESHOLD_64BYTE;
-        pstcDmaInit->u32ForwardErrorFrame         = ETH_DMA_FORWARD_ERRORFRAME_DISABLE;
-        pstcDmaInit->u32ForwardUndersizeGoodFrame = ETH_DMA_FORWARD_UNDERSIZE_GOODFRAME_DISABLE;
-        pstcDmaInit->u32DropJumboFrame            = ETH_DMA_DROP_JUMBO_FRAME_DISABLE;
-        pstcDmaInit->u32ReceiveThreshold          = ETH_DMA_RECEIVE_THRESHOLD_64BYTE;
-        pstcDmaInit->u32SecondFrameOperate        = ETH_DMA_SECONDFRAME_OPERARTE_ENABLE;
+        pstcTxFrame->pstcSeg         = NULL;
+        pstcTxFrame->u32SegCount     = 0UL;
+        pstcTxFrame->pvArg           = NULL;
+        pstcTxFrame->enTimeStamp     = Disable;
+        pstcTxFrame->enCpltInt       = Enable;
+        pstcTxFrame->u32ChecksumMode = ETH_DMATXDESC_CHECKSUM_TCPUDPICMP_FULL;
     }
 
     return enRet;
 }
 
 /**
- * @brief  Set DMA software reset.
- * @param  None
+ * @brief  Set DMA transmit frame from caller buffers, without copy.
+ * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @param  [in] pstcTxFrame                 Pointer to a @ref stc_eth_dma_tx_frame_t structure
  * @retval An en_result_t enumeration value:
- *           - Ok: Software reset success
- *           - ErrorTimeout: Reset timeout
- */
-en_result_t ETH_DMA_SoftwareReset(void)
+ *           - Ok: Set transmit frame success
+ *           - ErrorInvalidParameter: pstcEthHandle == NULL or pstcTxFrame == NULL or invalid segment
+ *           - ErrorInvalidMode: The Tx list is not a zero-copy list
+ *           - ErrorBufferFull: Not enough free Tx descriptors, reclaim the sent frames first
+ * @note   The Tx list must be initialized by ETH_DMA_TxDescListInit() with au8TxBuffer == NULL.
+ *         Each segment takes one descriptor (TDES3 holds the next descriptor in chain mode),
+ *         and the segment buffers must not be changed until ETH_DMA_ReclaimTransmitFrame()
+ *         has given back pvArg.
+ */
+en_result_t ETH_DMA_SetTransmitSegments(stc_eth_handle_t *pstcEthHandle, const stc_eth_dma_tx_frame_t *pstcTxFrame)
 {
-    __IO uint32_t u32Count;
+    uint32_t i;
+    uint32_t u32Queued;
+    stc_eth_dma_desc_t *pstcTxDesc;
+    stc_eth_dma_desc_t *pstcFSDesc;
     en_result_t enRet = Ok;
 
-    WRITE_REG32(bM4_ETH->DMA_BUSMODR_b.SWR, 1U);
-    u32Count = ETH_TIMEOUT_SOFTWARE_RESET * (HCLK_VALUE / 20000UL);
-    do
+    if ((NULL == pstcEthHandle) || (NULL == pstcTxFrame) ||
+        (NULL == pstcTxFrame->pstcSeg) || (0UL == pstcTxFrame->u32SegCount))
     {
-        if (u32Count-- == 0UL)
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        DDL_ASSERT(IS_FUNCTIONAL_STATE(pstcTxFrame->enTimeStamp));
+        DDL_ASSERT(IS_FUNCTIONAL_STATE(pstcTxFrame->enCpltInt));
+        DDL_ASSERT(IS_ETH_DMATXDESC_CHECKSUM_CONTROL(pstcTxFrame->u32ChecksumMode));
+
+        for (i=0UL; i<pstcTxFrame->u32SegCount; i++)
         {
-            enRet = ErrorTimeout;
-            break;
+            if ((NULL == pstcTxFrame->pstcSeg[i].pu8Buffer) || (0UL == pstcTxFrame->pstcSeg[i].u32Length) ||
+                (pstcTxFrame->pstcSeg[i].u32Length > ETH_DMATXDESC_TBS1))
+            {
+                enRet = ErrorInvalidParameter;
+                break;
+            }
         }
-    } while (0UL != READ_REG32(bM4_ETH->DMA_BUSMODR_b.SWR));
 
-    return enRet;
-}
+        if (Ok == enRet)
+        {
+            u32Queued = pstcEthHandle->u32TxDescQueued;
+            if (0UL == pstcEthHandle->u32TxDescCnt)
+            {
+                enRet = ErrorInvalidMode;
+            }
+            else if (pstcTxFrame->u32SegCount > (pstcEthHandle->u32TxDescCnt - (u32Queued - pstcEthHandle->u32TxDescReclaimed)))
+            {
+                enRet = ErrorBufferFull;
+            }
+            else
+            {
+                pstcFSDesc = pstcEthHandle->stcTxDesc;
+                pstcTxDesc = pstcFSDesc;
+                for (i=0UL; i<pstcTxFrame->u32SegCount; i++)
+                {
+                    /* Map the segment onto Buffer1 */
+                    pstcTxDesc->u32Buffer1Addr = (uint32_t)pstcTxFrame->pstcSeg[i].pu8Buffer;
+                    MODIFY_REG32(pstcTxDesc->u32ControlBufferSize, ETH_DMATXDESC_TBS1, pstcTxFrame->pstcSeg[i].u32Length);
+                    CLEAR_REG32_BIT(pstcTxDesc->u32ControlStatus, (ETH_DMATXDESC_TFS | ETH_DMATXDESC_TLS |
+                                                                   ETH_DMATXDESC_TTSE | ETH_DMATXDESC_IOC));
+                    if (0UL == i)
+                    {
+                        SET_REG32_BIT(pstcTxDesc->u32ControlStatus, ETH_DMATXDESC_TFS);
+                        MODIFY_REG32(pstcTxDesc->u32ControlStatus, ETH_DMATXDESC_CIC, pstcTxFrame->u32ChecksumMode);
+                        if (Enable == pstcTxFrame->enTimeStamp)
+                        {
+                            SET_REG32_BIT(pstcTxDesc->u32ControlStatus, ETH_DMATXDESC_TTSE);
+                        }
+                    }
+                    else
+                    {
+                        /* The first descriptor is given to the DMA at last */
+                        SET_REG32_BIT(pstcTxDesc->u32ControlStatus, ETH_DMATXDESC_OWN);
+                    }
 
-/**
- * @brief  Set DMA Transmit priority ratio.
- * @param  [in] u32PrioRatio                Priority ratio
- *         This parameter can be one of the following values:
- *           @arg ETH_DMA_ARBITRATION_LOOP_RXTX_1_1:        Rx:Tx = 1:1
- *           @arg ETH_DMA_ARBITRATION_LOOP_RXTX_2_1:        Rx:Tx = 2:1
- *           @arg ETH_DMA_ARBITRATION_LOOP_RXTX_3_1:        Rx:Tx = 3:1
- *           @arg ETH_DMA_ARBITRATION_LOOP_RXTX_4_1:        Rx:Tx = 4:1
- *           @arg ETH_DMA_ARBITRATION_LOOP_TXRX_1_1:        Tx:Rx = 1:1
- *           @arg ETH_DMA_ARBITRATION_LOOP_TXRX_2_1:        Tx:Rx = 2:1
- *           @arg ETH_DMA_ARBITRATION_LOOP_TXRX_3_1:        Tx:Rx = 3:1
- *           @arg ETH_DMA_ARBITRATION_LOOP_TXRX_4_1:        Tx:Rx = 4:1
- *           @arg ETH_DMA_ARBITRATION_FIXED_RXPRIORTX:      Fixed priority: Rx is higher than Tx
- *           @arg ETH_DMA_ARBITRATION_FIXED_TXPRIORRX:      Fixed priority: Tx is higher than Rx
- * @retval None
- */
-void ETH_DMA_SetTransPrioRatio(uint32_t u32PrioRatio)
-{
-    /* Check parameters */
-    DDL_ASSERT(IS_ETH_DMA_PRIORITY_ARBITRATION(u32PrioRatio));
+                    if ((pstcTxFrame->u32SegCount - 1UL) == i)
+                    {
+                        SET_REG32_BIT(pstcTxDesc->u32ControlStatus, ETH_DMATXDESC_TLS);
+                        if (Enable == pstcTxFrame->enCpltInt)
+                        {
+                            SET_REG32_BIT(pstcTxDesc->u32ControlStatus, ETH_DMATXDESC_IOC);
+                        }
+                        /* TDES5 is not used by the DMA for Tx: keep the caller argument in it */
+                        pstcTxDesc->Reserved = (uint32_t)pstcTxFrame->pvArg;
+                    }
+                    pstcTxDesc = (stc_eth_dma_desc_t *)(pstcTxDesc->u32Buffer2NextDescAddr);
+                }
 
-    MODIFY_REG32(M4_ETH->DMA_BUSMODR,
-                 (ETH_DMA_BUSMODR_TXPR | ETH_DMA_BUSMODR_PRAT | ETH_DMA_BUSMODR_DMAA),
-                 u32PrioRatio);
-}
+                SET_REG32_BIT(pstcFSDesc->u32ControlStatus, ETH_DMATXDESC_OWN);
+                pstcEthHandle->stcTxDesc = pstcTxDesc;
+                pstcEthHandle->u32TxDescQueued = u32Queued + pstcTxFrame->u32SegCount;
 
-/**
- * @brief  Set DMA Rx watchdog counter.
- * @param  [in] u8Value                     The value of Watchdog timer
- * @retval None
- */
-void ETH_DMA_SetRxWatchdogCounter(uint8_t u8Value)
-{
-    WRITE_REG32(M4_ETH->DMA_REVWDTR, u8Value);
+                /* When Tx Buffer unavailable flag is set: resume transmission */
+                if (0UL != (READ_REG32_BIT(M4_ETH->DMA_DMASTSR, ETH_DMA_DMASTSR_TUS)))
+                {
+                    WRITE_REG32(M4_ETH->DMA_TXPOLLR, 0U);
+                }
+            }
+        }
+    }
+
+    return enRet;
 }
 
 /**
- * @brief  Flush transmit FIFO.
- * @param  None
+ * @brief  Reclaim the oldest frame set by ETH_DMA_SetTransmitSegments() once the DMA has
+ *         released all of its descriptors.
+ * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @param  [out] ppvArg                     The pvArg of the frame, its segment buffers are free
  * @retval An en_result_t enumeration value:
- *           - Ok: Flush transmit FIFO success
- *           - ErrorTimeout: Flush timeout
- */
-en_result_t ETH_DMA_FlushTransmitFIFO(void)
+ *           - Ok: A frame has been reclaimed
+ *           - ErrorInvalidParameter: pstcEthHandle == NULL or ppvArg == NULL
+ *           - ErrorBufferEmpty: No frame to reclaim
+ *           - ErrorNotReady: The oldest frame is still owned by the DMA
+ * @note   The sender and the reclaimer may run in different contexts (e.g. thread and
+ *         ETH interrupt), but each of them in one context only.
+ */
+en_result_t ETH_DMA_ReclaimTransmitFrame(stc_eth_handle_t *pstcEthHandle, void **ppvArg)
 {
-    __IO uint32_t u32Count;
-    en_result_t enRet = Ok;
+    stc_eth_dma_tx_cplt_t stcCplt;
+    en_result_t enRet;
 
-    WRITE_REG32(bM4_ETH->DMA_OPRMODR_b.FTF, 1U);
-    u32Count = ETH_TIMEOUT_WRITE_REGISTER * (HCLK_VALUE / 20000UL);
-    do
+    if ((NULL == pstcEthHandle) || (NULL == ppvArg))
     {
-        if (u32Count-- == 0UL)
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        enRet = ETH_DMA_TxReclaimFrame(pstcEthHandle, &stcCplt);
+        if (Ok == enRet)
         {
-            enRet = ErrorTimeout;
-            break;
+            *ppvArg = stcCplt.pvArg;
         }
-    } while (0UL != READ_REG32(bM4_ETH->DMA_OPRMODR_b.FTF));
+    }
 
     return enRet;
 }
 
 /**
- * @brief  Enable or disable DMA transmit.
- * @param  [in] enNewSta                    The function new state.
- *           @arg This parameter can be: Enable or Disable.
- * @retval None
+ * @brief  Initialize a Tx completion queue.
+ * @param  [in] pstcQueue                   Pointer to a @ref stc_eth_dma_tx_cplt_queue_t structure
+ * @param  [in] astcBuf                     Buffer of the queue
+ * @param  [in] u32Size                     Number of entries in astcBuf, a power of 2
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcQueue == NULL or astcBuf == NULL or invalid u32Size
  */
-void ETH_DMA_TransmitCmd(en_functional_state_t enNewSta)
+en_result_t ETH_DMA_TxCpltQueueInit(stc_eth_dma_tx_cplt_queue_t *pstcQueue, stc_eth_dma_tx_cplt_t astcBuf[], uint32_t u32Size)
 {
-    /* Check parameters */
-    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewSta));
-
-    WRITE_REG32(bM4_ETH->DMA_OPRMODR_b.STT, enNewSta);
-}
+    en_result_t enRet = Ok;
 
-/**
- * @brief  Enable or disable DMA receive.
- * @param  [in] enNewSta                    The function new state.
- *           @arg This parameter can be: Enable or Disable.
- * @retval None
- */
-void ETH_DMA_ReceiveCmd(en_functional_state_t enNewSta)
-{
-    /* Check parameters */
-    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewSta));
+    if ((NULL == pstcQueue) || (NULL == astcBuf) || (0UL == u32Size) || (0UL != (u32Size & (u32Size - 1UL))))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        pstcQueue->pstcBuf = astcBuf;
+        pstcQueue->u32Size = u32Size;
+        pstcQueue->u32Head = 0UL;
+        pstcQueue->u32Tail = 0UL;
+    }
 
-    WRITE_REG32(bM4_ETH->DMA_OPRMODR_b.STR, enNewSta);
+    return enRet;
 }
 
 /**
- * @brief  Enable or disable DMA interrupt.
- * @param  [in] u32IntSrc                   DMA interrupt source
- *         This parameter can be one or any combination of the following values:
- *           @arg ETH_DMA_INT_NIE:          Normal interrupt summary
- *           @arg ETH_DMA_INT_AIE:          Abnormal interrupt summary
- *           @arg ETH_DMA_INT_ERE:          Early receive interrupt
- *           @arg ETH_DMA_INT_FBE:          Fatal bus error interrupt
- *           @arg ETH_DMA_INT_ETE:          Early transmit interrupt
- *           @arg ETH_DMA_INT_RWE:          Receive watchdog timeout interrupt
- *           @arg ETH_DMA_INT_RSE:          Receive process stopped interrupt
- *           @arg ETH_DMA_INT_RUE:          Receive buffer unavailable interrupt
- *           @arg ETH_DMA_INT_RIE:          Receive interrupt
- *           @arg ETH_DMA_INT_UNE:          Transmit Underflow interrupt
- *           @arg ETH_DMA_INT_OVE:          Receive Overflow interrupt
- *           @arg ETH_DMA_INT_TJE:          Transmit jabber timeout interrupt
- *           @arg ETH_DMA_INT_TUE:          Transmit buffer unavailable interrupt
- *           @arg ETH_DMA_INT_TSE:          Transmit process stopped interrupt
- *           @arg ETH_DMA_INT_TIE:          Transmit interrupt
- * @param  [in] enNewSta                    The function new state.
- *           @arg This parameter can be: Enable or Disable.
- * @retval None
- */
-void ETH_DMA_IntCmd(uint32_t u32IntSrc, en_functional_state_t enNewSta)
+ * @brief  Reclaim all the frames the DMA has sent into a Tx completion queue.
+ * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @param  [in] pstcQueue                   Pointer to a @ref stc_eth_dma_tx_cplt_queue_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: All the sent frames have been reclaimed
+ *           - ErrorInvalidParameter: pstcEthHandle == NULL or pstcQueue == NULL
+ *           - ErrorBufferFull: The queue is full, the remaining frames are left for the next call
+ * @note   Call it from the ETH interrupt handler on ETH_DMA_FLAG_TIS (see enCpltInt of
+ *         @ref stc_eth_dma_tx_frame_t), and take the completions by ETH_DMA_GetTransmitCplt()
+ *         in thread context, where the buffers can be freed.
+ */
+en_result_t ETH_DMA_ReclaimTransmitFrame_Interrupt(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_tx_cplt_queue_t *pstcQueue)
 {
-    /* Check parameters */
-    DDL_ASSERT(IS_ETH_DMA_INTERRUPT(u32IntSrc));
-    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewSta));
+    uint32_t u32Head;
+    en_result_t enRet = Ok;
 
-    if (Disable != enNewSta)
+    if ((NULL == pstcEthHandle) || (NULL == pstcQueue) || (NULL == pstcQueue->pstcBuf))
     {
-        SET_REG32_BIT(M4_ETH->DMA_INTENAR, u32IntSrc);
+        enRet = ErrorInvalidParameter;
     }
     else
     {
-        CLEAR_REG32_BIT(M4_ETH->DMA_INTENAR, u32IntSrc);
-    }
-}
+        u32Head = pstcQueue->u32Head;
+        while (Ok == enRet)
+        {
+            if ((u32Head - pstcQueue->u32Tail) >= pstcQueue->u32Size)
+            {
+                enRet = ErrorBufferFull;
+            }
+            else
+            {
+                enRet = ETH_DMA_TxReclaimFrame(pstcEthHandle, &pstcQueue->pstcBuf[u32Head & (pstcQueue->u32Size - 1UL)]);
+                if (Ok == enRet)
+                {
+                    u32Head++;
+                    pstcQueue->u32Head = u32Head;
+                }
+            }
+        }
 
-/**
- * @brief  Get DMA flag status.
- * @param  [in] u32Flag                     DMA flag type
- *         This parameter can be one or any combination of the following values:
- *           @arg ETH_DMA_FLAG_PTPS:        Time-stamp trigger status
- *           @arg ETH_DMA_FLAG_PMTS:        PMT trigger status
- *           @arg ETH_DMA_FLAG_MMCS:        MMC trigger status
- *           @arg ETH_DMA_FLAG_NIS:         Normal interrupt summary flag
- *           @arg ETH_DMA_FLAG_AIS:         Abnormal interrupt summary flag
- *           @arg ETH_DMA_FLAG_ERS:         Early receive flag
- *           @arg ETH_DMA_FLAG_FBS:         Fatal bus error flag
- *           @arg ETH_DMA_FLAG_ETS:         Early transmit flag
- *           @arg ETH_DMA_FLAG_RWS:         Receive watchdog timeout flag
- *           @arg ETH_DMA_FLAG_RSS:         Receive stopped flag
- *           @arg ETH_DMA_FLAG_RUS:         Receive buffer unavailable flag
- *           @arg ETH_DMA_FLAG_RIS:         Receive flag
- *           @arg ETH_DMA_FLAG_UNS:         Transmit Underflow flag
- *           @arg ETH_DMA_FLAG_OVS:         Receive Overflow flag
- *           @arg ETH_DMA_FLAG_TJS:         Transmit jabber timeout flag
- *           @arg ETH_DMA_FLAG_TUS:         Transmit buffer unavailable flag
- *           @arg ETH_DMA_FLAG_TSS:         Transmit stopped flag
- *           @arg ETH_DMA_FLAG_TIS:         Transmit interrupt flag
- * @retval An en_flag_status_t enumeration value:
- *           - Set: Flag is set
- *           - Reset: Flag is reset
+        if (ErrorBufferFull != enRet)
+        {
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Take a completion from a Tx completion queue.
+ * @param  [in] pstcQueue                   Pointer to a @ref stc_eth_dma_tx_cplt_queue_t structure
+ * @param  [out] pstcCplt                   Pointer to a @ref stc_eth_dma_tx_cplt_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Get completion success
+ *           - ErrorInvalidParameter: pstcQueue == NULL or pstcCplt == NULL
+ *           - ErrorBufferEmpty: The queue is empty
  */
-en_flag_status_t ETH_DMA_GetStatus(uint32_t u32Flag)
+en_result_t ETH_DMA_GetTransmitCplt(stc_eth_dma_tx_cplt_queue_t *pstcQueue, stc_eth_dma_tx_cplt_t *pstcCplt)
 {
-    en_flag_status_t enFlagSta = Reset;
-
-    /* Check parameters */
-    DDL_ASSERT(IS_ETH_DMA_FLAG(u32Flag));
+    uint32_t u32Tail;
+    en_result_t enRet = Ok;
 
-    if (0UL != (READ_REG32_BIT(M4_ETH->DMA_DMASTSR, u32Flag)))
+    if ((NULL == pstcQueue) || (NULL == pstcCplt) || (NULL == pstcQueue->pstcBuf))
     {
-        enFlagSta = Set;
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        u32Tail = pstcQueue->u32Tail;
+        if (u32Tail == pstcQueue->u32Head)
+        {
+            enRet = ErrorBufferEmpty;
+        }
+        else
+        {
+            *pstcCplt = pstcQueue->pstcBuf[u32Tail & (pstcQueue->u32Size - 1UL)];
+            pstcQueue->u32Tail = u32Tail + 1UL;
+        }
     }
 
-    return enFlagSta;
+    return enRet;
 }
 
 /**
- * @brief  Get DMA overflow flag status.
- * @param  [in] u32Flag                     DMA overflow flag type
- *         This parameter can be one of the following values:
- *           @arg ETH_DMA_OVERFLOW_RXFIFO_COUNTER:          Overflow bit for FIFO overflow counter
- *           @arg ETH_DMA_OVERFLOW_MISSFRAME_COUNTER:       Overflow bit for miss frame counter
- * @retval An en_flag_status_t enumeration value:
- *           - Set: Flag is set
- *           - Reset: Flag is reset
+ * @brief  Initialize an Rx buffer pool, empty. Fill it by ETH_DMA_RxPoolPut().
+ * @param  [in] pstcPool                    Pointer to a @ref stc_eth_dma_rx_pool_t structure
+ * @param  [in] apu8Ring                    Ring of buffer pointers used by the pool
+ * @param  [in] u32Size                     Number of entries in apu8Ring, a power of 2
+ * @param  [in] u32BufSize                  Size of each buffer, a multiple of 4 up to 0x1FFC.
+ *                                          ETH_RXBUF_SIZE or more keeps a frame in one buffer.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcPool == NULL or apu8Ring == NULL or invalid size
  */
-en_flag_status_t ETH_DMA_GetOvfStatus(uint32_t u32Flag)
+en_result_t ETH_DMA_RxPoolInit(stc_eth_dma_rx_pool_t *pstcPool, uint8_t *apu8Ring[], uint32_t u32Size, uint32_t u32BufSize)
 {
-    en_flag_status_t enFlagSta = Reset;
-
-    /* Check parameters */
-    DDL_ASSERT(IS_ETH_DMA_MISS_FRAME_TYPE(u32Flag));
+    en_result_t enRet = Ok;
 
-    if (0UL != (READ_REG32_BIT(M4_ETH->DMA_RFRCNTR, u32Flag)))
+    if ((NULL == pstcPool) || (NULL == apu8Ring) || (0UL == u32Size) || (0UL != (u32Size & (u32Size - 1UL))) ||
+        (0UL == u32BufSize) || (0UL != (u32BufSize & 3UL)) || (u32BufSize > ETH_DMARXDESC_RBS1))
     {
-        enFlagSta = Set;
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        pstcPool->ppu8Buf    = apu8Ring;
+        pstcPool->u32Size    = u32Size;
+        pstcPool->u32BufSize = u32BufSize;
+        pstcPool->u32Head    = 0UL;
+        pstcPool->u32Tail    = 0UL;
     }
 
-    return enFlagSta;
+    return enRet;
 }
 
-/******************************************************************************/
-/*                          DMA descriptor Functions                          */
-/******************************************************************************/
 /**
- * @brief  Initializes DMA Tx descriptor in chain mode.
- * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
- * @param  [in] astcTxDescTab               Pointer to the first Tx desc list
- * @param  [in] au8TxBuffer                 Pointer to the first TxBuffer list
- * @param  [in] u32TxBufferCnt              Number of the Tx desc in the list
+ * @brief  Give a free buffer to an Rx buffer pool.
+ * @param  [in] pstcPool                    Pointer to a @ref stc_eth_dma_rx_pool_t structure
+ * @param  [in] pu8Buffer                   Buffer of pstcPool->u32BufSize bytes, 4-byte aligned
  * @retval An en_result_t enumeration value:
- *           - Ok: Initializes Tx chain mode success
- *           - ErrorInvalidParameter: pstcEthHandle == NULL or astcTxDescTab == NULL or
- *                                    au8TxBuffer == NULL or u32TxBufferCnt == 0
+ *           - Ok: Put success
+ *           - ErrorInvalidParameter: pstcPool == NULL or pu8Buffer == NULL
+ *           - ErrorBufferFull: The pool is full
+ * @note   The buffers are put and taken in different contexts without locking,
+ *         but this function must only be called from one context.
  */
-en_result_t ETH_DMA_TxDescListInit(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_desc_t astcTxDescTab[], const uint8_t au8TxBuffer[], uint32_t u32TxBufferCnt)
+en_result_t ETH_DMA_RxPoolPut(stc_eth_dma_rx_pool_t *pstcPool, uint8_t *pu8Buffer)
 {
-    uint32_t i;
-    stc_eth_dma_desc_t *pstcTxDesc;
+    uint32_t u32Head;
     en_result_t enRet = Ok;
 
-    if ((NULL == pstcEthHandle) || (NULL == astcTxDescTab) || (NULL == au8TxBuffer) || (0UL== u32TxBufferCnt))
+    if ((NULL == pstcPool) || (NULL == pu8Buffer) || (NULL == pstcPool->ppu8Buf))
     {
         enRet = ErrorInvalidParameter;
     }
     else
     {
-        /* Set the DMATxDesc pointer with the first in the astcTxDescTab list */
-        pstcEthHandle->stcTxDesc = astcTxDescTab;
-
-        /* Fill each DMATxDesc descriptor */
-        for (i=0U; i<u32TxBufferCnt; i++)
+        u32Head = pstcPool->u32Head;
+        if ((u32Head - pstcPool->u32Tail) >= pstcPool->u32Size)
         {
-            pstcTxDesc = &astcTxDescTab[i];
-            /* Set Second Address Chained */
-            pstcTxDesc->u32ControlStatus = ETH_DMATXDESC_TSAC;
-            /* Set Buffer1 address pointer */
-            pstcTxDesc->u32Buffer1Addr = (uint32_t)(&au8TxBuffer[i * ETH_TXBUF_SIZE]);
-            /* Set the DMA Tx descriptors checksum insertion */
-            if (ETH_MAC_CHECKSUM_MODE_HARDWARE == pstcEthHandle->stcCommInit.u32ChecksumMode)
-            {
-                SET_REG32_BIT(pstcTxDesc->u32ControlStatus, ETH_DMATXDESC_CIC_TCPUDPICMP_FULL);
-            }
-
-            /* Initialize the next descriptor with the Next Descriptor Polling */
-            if (i < (u32TxBufferCnt - 1U))
-            {
-                pstcTxDesc->u32Buffer2NextDescAddr = (uint32_t)(&astcTxDescTab[i + 1U]);
-            }
-            else
-            {
-                pstcTxDesc->u32Buffer2NextDescAddr = (uint32_t)astcTxDescTab;
-            }
+            enRet = ErrorBufferFull;
+        }
+        else
+        {
+            pstcPool->ppu8Buf[u32Head & (pstcPool->u32Size - 1UL)] = pu8Buffer;
+            pstcPool->u32Head = u32Head + 1UL;
         }
-
-        /* Set Transmit Descriptor List Address Register */
-        WRITE_REG32(M4_ETH->DMA_TXDLADR, (uint32_t)astcTxDescTab);
     }
 
     return enRet;
 }
 
 /**
- * @brief  Initializes DMA Rx descriptor in chain mode.
+ * @brief  Initializes DMA Rx descriptor in chain mode with buffers from a pool.
  * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
  * @param  [in] astcRxDescTab               Pointer to the first Rx desc list
- * @param  [in] au8RxBuffer                 Pointer to the first RxBuffer list
- * @param  [in] u32RxBufferCnt              Number of the Rx desc in the list
+ * @param  [in] u32RxDescCnt                Number of the Rx desc in the list
+ * @param  [in] pstcPool                    Pointer to a @ref stc_eth_dma_rx_pool_t structure
+ *                                          holding u32RxDescCnt buffers or more
  * @retval An en_result_t enumeration value:
  *           - Ok: Initializes Rx chain mode success
  *           - ErrorInvalidParameter: pstcEthHandle == NULL or astcRxDescTab == NULL or
- *                                    au8RxBuffer == NULL or u32RxBufferCnt == 0
+ *                                    u32RxDescCnt == 0 or pstcPool == NULL
+ *           - ErrorBufferEmpty: Not enough buffers in the pool
+ * @note   The frames of this list are taken by ETH_DMA_TakeReceiveFrame().
  */
-en_result_t ETH_DMA_RxDescListInit(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_desc_t astcRxDescTab[], const uint8_t au8RxBuffer[], uint32_t u32RxBufferCnt)
+en_result_t ETH_DMA_RxDescListPoolInit(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_desc_t astcRxDescTab[], uint32_t u32RxDescCnt, stc_eth_dma_rx_pool_t *pstcPool)
 {
     uint32_t i;
     stc_eth_dma_desc_t *pstcRxDesc;
     en_result_t enRet = Ok;
 
-    if ((NULL == pstcEthHandle) || (NULL == astcRxDescTab) || (NULL == au8RxBuffer) || (0UL == u32RxBufferCnt))
+    if ((NULL == pstcEthHandle) || (NULL == astcRxDescTab) || (0UL == u32RxDescCnt) ||
+        (NULL == pstcPool) || (NULL == pstcPool->ppu8Buf))
     {
         enRet = ErrorInvalidParameter;
     }
+    else if ((pstcPool->u32Head - pstcPool->u32Tail) < u32RxDescCnt)
+    {
+        enRet = ErrorBufferEmpty;
+    }
     else
     {
-        /* Set the DMARxDesc pointer with the first in the astcRxDescTab list */
-        pstcEthHandle->stcRxDesc = astcRxDescTab;
+        pstcEthHandle->stcRxDesc    = astcRxDescTab;
+        pstcEthHandle->pstcRxPool   = pstcPool;
+        pstcEthHandle->u32RxDescCnt = u32RxDescCnt;
 
-        /* Fill each DMARxDesc descriptor */
-        for (i=0UL; i<u32RxBufferCnt; i++)
+        for (i=0UL; i<u32RxDescCnt; i++)
         {
             pstcRxDesc = &astcRxDescTab[i];
-            /* Set Own bit of the Rx descriptor */
-            pstcRxDesc->u32ControlStatus     = ETH_DMARXDESC_OWN;
-            /* Set Buffer1 size and Second Address Chained */
-            pstcRxDesc->u32ControlBufferSize = ETH_RXBUF_SIZE | ETH_DMARXDESC_RSAC;
-            /* Set Buffer1 address pointer */
-            pstcRxDesc->u32Buffer1Addr       = (uint32_t)(&au8RxBuffer[i * ETH_RXBUF_SIZE]);
-            /* Set the DMA Rx Descriptor interrupt */
-            if (ETH_RX_MODE_INTERRUPT == pstcEthHandle->stcCommInit.u32RxMode)
-            {
-                CLEAR_REG32_BIT(pstcRxDesc->u32ControlBufferSize, ETH_DMARXDESC_DIC);
-            }
-
-            /* Initialize the next descriptor with the Next Descriptor Polling */
-            if (i < (u32RxBufferCnt - 1U))
+            pstcRxDesc->u32ControlBufferSize = pstcPool->u32BufSize | ETH_DMARXDESC_RSAC;
+            pstcRxDesc->u32Buffer1Addr       = (uint32_t)ETH_DMA_RxPoolGet(pstcPool);
+            if (i < (u32RxDescCnt - 1U))
             {
                 pstcRxDesc->u32Buffer2NextDescAddr = (uint32_t)(&astcRxDescTab[i + 1U]);
             }
@@ -2642,6 +4231,7 @@ en_result_t ETH_DMA_RxDescListInit(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_
             {
                 pstcRxDesc->u32Buffer2NextDescAddr = (uint32_t)astcRxDescTab;
             }
+            pstcRxDesc->u32ControlStatus     = ETH_DMARXDESC_OWN;
         }
 
         /* Set Receive Descriptor List Address Register */
@@ -2652,98 +4242,78 @@ en_result_t ETH_DMA_RxDescListInit(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_
 }
 
 /**
- * @brief  Set DMA transmit frame.
+ * @brief  Take the next received frame without copy: the filled buffer is handed to
+ *         the caller and the descriptor is given back to the DMA with a buffer from the pool.
  * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
- * @param  [in] u32FrameLength              Total of data to be transmit
+ * @param  [out] pstcRxBuf                  Pointer to a @ref stc_eth_dma_rx_buf_t structure
  * @retval An en_result_t enumeration value:
- *           - Ok: Set transmit frame success
- *           - ErrorInvalidParameter: pstcEthHandle == NULL
- *           - ErrorInvalidMode: Descriptor is owned by the DMA
- */
-en_result_t ETH_DMA_SetTransmitFrame(stc_eth_handle_t *pstcEthHandle, uint32_t u32FrameLength)
+ *           - Ok: A frame has been taken
+ *           - ErrorInvalidParameter: pstcEthHandle == NULL or pstcRxBuf == NULL
+ *           - ErrorInvalidMode: The Rx list is not initialized by ETH_DMA_RxDescListPoolInit()
+ *           - ErrorBufferEmpty: The pool is empty, the frame stays in the list until buffers are put
+ *           - Error: No completed frame received
+ * @note   Erroneous frames and frames spanning several descriptors are dropped, and
+ *         their descriptors are given back to the DMA with the same buffer.
+ */
+en_result_t ETH_DMA_TakeReceiveFrame(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_rx_buf_t *pstcRxBuf)
 {
-    uint32_t i;
-    uint32_t u32BufCnt;
-    uint32_t u32Size;
-    en_result_t enRet = Ok;
+    uint32_t u32DescCnt = 0UL;
+    uint32_t u32Status;
+    stc_eth_dma_desc_t *pstcRxDesc;
+    stc_eth_dma_rx_pool_t *pstcPool;
+    en_result_t enRet = Error;
 
-    if ((NULL == pstcEthHandle) || (0U == u32FrameLength))
+    if ((NULL == pstcEthHandle) || (NULL == pstcRxBuf))
     {
         enRet = ErrorInvalidParameter;
     }
+    else if (NULL == pstcEthHandle->pstcRxPool)
+    {
+        enRet = ErrorInvalidMode;
+    }
     else
     {
-        /* Check if the descriptor is owned by the CPU */
-        if (0UL != (pstcEthHandle->stcTxDesc->u32ControlStatus & ETH_DMATXDESC_OWN))
-        {
-            enRet = ErrorInvalidMode;
-        }
-        else
+        pstcPool   = pstcEthHandle->pstcRxPool;
+        pstcRxDesc = pstcEthHandle->stcRxDesc;
+        while ((Error == enRet) && (u32DescCnt < pstcEthHandle->u32RxDescCnt))
         {
-            /* Get the number of needed Tx buffers for the current frame */
-            if (u32FrameLength > ETH_TXBUF_SIZE)
-            {
-                u32BufCnt = u32FrameLength / ETH_TXBUF_SIZE;
-                if (0UL != (u32FrameLength % ETH_TXBUF_SIZE))
-                {
-                    u32BufCnt++;
-                }
-            }
-            else
+            u32Status = pstcRxDesc->u32ControlStatus;
+            if (0UL != (u32Status & ETH_DMARXDESC_OWN))
             {
-                u32BufCnt = 1U;
+                break;
             }
 
-            if (1U == u32BufCnt)
-            {
-                /* Set FIRST and LAST segment */
-                SET_REG32_BIT(pstcEthHandle->stcTxDesc->u32ControlStatus, (ETH_DMATXDESC_TFS | ETH_DMATXDESC_TLS));
-                /* Set frame size */
-                MODIFY_REG32(pstcEthHandle->stcTxDesc->u32ControlBufferSize, ETH_DMATXDESC_TBS1, (u32FrameLength & ETH_DMATXDESC_TBS1));
-                /* Set Own bit of the Tx descriptor */
-                SET_REG32_BIT(pstcEthHandle->stcTxDesc->u32ControlStatus, ETH_DMATXDESC_OWN);
-                /* Point to next descriptor */
-                pstcEthHandle->stcTxDesc = (stc_eth_dma_desc_t *)(pstcEthHandle->stcTxDesc->u32Buffer2NextDescAddr);
-            }
-            else
+            if (((ETH_DMARXDESC_RFS | ETH_DMARXDESC_RLS) == (u32Status & (ETH_DMARXDESC_RFS | ETH_DMARXDESC_RLS | ETH_DMARXDESC_ERSUM))))
             {
-                for (i=0U; i<u32BufCnt; i++)
+                if (pstcPool->u32Head == pstcPool->u32Tail)
                 {
-                    /* Clear FIRST and LAST segment bits */
-                    CLEAR_REG32_BIT(pstcEthHandle->stcTxDesc->u32ControlStatus, (ETH_DMATXDESC_TFS | ETH_DMATXDESC_TLS));
-                    if (0U == i)
-                    {
-                        /* Set the FIRST segment bit */
-                        SET_REG32_BIT(pstcEthHandle->stcTxDesc->u32ControlStatus, ETH_DMATXDESC_TFS);
-                    }
-
-                    if ((u32BufCnt - 1U) == i)
-                    {
-                        /* Set the last segment bit */
-                        SET_REG32_BIT(pstcEthHandle->stcTxDesc->u32ControlStatus, ETH_DMATXDESC_TLS);
-                        u32Size = u32FrameLength - (u32BufCnt - 1U) * ETH_TXBUF_SIZE;
-                        MODIFY_REG32(pstcEthHandle->stcTxDesc->u32ControlBufferSize, ETH_DMATXDESC_TBS1, (u32Size & ETH_DMATXDESC_TBS1));
-                    }
-                    else
-                    {
-                        /* Set frame size */
-                        MODIFY_REG32(pstcEthHandle->stcTxDesc->u32ControlBufferSize, ETH_DMATXDESC_TBS1, (ETH_TXBUF_SIZE & ETH_DMATXDESC_TBS1));
-                    }
-
-                    /* Set Own bit of the Tx descriptor */
-                    SET_REG32_BIT(pstcEthHandle->stcTxDesc->u32ControlStatus, ETH_DMATXDESC_OWN);
-                    /* Pointer to next descriptor */
-                    pstcEthHandle->stcTxDesc = (stc_eth_dma_desc_t *)(pstcEthHandle->stcTxDesc->u32Buffer2NextDescAddr);
+                    enRet = ErrorBufferEmpty;
+                    break;
                 }
+                pstcRxBuf->pu8Buffer         = (uint8_t *)pstcRxDesc->u32Buffer1Addr;
+                pstcRxBuf->u32Length         = ((u32Status & ETH_DMARXDESC_FRAL) >> ETH_DMARXDESC_FRAME_LENGTHSHIFT) - 4U;
+                pstcRxBuf->u32Status         = u32Status;
+                pstcRxBuf->u32ExtendStatus   = pstcRxDesc->u32ExtendStatus;
+                pstcRxBuf->u32TimeStampHigh  = pstcRxDesc->u32TimeStampHigh;
+                pstcRxBuf->u32TimeStampLow   = pstcRxDesc->u32TimeStampLow;
+                pstcRxBuf->u32ChecksumStatus = ETH_DMA_RxChecksumStatus(u32Status, pstcRxDesc->u32ExtendStatus);
+                /* Swap in a free buffer */
+                pstcRxDesc->u32Buffer1Addr   = (uint32_t)ETH_DMA_RxPoolGet(pstcPool);
+                enRet = Ok;
             }
 
-            /* When Tx Buffer unavailable flag is set: clear it and resume transmission */
-            if (0UL != (READ_REG32_BIT(M4_ETH->DMA_DMASTSR, ETH_DMA_DMASTSR_TUS)))
-            {
-                /* Clear DMA TUS flag */
-                /* Resume DMA transmit */
-                WRITE_REG32(M4_ETH->DMA_TXPOLLR, 0U);
-            }
+            /* Give the descriptor back to the DMA */
+            pstcRxDesc->u32ControlStatus = ETH_DMARXDESC_OWN;
+            pstcRxDesc = (stc_eth_dma_desc_t *)(pstcRxDesc->u32Buffer2NextDescAddr);
+            u32DescCnt++;
+        }
+        pstcEthHandle->stcRxDesc = pstcRxDesc;
+
+        /* When Rx Buffer unavailable flag is set: clear it and resume reception */
+        if ((0UL != u32DescCnt) && (0UL != (READ_REG32_BIT(M4_ETH->DMA_DMASTSR, ETH_DMA_DMASTSR_RUS))))
+        {
+            WRITE_REG32(M4_ETH->DMA_DMASTSR, ETH_DMA_DMASTSR_RUS);
+            WRITE_REG32(M4_ETH->DMA_RXPOLLR, 0UL);
         }
     }
 
@@ -2751,129 +4321,93 @@ en_result_t ETH_DMA_SetTransmitFrame(stc_eth_handle_t *pstcEthHandle, uint32_t u
 }
 
 /**
- * @brief  Get DMA receive frame.
+ * @brief  Take a batch of received frames without copy, see ETH_DMA_TakeReceiveFrame().
  * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @param  [out] astcRxBuf                  Array of @ref stc_eth_dma_rx_buf_t structure
+ * @param  [in] u32MaxCnt                   Number of entries in astcRxBuf
+ * @param  [out] pu32Cnt                    Number of frames taken
  * @retval An en_result_t enumeration value:
- *           - Ok: Get receive frame success
- *           - ErrorInvalidParameter: pstcEthHandle == NULL
- *           - Error: Not completed frame received
- */
-en_result_t ETH_DMA_GetReceiveFrame(stc_eth_handle_t *pstcEthHandle)
+ *           - Ok: At least one frame has been taken
+ *           - ErrorInvalidParameter: pstcEthHandle == NULL or astcRxBuf == NULL or
+ *                                    u32MaxCnt == 0 or pu32Cnt == NULL
+ *           - Other: The result of ETH_DMA_TakeReceiveFrame() when no frame has been taken
+ * @note   With ETH_DMA_RxIntCoalesceConfig(), call it from the ETH interrupt handler on
+ *         ETH_DMA_FLAG_RIS until less than u32MaxCnt frames are returned.
+ */
+en_result_t ETH_DMA_TakeReceiveFrames(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_rx_buf_t astcRxBuf[], uint32_t u32MaxCnt, uint32_t *pu32Cnt)
 {
-    en_result_t enRet = Error;
+    uint32_t u32Cnt = 0UL;
+    en_result_t enRet = Ok;
 
-    if (NULL == pstcEthHandle)
+    if ((NULL == pstcEthHandle) || (NULL == astcRxBuf) || (0UL == u32MaxCnt) || (NULL == pu32Cnt))
     {
         enRet = ErrorInvalidParameter;
     }
     else
     {
-        /* Check if segment is not owned by DMA */
-        if (0UL == (pstcEthHandle->stcRxDesc->u32ControlStatus & ETH_DMARXDESC_OWN))
+        while ((Ok == enRet) && (u32Cnt < u32MaxCnt))
         {
-            /* Check if last segment */
-            if (0UL != (pstcEthHandle->stcRxDesc->u32ControlStatus & ETH_DMARXDESC_RLS))
-            {
-                pstcEthHandle->stcRxFrame.u32SegCount++;
-                pstcEthHandle->stcRxFrame.pstcLSDesc = pstcEthHandle->stcRxDesc;
-                /* Check if last segment is first segment */
-                if (1U == pstcEthHandle->stcRxFrame.u32SegCount)
-                {
-                    pstcEthHandle->stcRxFrame.pstcFSDesc = pstcEthHandle->stcRxDesc;
-                }
-
-                /* Get the Frame Length of the received packet: Strip FCS */
-                pstcEthHandle->stcRxFrame.u32Length = ((pstcEthHandle->stcRxDesc->u32ControlStatus & ETH_DMARXDESC_FRAL) >> ETH_DMARXDESC_FRAME_LENGTHSHIFT) - 4U;
-                /* Get the address of the buffer start address */
-                pstcEthHandle->stcRxFrame.u32Buffer = (pstcEthHandle->stcRxFrame.pstcFSDesc)->u32Buffer1Addr;
-                /* Pointer to next descriptor */
-                pstcEthHandle->stcRxDesc              = (stc_eth_dma_desc_t*)(pstcEthHandle->stcRxDesc->u32Buffer2NextDescAddr);
-                /* Get success */
-                enRet = Ok;
-            }
-            /* Check if first segment */
-            else if (0UL != (pstcEthHandle->stcRxDesc->u32ControlStatus & ETH_DMARXDESC_RFS))
-            {
-                pstcEthHandle->stcRxFrame.pstcFSDesc  = pstcEthHandle->stcRxDesc;
-                pstcEthHandle->stcRxFrame.pstcLSDesc  = NULL;
-                pstcEthHandle->stcRxFrame.u32SegCount = 1U;
-                /* Point to next descriptor */
-                pstcEthHandle->stcRxDesc = (stc_eth_dma_desc_t*)(pstcEthHandle->stcRxDesc->u32Buffer2NextDescAddr);
-            }
-            /* Check if intermediate segment */
-            else
+            enRet = ETH_DMA_TakeReceiveFrame(pstcEthHandle, &astcRxBuf[u32Cnt]);
+            if (Ok == enRet)
             {
-                pstcEthHandle->stcRxFrame.u32SegCount++;
-                /* Point to next descriptor */
-                pstcEthHandle->stcRxDesc = (stc_eth_dma_desc_t*)(pstcEthHandle->stcRxDesc->u32Buffer2NextDescAddr);
+                u32Cnt++;
             }
         }
+
+        *pu32Cnt = u32Cnt;
+        if (0UL != u32Cnt)
+        {
+            enRet = Ok;
+        }
     }
 
     return enRet;
 }
 
 /**
- * @brief  Get DMA receive frame in interrupt mode.
+ * @brief  Configure the Rx interrupt coalescing: the receive interrupt is raised once
+ *         every u32FrameCnt descriptors, and by the Rx watchdog for the frames of a burst tail.
  * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @param  [in] u32FrameCnt                 Frames per interrupt, 1 for an interrupt per frame.
+ *                                          This parameter must be a number between Min_Data = 1 and
+ *                                          Max_Data = the Rx descriptor count
+ * @param  [in] u8Watchdog                  Rx watchdog timeout in units of 256 HCLK cycles, counted from
+ *                                          a frame received without interrupt. It must not be 0 if
+ *                                          u32FrameCnt > 1, and is not used if u32FrameCnt == 1.
  * @retval An en_result_t enumeration value:
- *           - Ok: Get receive frame success
- *           - ErrorInvalidParameter: pstcEthHandle == NULL
- *           - Error: Not completed frame received
+ *           - Ok: Configure success
+ *           - ErrorInvalidParameter: pstcEthHandle == NULL or invalid u32FrameCnt or u8Watchdog
+ * @note   Call it after the Rx list is initialized and before the reception is started.
  */
-en_result_t ETH_DMA_GetReceiveFrame_Interrupt(stc_eth_handle_t *pstcEthHandle)
+en_result_t ETH_DMA_RxIntCoalesceConfig(stc_eth_handle_t *pstcEthHandle, uint32_t u32FrameCnt, uint8_t u8Watchdog)
 {
-    uint32_t u32DescCnt = 0U;
-    en_result_t enRet = Error;
+    uint32_t i;
+    stc_eth_dma_desc_t *pstcRxDesc;
+    en_result_t enRet = Ok;
 
-    if (NULL == pstcEthHandle)
+    if ((NULL == pstcEthHandle) || (NULL == pstcEthHandle->stcRxDesc) || (0UL == u32FrameCnt) ||
+        (u32FrameCnt > pstcEthHandle->u32RxDescCnt) || ((u32FrameCnt > 1UL) && (0U == u8Watchdog)))
     {
         enRet = ErrorInvalidParameter;
     }
     else
     {
-        /* Scan descriptor owned by CPU */
-        while ((0UL == (pstcEthHandle->stcRxDesc->u32ControlStatus & ETH_DMARXDESC_OWN)) && (u32DescCnt < ETH_RXBUF_SIZE))
+        pstcRxDesc = pstcEthHandle->stcRxDesc;
+        for (i=0UL; i<pstcEthHandle->u32RxDescCnt; i++)
         {
-            u32DescCnt++;
-            /* Check if first segment in frame */
-            if (ETH_DMARXDESC_RFS == (pstcEthHandle->stcRxDesc->u32ControlStatus & (ETH_DMARXDESC_RFS | ETH_DMARXDESC_RLS)))
-            {
-                pstcEthHandle->stcRxFrame.pstcFSDesc  = pstcEthHandle->stcRxDesc;
-                pstcEthHandle->stcRxFrame.pstcLSDesc  = NULL;
-                pstcEthHandle->stcRxFrame.u32SegCount = 1U;
-                /* Point to next descriptor */
-                pstcEthHandle->stcRxDesc = (stc_eth_dma_desc_t*)(pstcEthHandle->stcRxDesc->u32Buffer2NextDescAddr);
-            }
-            /* Check if intermediate segment */
-            else if (0UL == (pstcEthHandle->stcRxDesc->u32ControlStatus & (ETH_DMARXDESC_RFS | ETH_DMARXDESC_RLS)))
+            /* Only every u32FrameCnt-th descriptor interrupts on completion */
+            if (0UL == ((i + 1UL) % u32FrameCnt))
             {
-                pstcEthHandle->stcRxFrame.u32SegCount++;
-                /* Point to next descriptor */
-                pstcEthHandle->stcRxDesc = (stc_eth_dma_desc_t*)(pstcEthHandle->stcRxDesc->u32Buffer2NextDescAddr);
+                CLEAR_REG32_BIT(pstcRxDesc->u32ControlBufferSize, ETH_DMARXDESC_DIC);
             }
-            /* Last segment */
             else
             {
-                pstcEthHandle->stcRxFrame.u32SegCount++;
-                /* Last segment */
-                pstcEthHandle->stcRxFrame.pstcLSDesc = pstcEthHandle->stcRxDesc;
-                /* Check if last segment is first segment */
-                if (1U == pstcEthHandle->stcRxFrame.u32SegCount)
-                {
-                    pstcEthHandle->stcRxFrame.pstcFSDesc = pstcEthHandle->stcRxDesc;
-                }
-
-                /* Get the Frame Length of the received packet: Strip FCS */
-                pstcEthHandle->stcRxFrame.u32Length = ((pstcEthHandle->stcRxDesc->u32ControlStatus & ETH_DMARXDESC_FRAL) >> ETH_DMARXDESC_FRAME_LENGTHSHIFT) - 4U;
-                /* Get the address of the buffer start address */
-                pstcEthHandle->stcRxFrame.u32Buffer = (pstcEthHandle->stcRxFrame.pstcFSDesc)->u32Buffer1Addr;
-                /* Pointer to next descriptor */
-                pstcEthHandle->stcRxDesc = (stc_eth_dma_desc_t*)(pstcEthHandle->stcRxDesc->u32Buffer2NextDescAddr);
-                /* Get success */
-                enRet = Ok;
+                SET_REG32_BIT(pstcRxDesc->u32ControlBufferSize, ETH_DMARXDESC_DIC);
             }
+            pstcRxDesc = (stc_eth_dma_desc_t *)(pstcRxDesc->u32Buffer2NextDescAddr);
         }
+
+        ETH_DMA_SetRxWatchdogCounter((u32FrameCnt > 1UL) ? u8Watchdog : 0U);
     }
 
     return enRet;
@@ -4072,6 +5606,169 @@ uint32_t ETH_MMC_GetRegister(uint32_t u32Reg)
     return (*(__IO uint32_t *)((uint32_t)(&M4_ETH->MAC_CONFIGR) + u32Reg));
 }
 
+/******************************************************************************/
+/*                            Statistics Functions                            */
+/******************************************************************************/
+/**
+ * @brief  Initialize a statistics collector.
+ * @param  [out] pstcStat                   Pointer to a @ref stc_eth_stat_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcStat == NULL
+ * @note   The MMC counters and the DMA missed frame counters are taken as the base of the totals.
+ */
+en_result_t ETH_STAT_Init(stc_eth_stat_t *pstcStat)
+{
+    uint32_t i;
+    en_result_t enRet = Ok;
+
+    if (NULL == pstcStat)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        (void)memset(pstcStat, 0, sizeof(stc_eth_stat_t));
+        for (i=0UL; i<ARRAY_SZ(m_au16StatMmcReg); i++)
+        {
+            pstcStat->au32MmcLast[i] = ETH_MMC_GetRegister(m_au16StatMmcReg[i]);
+        }
+        /* Clear the missed frame counters */
+        (void)READ_REG32(M4_ETH->DMA_RFRCNTR);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Fold the hardware counters into the totals.
+ * @param  [in] pstcStat                    Pointer to a @ref stc_eth_stat_t structure
+ * @retval None
+ * @note   Call it before the 32-bit MMC counters and the 16-bit missed frame counter wrap, from a periodic
+ *         task or from the MMC interrupt (the interrupt flags are cleared by reading the counters).
+ * @note   The missed frame counters are cleared on read, they must not be read by other functions.
+ */
+void ETH_STAT_Collect(stc_eth_stat_t *pstcStat)
+{
+    uint32_t i;
+    uint32_t u32Value;
+    uint32_t u32ReadReset;
+    uint32_t au32Delta[ARRAY_SZ(m_au16StatMmcReg)];
+    stc_eth_stat_count_t *pstcTotal;
+
+    if (NULL != pstcStat)
+    {
+        u32ReadReset = READ_REG32_BIT(M4_ETH->MMC_MMCCTLR, ETH_MMC_MMCCTLR_ROR);
+        for (i=0UL; i<ARRAY_SZ(m_au16StatMmcReg); i++)
+        {
+            u32Value = ETH_MMC_GetRegister(m_au16StatMmcReg[i]);
+            if (0UL != u32ReadReset)
+            {
+                au32Delta[i] = u32Value;
+            }
+            else
+            {
+                /* Modulo 2^32 when the counter rolls over */
+                au32Delta[i] = u32Value - pstcStat->au32MmcLast[i];
+            }
+            pstcStat->au32MmcLast[i] = u32Value;
+        }
+
+        pstcTotal = &pstcStat->stcSnapshot.stcTotal;
+        pstcTotal->u64RxFrames        += (uint64_t)au32Delta[0] + au32Delta[1] + au32Delta[2];
+        pstcTotal->u64TxFrames        += (uint64_t)au32Delta[3] + au32Delta[4] + au32Delta[5];
+        pstcTotal->u64RxCrcErr        += au32Delta[6];
+        pstcTotal->u64RxAlignErr      += au32Delta[7];
+        pstcTotal->u64RxShortErr      += au32Delta[8];
+        pstcTotal->u64RxLengthErr     += au32Delta[9];
+        pstcTotal->u64RxOutOfRangeErr += au32Delta[10];
+        pstcTotal->u64TxErr           += (uint64_t)au32Delta[11] + au32Delta[12] + au32Delta[13] + au32Delta[14] + au32Delta[15];
+
+        /* Both missed frame counters are cleared by one read */
+        u32Value = READ_REG32(M4_ETH->DMA_RFRCNTR);
+        pstcTotal->u64RxOvfDrop        += (u32Value & ETH_DMA_RFRCNTR_OVFCNT) >> ETH_DMA_RFRCNTR_OVFCNT_POS;
+        pstcTotal->u64RxBufUnavailDrop += u32Value & ETH_DMA_RFRCNTR_UNACNT;
+    }
+}
+
+/**
+ * @brief  Add the bytes received and transmitted to the totals.
+ * @param  [in] pstcStat                    Pointer to a @ref stc_eth_stat_t structure
+ * @param  [in] u32RxBytes                  Bytes received
+ * @param  [in] u32TxBytes                  Bytes transmitted
+ * @retval None
+ * @note   The MMC of the device has no byte counter, the bytes are counted by the frame handling.
+ */
+void ETH_STAT_AddBytes(stc_eth_stat_t *pstcStat, uint32_t u32RxBytes, uint32_t u32TxBytes)
+{
+    if (NULL != pstcStat)
+    {
+        pstcStat->stcSnapshot.stcTotal.u64RxBytes += u32RxBytes;
+        pstcStat->stcSnapshot.stcTotal.u64TxBytes += u32TxBytes;
+    }
+}
+
+/**
+ * @brief  Collect the counters and update the rates once per second.
+ * @param  [in] pstcStat                    Pointer to a @ref stc_eth_stat_t structure
+ * @param  [in] u32ElapsedTime              Time elapsed since the last call(ms)
+ * @retval None
+ */
+void ETH_STAT_Process(stc_eth_stat_t *pstcStat, uint32_t u32ElapsedTime)
+{
+    uint32_t u32Time;
+    const stc_eth_stat_count_t *pstcTotal;
+    const stc_eth_stat_count_t *pstcBase;
+    stc_eth_stat_rate_t *pstcRate;
+
+    if (NULL != pstcStat)
+    {
+        ETH_STAT_Collect(pstcStat);
+        pstcStat->u32RateTime += u32ElapsedTime;
+        if (pstcStat->u32RateTime >= ETH_STAT_RATE_PERIOD)
+        {
+            u32Time   = pstcStat->u32RateTime;
+            pstcTotal = &pstcStat->stcSnapshot.stcTotal;
+            pstcBase  = &pstcStat->stcRateBase;
+            pstcRate  = &pstcStat->stcSnapshot.stcRate;
+            pstcRate->u32RxFrames         = ETH_STAT_Rate(pstcTotal->u64RxFrames, pstcBase->u64RxFrames, u32Time);
+            pstcRate->u32TxFrames         = ETH_STAT_Rate(pstcTotal->u64TxFrames, pstcBase->u64TxFrames, u32Time);
+            pstcRate->u32RxBytes          = ETH_STAT_Rate(pstcTotal->u64RxBytes, pstcBase->u64RxBytes, u32Time);
+            pstcRate->u32TxBytes          = ETH_STAT_Rate(pstcTotal->u64TxBytes, pstcBase->u64TxBytes, u32Time);
+            pstcRate->u32RxCrcErr         = ETH_STAT_Rate(pstcTotal->u64RxCrcErr, pstcBase->u64RxCrcErr, u32Time);
+            pstcRate->u32RxOvfDrop        = ETH_STAT_Rate(pstcTotal->u64RxOvfDrop, pstcBase->u64RxOvfDrop, u32Time);
+            pstcRate->u32RxBufUnavailDrop = ETH_STAT_Rate(pstcTotal->u64RxBufUnavailDrop, pstcBase->u64RxBufUnavailDrop, u32Time);
+            pstcStat->stcRateBase = *pstcTotal;
+            pstcStat->u32RateTime = 0UL;
+        }
+    }
+}
+
+/**
+ * @brief  Get the totals and the rates.
+ * @param  [in] pstcStat                    Pointer to a @ref stc_eth_stat_t structure
+ * @param  [out] pstcSnapshot               Pointer to a @ref stc_eth_stat_snapshot_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Get success
+ *           - ErrorInvalidParameter: pstcStat == NULL or pstcSnapshot == NULL
+ * @note   Call it from the context updating the collector, or with the MMC interrupt masked.
+ */
+en_result_t ETH_STAT_GetSnapshot(const stc_eth_stat_t *pstcStat, stc_eth_stat_snapshot_t *pstcSnapshot)
+{
+    en_result_t enRet = Ok;
+
+    if ((NULL == pstcStat) || (NULL == pstcSnapshot))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        *pstcSnapshot = pstcStat->stcSnapshot;
+    }
+
+    return enRet;
+}
+
 /******************************************************************************/
 /*                                PTP Functions                               */
 /******************************************************************************/
@@ -4251,7 +5948,7 @@ en_result_t ETH_PTP_UpdateBasicIncValue(void)
 
     if (0UL == READ_REG32(bM4_ETH->PTP_TSPCTLR_b.TSPADUP))
     {
-        WRITE_REG32(bM4_ETH->MMC_MMCCTLR_b.CRST, 1U);
+        WRITE_REG32(bM4_ETH->PTP_TSPCTLR_b.TSPADUP, 1U);
         u32Count = ETH_TIMEOUT_WRITE_REGISTER * (HCLK_VALUE / 20000UL);
         do
         {
@@ -4260,7 +5957,7 @@ en_result_t ETH_PTP_UpdateBasicIncValue(void)
                 enRet = ErrorTimeout;
                 break;
             }
-        } while (0UL != READ_REG32(bM4_ETH->MMC_MMCCTLR_b.CRST));
+        } while (0UL != READ_REG32(bM4_ETH->PTP_TSPCTLR_b.TSPADUP));
 
         if (ErrorTimeout != enRet)
         {
@@ -4438,49 +6135,358 @@ void ETH_PTP_Cmd(en_functional_state_t enNewSta)
     /* Check parameters */
     DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewSta));
 
-    WRITE_REG32(bM4_ETH->PTP_TSPCTLR_b.TSPEN, enNewSta);
+    WRITE_REG32(bM4_ETH->PTP_TSPCTLR_b.TSPEN, enNewSta);
+}
+
+/**
+ * @brief  Enable or disable PTP interrupt.
+ * @param  [in] enNewSta                    The function new state.
+ *           @arg This parameter can be: Enable or Disable.
+ * @retval None
+ */
+void ETH_PTP_IntCmd(en_functional_state_t enNewSta)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewSta));
+
+    WRITE_REG32(bM4_ETH->PTP_TSPCTLR_b.TSPINT, enNewSta);
+}
+
+/**
+ * @brief  Get PTP flag status.
+ * @param  [in] u32Flag                     PTP flag type
+ *         This parameter can be one or any combination of the following values:
+ *           @arg ETH_PTP_FLAG_TSERR1:      Target time 1 error
+ *           @arg ETH_PTP_FLAG_TSTAR1:      Target time 1 reached
+ *           @arg ETH_PTP_FLAG_TSERR0:      Target time 0 error
+ *           @arg ETH_PTP_FLAG_TSTAR0:      Target time 0 reached
+ *           @arg ETH_PTP_FLAG_TSOVF:       System time overflow
+ * @retval An en_flag_status_t enumeration value:
+ *           - Set: Flag is set
+ *           - Reset: Flag is reset
+ */
+en_flag_status_t ETH_PTP_GetStatus(uint32_t u32Flag)
+{
+    en_flag_status_t enFlagSta = Reset;
+
+    /* Check parameters */
+    DDL_ASSERT(IS_ETH_PTP_FLAG(u32Flag));
+
+    if (0UL != (READ_REG32_BIT(M4_ETH->PTP_TSPSTSR, u32Flag)))
+    {
+        enFlagSta = Set;
+    }
+
+    return enFlagSta;
+}
+
+/**
+ * @brief  Get PTP timestamp system time in nanosecond.
+ * @param  [out] pu64Ns                     Pointer to Timestamp system time in nanosecond
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Get timestamp system time success
+ *           - ErrorInvalidParameter: pu64Ns == NULL
+ * @note   The time is monotonic as long as it is only slewed by ETH_PTP_AdjustFreq(),
+ *         ETH_PTP_AdjustTime() with a negative offset steps it backward.
+ */
+en_result_t ETH_PTP_GetTimeNs(uint64_t *pu64Ns)
+{
+    uint32_t u32Sec;
+    uint32_t u32SubSec;
+    en_result_t enRet = Ok;
+
+    if (NULL == pu64Ns)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        /* Read again if the second has changed between the two registers */
+        do
+        {
+            u32Sec    = READ_REG32(M4_ETH->PTP_TMSSECR);
+            u32SubSec = READ_REG32(M4_ETH->PTP_TMSNSER);
+        } while (u32Sec != READ_REG32(M4_ETH->PTP_TMSSECR));
+
+        *pu64Ns = ETH_PTP_TimeStampToNs(u32Sec, u32SubSec);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Convert a PTP timestamp to nanosecond.
+ * @param  [in] u32Sec                      Timestamp of Second (e.g. RDES7/TDES7)
+ * @param  [in] u32SubSec                   Timestamp of Subsecond (e.g. RDES6/TDES6)
+ * @retval uint64_t                         Timestamp in nanosecond
+ * @note   The subsecond is converted with the current subsecond scale.
+ */
+uint64_t ETH_PTP_TimeStampToNs(uint32_t u32Sec, uint32_t u32SubSec)
+{
+    uint64_t u64Ns;
+
+    u64Ns = (uint64_t)(u32SubSec & ETH_PTP_SUBSEC_MASK);
+    if (0UL == READ_REG32_BIT(M4_ETH->PTP_TSPCTLR, ETH_PTP_TSPCTLR_TSPSSR))
+    {
+        /* 2^31 subsecond per second */
+        u64Ns = (u64Ns * ETH_PTP_NS_PER_SEC) >> ETH_PTP_SUBSEC_HEX_SHIFT;
+    }
+
+    return (((uint64_t)u32Sec * ETH_PTP_NS_PER_SEC) + u64Ns);
+}
+
+/**
+ * @brief  Step PTP timestamp system time.
+ * @param  [in] i64Offset                   Offset(ns) added to the system time
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Step timestamp system time success
+ *           - ErrorInvalidParameter: Offset out of range
+ *           - Error: Current state cannot be updated
+ *           - ErrorTimeout: Update timeout
+ */
+en_result_t ETH_PTP_AdjustTime(int64_t i64Offset)
+{
+    uint64_t u64Abs;
+    uint64_t u64Sec;
+    uint32_t u32Sign;
+    en_result_t enRet = Ok;
+
+    if (i64Offset < 0)
+    {
+        u32Sign = ETH_PTP_TIME_UPDATE_SIGN_MINUS;
+        u64Abs  = 0ULL - (uint64_t)i64Offset;
+    }
+    else
+    {
+        u32Sign = ETH_PTP_TIME_UPDATE_SIGN_PLUS;
+        u64Abs  = (uint64_t)i64Offset;
+    }
+
+    u64Sec = u64Abs / ETH_PTP_NS_PER_SEC;
+    if (u64Sec > 0xFFFFFFFFULL)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        ETH_PTP_SetUpdateTime(u32Sign, (uint32_t)u64Sec,
+                              ETH_PTP_NsToSubSec((uint32_t)(u64Abs % ETH_PTP_NS_PER_SEC)));
+        enRet = ETH_PTP_UpdateSystemTime();
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Adjust PTP timestamp frequency by the fine calibration addend.
+ * @param  [in] u32BaseAddend               Nominal addend giving the nominal frequency
+ * @param  [in] i32Freq                     Frequency adjustment(ppb)
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Adjust frequency success
+ *           - Error: Previous addend update not completed
+ *           - ErrorTimeout: Update timeout
+ * @note   Only valid in ETH_PTP_CALIBRATION_MODE_FINE.
+ */
+en_result_t ETH_PTP_AdjustFreq(uint32_t u32BaseAddend, int32_t i32Freq)
+{
+    int64_t i64Addend;
+
+    i64Addend = (int64_t)u32BaseAddend + (((int64_t)u32BaseAddend * i32Freq) / (int64_t)ETH_PTP_NS_PER_SEC);
+    if (i64Addend < 0)
+    {
+        i64Addend = 0;
+    }
+    else if (i64Addend > (int64_t)0xFFFFFFFFLL)
+    {
+        i64Addend = (int64_t)0xFFFFFFFFLL;
+    }
+    else
+    {
+        /* Addend in range */
+    }
+    WRITE_REG32(M4_ETH->PTP_TSPADDR, (uint32_t)i64Addend);
+
+    return ETH_PTP_UpdateBasicIncValue();
+}
+
+/**
+ * @brief  Set the fields of structure stc_eth_ptp_servo_init_t to default values.
+ * @param  [out] pstcServoInit              Pointer to a @ref stc_eth_ptp_servo_init_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Structure Initialize success
+ *           - ErrorInvalidParameter: pstcServoInit == NULL
+ */
+en_result_t ETH_PTP_ServoStructInit(stc_eth_ptp_servo_init_t *pstcServoInit)
+{
+    en_result_t enRet = Ok;
+
+    if (NULL == pstcServoInit)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        pstcServoInit->u32BaseAddend    = 0UL;
+        pstcServoInit->i32Kp            = 45875L;       /* 0.7 */
+        pstcServoInit->i32Ki            = 19661L;       /* 0.3 */
+        pstcServoInit->u32MaxFreq       = 500000UL;
+        pstcServoInit->u32StepThreshold = 1000000UL;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize a PTP clock servo and select the fine calibration.
+ * @param  [out] pstcServo                  Pointer to a @ref stc_eth_ptp_servo_t structure
+ * @param  [in] pstcServoInit               Pointer to a @ref stc_eth_ptp_servo_init_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Servo Initialize success
+ *           - ErrorInvalidParameter: pstcServo == NULL or pstcServoInit == NULL
+ */
+en_result_t ETH_PTP_ServoInit(stc_eth_ptp_servo_t *pstcServo, const stc_eth_ptp_servo_init_t *pstcServoInit)
+{
+    en_result_t enRet = Ok;
+
+    if ((NULL == pstcServo) || (NULL == pstcServoInit))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        pstcServo->stcInit  = *pstcServoInit;
+        pstcServo->i64Drift = 0;
+        pstcServo->i32Freq  = 0L;
+        pstcServo->u32State = ETH_PTP_SERVO_STATE_UNLOCKED;
+        if (0UL == pstcServo->stcInit.u32BaseAddend)
+        {
+            pstcServo->stcInit.u32BaseAddend = READ_REG32(M4_ETH->PTP_TSPADDR);
+        }
+        ETH_PTP_SetCalibMode(ETH_PTP_CALIBRATION_MODE_FINE);
+    }
+
+    return enRet;
 }
 
 /**
- * @brief  Enable or disable PTP interrupt.
- * @param  [in] enNewSta                    The function new state.
- *           @arg This parameter can be: Enable or Disable.
- * @retval None
+ * @brief  Feed a PTP clock servo with an offset sample and compute the frequency adjustment.
+ * @param  [in] pstcServo                   Pointer to a @ref stc_eth_ptp_servo_t structure
+ * @param  [in] i64Offset                   Offset(ns) of the local clock from the master clock,
+ *                                          positive when the local clock is ahead
+ * @retval An uint32_t value of @ref ETH_PTP_Servo_State
+ *           - ETH_PTP_SERVO_STATE_JUMP:    The time needs a step of -i64Offset, the integral term and
+ *                                          pstcServo->i32Freq are cleared
+ *           - ETH_PTP_SERVO_STATE_LOCKED:  pstcServo->i32Freq holds the frequency adjustment(ppb)
+ * @note   No register is accessed: the PI loop can be run against recorded offsets.
+ *         The gains are per sample, samples are expected at a regular interval.
  */
-void ETH_PTP_IntCmd(en_functional_state_t enNewSta)
+uint32_t ETH_PTP_ServoSample(stc_eth_ptp_servo_t *pstcServo, int64_t i64Offset)
 {
-    /* Check parameters */
-    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewSta));
+    int64_t i64Max;
+    int64_t i64Freq;
+    int64_t i64Threshold;
+    uint32_t u32State = ETH_PTP_SERVO_STATE_UNLOCKED;
 
-    WRITE_REG32(bM4_ETH->PTP_TSPCTLR_b.TSPINT, enNewSta);
+    if (NULL != pstcServo)
+    {
+        i64Threshold = (int64_t)pstcServo->stcInit.u32StepThreshold;
+        if ((0 != i64Threshold) && ((i64Offset > i64Threshold) || (i64Offset < -i64Threshold)))
+        {
+            /* The frequency learnt before the step no longer matches the stepped clock */
+            pstcServo->i64Drift = 0;
+            pstcServo->i32Freq  = 0L;
+            u32State = ETH_PTP_SERVO_STATE_JUMP;
+        }
+        else
+        {
+            /* Limit the offset so that the products cannot overflow */
+            if (i64Offset > (int64_t)ETH_PTP_NS_PER_SEC)
+            {
+                i64Offset = (int64_t)ETH_PTP_NS_PER_SEC;
+            }
+            else if (i64Offset < -(int64_t)ETH_PTP_NS_PER_SEC)
+            {
+                i64Offset = -(int64_t)ETH_PTP_NS_PER_SEC;
+            }
+            else
+            {
+                /* Offset in range */
+            }
+
+            i64Max = (int64_t)pstcServo->stcInit.u32MaxFreq << ETH_PTP_SERVO_GAIN_SHIFT;
+            /* A local clock ahead is slowed down */
+            pstcServo->i64Drift -= (int64_t)pstcServo->stcInit.i32Ki * i64Offset;
+            if (pstcServo->i64Drift > i64Max)
+            {
+                pstcServo->i64Drift = i64Max;
+            }
+            else if (pstcServo->i64Drift < -i64Max)
+            {
+                pstcServo->i64Drift = -i64Max;
+            }
+            else
+            {
+                /* Integral term in range */
+            }
+
+            i64Freq = pstcServo->i64Drift - ((int64_t)pstcServo->stcInit.i32Kp * i64Offset);
+            if (i64Freq > i64Max)
+            {
+                i64Freq = i64Max;
+            }
+            else if (i64Freq < -i64Max)
+            {
+                i64Freq = -i64Max;
+            }
+            else
+            {
+                /* Frequency in range */
+            }
+            pstcServo->i32Freq = (int32_t)(i64Freq / ((int64_t)1 << ETH_PTP_SERVO_GAIN_SHIFT));
+            u32State = ETH_PTP_SERVO_STATE_LOCKED;
+        }
+        pstcServo->u32State = u32State;
+    }
+
+    return u32State;
 }
 
 /**
- * @brief  Get PTP flag status.
- * @param  [in] u32Flag                     PTP flag type
- *         This parameter can be one or any combination of the following values:
- *           @arg ETH_PTP_FLAG_TSERR1:      Target time 1 error
- *           @arg ETH_PTP_FLAG_TSTAR1:      Target time 1 reached
- *           @arg ETH_PTP_FLAG_TSERR0:      Target time 0 error
- *           @arg ETH_PTP_FLAG_TSTAR0:      Target time 0 reached
- *           @arg ETH_PTP_FLAG_TSOVF:       System time overflow
- * @retval An en_flag_status_t enumeration value:
- *           - Set: Flag is set
- *           - Reset: Flag is reset
+ * @brief  Feed a PTP clock servo with an offset sample and apply the correction:
+ *         step the time or adjust the frequency.
+ * @note   A time step also restores the nominal addend, the servo restarts from an empty integral term.
+ * @param  [in] pstcServo                   Pointer to a @ref stc_eth_ptp_servo_t structure
+ * @param  [in] i64Offset                   Offset(ns) of the local clock from the master clock,
+ *                                          positive when the local clock is ahead
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Correction applied
+ *           - ErrorInvalidParameter: pstcServo == NULL or offset out of range
+ *           - Error: Current state cannot be updated
+ *           - ErrorTimeout: Update timeout
  */
-en_flag_status_t ETH_PTP_GetStatus(uint32_t u32Flag)
+en_result_t ETH_PTP_ServoUpdate(stc_eth_ptp_servo_t *pstcServo, int64_t i64Offset)
 {
-    en_flag_status_t enFlagSta = Reset;
-
-    /* Check parameters */
-    DDL_ASSERT(IS_ETH_PTP_FLAG(u32Flag));
+    en_result_t enRet;
 
-    if (0UL != (READ_REG32_BIT(M4_ETH->PTP_TSPSTSR, u32Flag)))
+    if (NULL == pstcServo)
     {
-        enFlagSta = Set;
+        enRet = ErrorInvalidParameter;
+    }
+    else if (ETH_PTP_SERVO_STATE_JUMP == ETH_PTP_ServoSample(pstcServo, i64Offset))
+    {
+        enRet = ETH_PTP_AdjustTime(-i64Offset);
+        if (Ok == enRet)
+        {
+            /* Restart from the nominal frequency */
+            enRet = ETH_PTP_AdjustFreq(pstcServo->stcInit.u32BaseAddend, 0L);
+        }
+    }
+    else
+    {
+        enRet = ETH_PTP_AdjustFreq(pstcServo->stcInit.u32BaseAddend, pstcServo->i32Freq);
     }
 
-    return enFlagSta;
+    return enRet;
 }
 
 /******************************************************************************/
@@ -4709,6 +6715,322 @@ void ETH_PPS_SetPps0OutputFreq(uint32_t u32OutputFreq)
     MODIFY_REG32(M4_ETH->PTP_PPSCTLR, ETH_PTP_PPSCTLR_PPSFRE0, u32OutputFreq);
 }
 
+/**
+ * @brief  Align the PPS target time to the start of a second.
+ * @param  [in] u8Ch                        PPS output channel
+ *         This parameter can be one of the following values:
+ *           @arg ETH_PPS_TARGET_CH0:       PPS Channel 0
+ *           @arg ETH_PPS_TARGET_CH1:       PPS Channel 1
+ * @retval None
+ * @note   The target is set two seconds ahead, so that it is not reached while being written.
+ */
+void ETH_PPS_AlignTargetTime(uint8_t u8Ch)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_ETH_PPS_TARGET_CH(u8Ch));
+
+    ETH_PPS_SetTargetTime(u8Ch, (READ_REG32(M4_ETH->PTP_TMSSECR) + 2UL), 0UL);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ETH_Local_Functions ETH Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Reclaim the oldest frame of a zero-copy Tx list once the DMA has
+ *         released all of its descriptors.
+ * @param  [in] pstcEthHandle               Pointer to a @ref stc_eth_handle_t structure
+ * @param  [out] pstcCplt                   Pointer to a @ref stc_eth_dma_tx_cplt_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: A frame has been reclaimed
+ *           - ErrorBufferEmpty: No frame to reclaim
+ *           - ErrorNotReady: The oldest frame is still owned by the DMA
+ */
+static en_result_t ETH_DMA_TxReclaimFrame(stc_eth_handle_t *pstcEthHandle, stc_eth_dma_tx_cplt_t *pstcCplt)
+{
+    uint32_t u32Pending;
+    uint32_t u32DescCnt = 0UL;
+    stc_eth_dma_desc_t *pstcTxDesc;
+    en_result_t enRet = ErrorBufferEmpty;
+
+    pstcTxDesc = pstcEthHandle->stcTxCpltDesc;
+    u32Pending = pstcEthHandle->u32TxDescQueued - pstcEthHandle->u32TxDescReclaimed;
+    while (u32DescCnt < u32Pending)
+    {
+        u32DescCnt++;
+        if (0UL != (pstcTxDesc->u32ControlStatus & ETH_DMATXDESC_OWN))
+        {
+            enRet = ErrorNotReady;
+            break;
+        }
+
+        if (0UL != (pstcTxDesc->u32ControlStatus & ETH_DMATXDESC_TLS))
+        {
+            /* The DMA writes the frame status and time stamp into the last descriptor */
+            pstcCplt->pvArg            = (void *)pstcTxDesc->Reserved;
+            pstcCplt->u32Status        = pstcTxDesc->u32ControlStatus & ETH_DMATXDESC_CPLT_STATUS_MASK;
+            pstcCplt->u32TimeStampHigh = pstcTxDesc->u32TimeStampHigh;
+            pstcCplt->u32TimeStampLow  = pstcTxDesc->u32TimeStampLow;
+            pstcEthHandle->stcTxCpltDesc = (stc_eth_dma_desc_t *)(pstcTxDesc->u32Buffer2NextDescAddr);
+            pstcEthHandle->u32TxDescReclaimed += u32DescCnt;
+            enRet = Ok;
+            break;
+        }
+        pstcTxDesc = (stc_eth_dma_desc_t *)(pstcTxDesc->u32Buffer2NextDescAddr);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Take a buffer from an Rx buffer pool.
+ * @param  [in] pstcPool                    Pointer to a @ref stc_eth_dma_rx_pool_t structure, not empty
+ * @retval Pointer to the buffer
+ */
+static uint8_t *ETH_DMA_RxPoolGet(stc_eth_dma_rx_pool_t *pstcPool)
+{
+    uint32_t u32Tail = pstcPool->u32Tail;
+    uint8_t *pu8Buffer = pstcPool->ppu8Buf[u32Tail & (pstcPool->u32Size - 1UL)];
+
+    pstcPool->u32Tail = u32Tail + 1UL;
+
+    return pu8Buffer;
+}
+
+/**
+ * @brief  Convert nanosecond to PTP subsecond with the current subsecond scale.
+ * @param  [in] u32Ns                       Nanosecond (Between 0 and 999999999)
+ * @retval uint32_t                         Subsecond
+ */
+static uint32_t ETH_PTP_NsToSubSec(uint32_t u32Ns)
+{
+    uint32_t u32SubSec = u32Ns;
+
+    if (0UL == READ_REG32_BIT(M4_ETH->PTP_TSPCTLR, ETH_PTP_TSPCTLR_TSPSSR))
+    {
+        /* 2^31 subsecond per second */
+        u32SubSec = (uint32_t)(((uint64_t)u32Ns << ETH_PTP_SUBSEC_HEX_SHIFT) / ETH_PTP_NS_PER_SEC);
+    }
+
+    return u32SubSec;
+}
+
+/**
+ * @brief  Calculate the rate per second of a total.
+ * @param  [in] u64Total                    Total at the end of the period
+ * @param  [in] u64Base                     Total at the start of the period
+ * @param  [in] u32Time                     Period(ms)
+ * @retval uint32_t                         Rate per second, saturated to 0xFFFFFFFF
+ */
+static uint32_t ETH_STAT_Rate(uint64_t u64Total, uint64_t u64Base, uint32_t u32Time)
+{
+    uint64_t u64Rate;
+
+    u64Rate = ((u64Total - u64Base) * ETH_STAT_RATE_PERIOD) / u32Time;
+    if (u64Rate > 0xFFFFFFFFULL)
+    {
+        u64Rate = 0xFFFFFFFFULL;
+    }
+
+    return (uint32_t)u64Rate;
+}
+
+/**
+ * @brief  Program the L3/L4 filter with the rule of a single rule flow table.
+ * @param  [in] pstcTable                   Pointer to a @ref stc_eth_flow_table_t structure
+ * @retval None
+ * @note   The filter is disabled when the table holds no rule or several rules, or when the rule has
+ *         neither address nor port: the MAC would drop frames the table still matches.
+ */
+static void ETH_FLOW_UpdateHwFilter(stc_eth_flow_table_t *pstcTable)
+{
+    uint32_t i;
+    uint32_t u32HwRule = ETH_FLOW_RULE_NONE;
+    const stc_eth_flow_rule_t *pstcRule;
+    stc_eth_l3l4_filter_config_t stcL3L4Filter;
+
+    if (ETH_FLOW_HW_FILTER_OFF != pstcTable->u32HwMode)
+    {
+        /* Only a table holding exactly one rule */
+        if ((0UL != pstcTable->u32RuleMask) && (0UL == (pstcTable->u32RuleMask & (pstcTable->u32RuleMask - 1UL))))
+        {
+            for (i=0UL; i<ARRAY_SZ(pstcTable->astcRule); i++)
+            {
+                if (0UL != (pstcTable->u32RuleMask & (1UL << i)))
+                {
+                    pstcRule = &pstcTable->astcRule[i];
+                    if ((0UL != pstcRule->u32DestAddr) || (0U != pstcRule->u16DestPort))
+                    {
+                        u32HwRule = i;
+                    }
+                    break;
+                }
+            }
+        }
+
+        if (u32HwRule != pstcTable->u32HwRule)
+        {
+            ETH_MAC_L3L4FilterCmd(Disable);
+            if (ETH_FLOW_RULE_NONE != u32HwRule)
+            {
+                pstcRule = &pstcTable->astcRule[u32HwRule];
+                (void)ETH_MAC_L3L4FilterStructInit(&stcL3L4Filter);
+                if (0UL != pstcRule->u32DestAddr)
+                {
+                    stcL3L4Filter.u32L3DAFilter          = ETH_MAC_L3_DA_FILTER_NORMAL;
+                    stcL3L4Filter.u32L3Ipv4DAFilterValue = pstcRule->u32DestAddr;
+                }
+                if (0U != pstcRule->u16DestPort)
+                {
+                    stcL3L4Filter.u32L4DestPortFilter      = ETH_MAC_L4_DESTPORT_FILTER_NORMAL;
+                    stcL3L4Filter.u16L4DestProtFilterValue = pstcRule->u16DestPort;
+                }
+                if (ETH_FLOW_PROTOCOL_UDP == pstcRule->u32Protocol)
+                {
+                    stcL3L4Filter.u32L4PortFilterProtocol = ETH_MAC_L4_PORT_FILTER_PROTOCOL_UDP;
+                }
+                else
+                {
+                    stcL3L4Filter.u32L4PortFilterProtocol = ETH_MAC_L4_PORT_FILTER_PROTOCOL_TCP;
+                }
+                (void)ETH_MAC_L3L4FilterInit(&stcL3L4Filter);
+                ETH_MAC_L3L4FilterCmd(Enable);
+            }
+            pstcTable->u32HwRule = u32HwRule;
+        }
+    }
+}
+
+/**
+ * @brief  Calculate the bit-reversed CRC32 used by the MAC hash filters.
+ * @param  [in] au8Data                     Pointer to data buffer
+ * @param  [in] u32BitLen                   Bit length of data, the bits are taken LSB first
+ * @retval uint32_t                         Bit-reversed CRC32 of the data
+ */
+static uint32_t ETH_MAC_HashCrc32(const uint8_t au8Data[], uint32_t u32BitLen)
+{
+    uint32_t i;
+    uint32_t u32Crc = 0xFFFFFFFFUL;
+    uint32_t u32Result = 0UL;
+
+    for (i=0UL; i<u32BitLen; i++)
+    {
+        if (0UL != ((u32Crc ^ ((uint32_t)au8Data[i >> 3U] >> (i & 0x07UL))) & 0x01UL))
+        {
+            u32Crc = (u32Crc >> 1U) ^ ETH_MAC_HASH_CRC32_POLY;
+        }
+        else
+        {
+            u32Crc >>= 1U;
+        }
+    }
+    u32Crc = ~u32Crc;
+
+    /* Reverse the bit order */
+    for (i=0UL; i<32UL; i++)
+    {
+        u32Result = (u32Result << 1U) | ((u32Crc >> i) & 0x01UL);
+    }
+
+    return u32Result;
+}
+
+/**
+ * @brief  Set or clear a bit of the MAC hash table.
+ * @param  [in] u32Index                    Bit index (0 ~ 63)
+ * @param  [in] enNewSta                    The function new state.
+ *           @arg  This parameter can be: Enable or Disable.
+ * @retval None
+ */
+static void ETH_MAC_FilterHashCmd(uint32_t u32Index, en_functional_state_t enNewSta)
+{
+    if (u32Index < 32UL)
+    {
+        if (Disable != enNewSta)
+        {
+            SET_REG32_BIT(M4_ETH->MAC_HASHTLR, (1UL << u32Index));
+        }
+        else
+        {
+            CLEAR_REG32_BIT(M4_ETH->MAC_HASHTLR, (1UL << u32Index));
+        }
+    }
+    else
+    {
+        if (Disable != enNewSta)
+        {
+            SET_REG32_BIT(M4_ETH->MAC_HASHTHR, (1UL << (u32Index - 32UL)));
+        }
+        else
+        {
+            CLEAR_REG32_BIT(M4_ETH->MAC_HASHTHR, (1UL << (u32Index - 32UL)));
+        }
+    }
+}
+
+/**
+ * @brief  Set or clear a bit of the VLAN hash table.
+ * @param  [in] u32Index                    Bit index (0 ~ 15)
+ * @param  [in] enNewSta                    The function new state.
+ *           @arg  This parameter can be: Enable or Disable.
+ * @retval None
+ */
+static void ETH_MAC_FilterVlanHashCmd(uint32_t u32Index, en_functional_state_t enNewSta)
+{
+    if (Disable != enNewSta)
+    {
+        SET_REG32_BIT(M4_ETH->MAC_VLAHTBR, (1UL << u32Index));
+    }
+    else
+    {
+        CLEAR_REG32_BIT(M4_ETH->MAC_VLAHTBR, (1UL << u32Index));
+    }
+}
+
+/**
+ * @brief  Get the hardware checksum status of a received frame.
+ * @param  [in] u32Status                   RDES0 of the last descriptor of the frame
+ * @param  [in] u32ExtendStatus             RDES4 of the last descriptor of the frame
+ * @retval A combination of @ref ETH_Rx_Checksum_Status
+ */
+static uint32_t ETH_DMA_RxChecksumStatus(uint32_t u32Status, uint32_t u32ExtendStatus)
+{
+    uint32_t u32ChecksumStatus = ETH_RX_CHECKSUM_NONE;
+
+    /* RDES4 is valid and the frame is checked by the COE engine */
+    if ((0UL != (u32Status & ETH_DMARXDESC_DAS_ESA)) && (0UL == (u32ExtendStatus & ETH_DMARXDESC_IPCB)) &&
+        (0UL != (u32ExtendStatus & (ETH_DMARXDESC_IPV4DR | ETH_DMARXDESC_IPV6DR))))
+    {
+        if (0UL != (u32ExtendStatus & ETH_DMARXDESC_IPHE))
+        {
+            u32ChecksumStatus = ETH_RX_CHECKSUM_IPHDR_ERR;
+        }
+        else
+        {
+            u32ChecksumStatus = ETH_RX_CHECKSUM_IPHDR_OK;
+        }
+
+        if (ETH_DMARXDESC_IPPT_UNKNOWN != (u32ExtendStatus & ETH_DMARXDESC_IPPT))
+        {
+            if (0UL != (u32ExtendStatus & ETH_DMARXDESC_IPPE))
+            {
+                u32ChecksumStatus |= ETH_RX_CHECKSUM_PAYLOAD_ERR;
+            }
+            else
+            {
+                u32ChecksumStatus |= ETH_RX_CHECKSUM_PAYLOAD_OK;
+            }
+        }
+    }
+
+    return u32ChecksumStatus;
+}
+
 /**
  * @}
  */
@@ -6,6 +6,13 @@
    Change Logs:
    Date             Author          Notes
    2020-06-12       Heqb          First version
+   2026-10-17       Heqb          1. Add streaming context API HASH_CtxInit/HMAC_CtxInit,
+                                     HASH_Update and HASH_Final
+                                  2. HASH_Calculate/HMAC_Calculate feed aligned groups
+                                     without copying them
+                                  3. Add DMA-fed calculation HASH_DMA_Start/HMAC_DMA_Start
+   2026-10-17       Heqb          The HASH DMA channel is claimed through DMA_ChClaim(), and
+                                  both HASH trigger selects are written on every run
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -54,6 +61,7 @@
  * Include files
  ******************************************************************************/
 #include "hc32f4a0_hash.h"
+#include "hc32f4a0_dma.h"
 #include "hc32f4a0_utility.h"
 
 /**
@@ -88,6 +96,10 @@
                                        HASH_FLAG_CYC_END | HASH_FLAG_HMAC_END)
 
 #define HASH_CLR_FLAG_MASK            (HASH_FLAG_CYC_END | HASH_FLAG_HMAC_END)
+
+/* Number of words in a group and the maximum number of groups of one DMA transfer */
+#define HASH_GROUP_WORDS              (HASH_GROUP_LEN / 4U)
+#define HASH_DMA_MAX_GROUPS           (0xFFFFUL)
 /**
  * @defgroup HASH_Check_Parameters_Validity HASH Check Parameters Validity
  * @{
@@ -169,8 +181,23 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
-static void HASH_WriteData(uint8_t u8Data[]);
-static en_result_t HASH_Fill_Calc_Data(const uint8_t au8Data[], uint32_t u32DataSize);
+static void HASH_WriteData(const uint8_t au8Data[]);
+static en_result_t HASH_WaitStop(void);
+static en_result_t HASH_WaitBusy(void);
+static en_result_t HASH_CalcGroup(const uint8_t au8Data[], uint32_t u32GrpCtrl,
+                                  en_functional_state_t enWait);
+static en_result_t HASH_CtxReset(stc_hash_ctx_t *pstcCtx, uint32_t u32Mode);
+static en_result_t HASH_CtxGroup(stc_hash_ctx_t *pstcCtx, const uint8_t au8Data[]);
+static en_result_t HASH_CtxPadding(stc_hash_ctx_t *pstcCtx,
+                                   en_functional_state_t enLastGrpInt);
+static en_result_t HMAC_KeyCalc(const uint8_t au8Key[], uint32_t u32KeyLength);
+#if (DDL_DMA_ENABLE == DDL_ON)
+static en_result_t HASH_DMA_Run(stc_hash_dma_handle_t *pstcHandle,
+                                const uint32_t au32SrcData[],
+                                uint32_t u32SrcDataSize);
+static void HASH_DMA_Finish(stc_hash_dma_handle_t *pstcHandle);
+static void HASH_DMA_Release(stc_hash_dma_handle_t *pstcHandle);
+#endif /* DDL_DMA_ENABLE */
 
 /*******************************************************************************
  * Local variable definitions ('static')
@@ -190,30 +217,28 @@ static en_result_t HASH_Fill_Calc_Data(const uint8_t au8Data[], uint32_t u32Data
  * @param  [in] u32SrcDataSize      Length of the input buffer in bytes
  * @param  [out] au8MsgDigest       Buffer of the digest. The size must be 32 bytes
  * @retval Ok: Success
- *         ErrorBufferFull: Filling Error
  *         ErrorInvalidParameter: Parameter error
+ *         ErrorTimeout: Process timeout
  */
 en_result_t HASH_Calculate(const void *pvSrcData,
                            uint32_t u32SrcDataSize,
                            uint8_t au8MsgDigest[])
 {
-    en_result_t   enRet = ErrorInvalidParameter;
+    en_result_t enRet = ErrorInvalidParameter;
+    stc_hash_ctx_t stcCtx;
+
     if((pvSrcData != NULL)    &&
        (u32SrcDataSize != 0UL)  &&
        (au8MsgDigest != NULL))
     {
-        /* Set HMAC Mode */
-
-        HASH_SetMode(HASH_MODE_SHA_256);
-        if(HASH_Fill_Calc_Data(pvSrcData, u32SrcDataSize) == Ok)
+        enRet = HASH_CtxInit(&stcCtx);
+        if (enRet == Ok)
         {
-            /* Get the message digest result */
-            HASH_GetResult(au8MsgDigest);
-            enRet = Ok;
+            enRet = HASH_Update(&stcCtx, pvSrcData, u32SrcDataSize);
         }
-        else
+        if (enRet == Ok)
         {
-            enRet = ErrorBufferFull;
+            enRet = HASH_Final(&stcCtx, au8MsgDigest);
         }
     }
     return enRet;
@@ -227,7 +252,6 @@ en_result_t HASH_Calculate(const void *pvSrcData,
  * @param  [in] u32KeyLength        Length of the input secret key in bytes
  * @param  [out] au8MsgDigest       Buffer of the digest data buffer. The size must be 32 bytes
  * @retval Ok: Success
- *         Error: Filling Error
  *         ErrorInvalidParameter: Parameter error
  *         ErrorTimeout: Process timeout
  */
@@ -238,69 +262,22 @@ en_result_t HMAC_Calculate(const void *pvSrcData,
                            uint8_t au8MsgDigest[])
 {
     en_result_t enRet = ErrorInvalidParameter;
-    uint32_t u32TimeCount = 0UL;
-    uint8_t  u8FillBuffer[HASH_GROUP_LEN] = {0UL};
+    stc_hash_ctx_t stcCtx;
+
     if ((pvSrcData != NULL)    &&
        (u32SrcDataSize != 0UL) &&
        (au8Key != NULL)        &&
        (u32KeyLength != 0UL)   &&
        (au8MsgDigest != NULL))
     {
-        enRet = Ok;
-        /* Set HMAC Mode */
-        HASH_SetMode(HASH_MODE_HMAC);
-        if (u32KeyLength > HASH_GROUP_LEN)
-        {
-            SET_REG32_BIT(M4_HASH->CR, HASH_CR_LKEY);
-            /* Write the key to the data register */
-            HASH_Fill_Calc_Data(au8Key, u32KeyLength);
-        }
-        else
+        enRet = HMAC_CtxInit(&stcCtx, au8Key, u32KeyLength);
+        if (enRet == Ok)
         {
-            memcpy(u8FillBuffer, &au8Key[0U], u32KeyLength);
-            /* Write the key to the data register */
-            HASH_WriteData(u8FillBuffer);
-            /* Set first group. */
-            SET_REG32_BIT(M4_HASH->CR, HASH_CR_FST_GRP);
-            /* Set last group. */
-            SET_REG32_BIT(M4_HASH->CR, HASH_CR_KMSG_END);
-            /* Start hash calculating. */
-            SET_REG32_BIT(M4_HASH->CR, HASH_CR_START);
-            /* Wait for operation completion */
-            while(READ_REG32_BIT(M4_HASH->CR, HASH_CR_BUSY))
-            {
-                if(u32TimeCount++ > HASH_TIMEOUT)
-                {
-                    enRet = ErrorTimeout;
-                    break;
-                }
-            }
+            enRet = HASH_Update(&stcCtx, pvSrcData, u32SrcDataSize);
         }
-        /* Clear operation completion flag */
-        CLEAR_REG32_BIT(M4_HASH->CR, HASH_CR_CYC_END);
         if (enRet == Ok)
         {
-            u32TimeCount =0UL;
-            /* Write the message to the data register */
-            if (HASH_Fill_Calc_Data(pvSrcData, u32SrcDataSize) == Ok)
-            {
-                while(READ_REG32_BIT(M4_HASH->CR, HASH_CR_HMAC_END) == 0UL)
-                {
-                    if (u32TimeCount++ > HASH_TIMEOUT)
-                    {
-                        enRet = ErrorTimeout;
-                        break;
-                    }
-                }
-                if (enRet == Ok)
-                {
-                    /* Clear operation completion flag */
-                    CLEAR_REG32_BIT(M4_HASH->CR, HASH_CR_CYC_END);
-                    CLEAR_REG32_BIT(M4_HASH->CR, HASH_CR_HMAC_END);
-                    /* Get the message digest result */
-                    HASH_GetResult(au8MsgDigest);
-                }
-            }
+            enRet = HASH_Final(&stcCtx, au8MsgDigest);
         }
     }
     return enRet;
@@ -619,120 +596,734 @@ void HASH_GetResult(uint8_t au8MsgDigest[])
 }
 
 /**
- * @brief  HASH Filling data
- * @param  [in] au8Data              The source data buffer
- * @param  [in] u32DataSize          Length of the input buffer in bytes
+ * @brief  Initialize a SHA-256 streaming context and the HASH engine.
+ * @param  [out] pstcCtx            Pointer to a @ref stc_hash_ctx_t structure
  * @retval Ok: Success
+ *         ErrorInvalidParameter: pstcCtx == NULL
  *         ErrorTimeout: Process timeout
+ * @note   Feed the message with HASH_Update() and get the digest with HASH_Final().
  */
-static en_result_t HASH_Fill_Calc_Data(const uint8_t au8Data[], uint32_t u32DataSize)
+en_result_t HASH_CtxInit(stc_hash_ctx_t *pstcCtx)
 {
-    en_result_t enRet = Ok;
-    uint8_t  au8FillBuffer[HASH_GROUP_LEN];
-    uint8_t  u8FirstGroup = 0U;
-    uint8_t  u8LastGroup = 0U;
-    uint8_t  u8FillFlag = 0U;
-    uint32_t u32TimeCount = 0UL;
-    uint32_t u32GroupCount = 0UL;
-    uint32_t u32BitLenHi;
-    uint32_t u32BitLenLo;
-    uint32_t u32Index;
-    u32BitLenHi    = (u32DataSize >> 29UL) & 0x7UL;
-    u32BitLenLo    = (u32DataSize << 3UL);
-    while(u32DataSize > 0UL)
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcCtx != NULL)
     {
-        /* Wait for the HASH to stop */
-        while(READ_REG32_BIT(M4_HASH->CR, HASH_CR_START))
+        enRet = HASH_CtxReset(pstcCtx, HASH_MODE_SHA_256);
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Initialize a HMAC streaming context and process the secret key.
+ * @param  [out] pstcCtx            Pointer to a @ref stc_hash_ctx_t structure
+ * @param  [in] au8Key              Buffer of the secret key
+ * @param  [in] u32KeyLength        Length of the input secret key in bytes
+ * @retval Ok: Success
+ *         ErrorInvalidParameter: Parameter error
+ *         ErrorTimeout: Process timeout
+ * @note   Feed the message with HASH_Update() and get the HMAC with HASH_Final().
+ */
+en_result_t HMAC_CtxInit(stc_hash_ctx_t *pstcCtx,
+                         const uint8_t au8Key[],
+                         uint32_t u32KeyLength)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcCtx != NULL)      &&
+        (au8Key != NULL)       &&
+        (u32KeyLength != 0UL))
+    {
+        enRet = HASH_CtxReset(pstcCtx, HASH_MODE_HMAC);
+        if (enRet == Ok)
+        {
+            enRet = HMAC_KeyCalc(au8Key, u32KeyLength);
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Feed a chunk of message into a streaming context.
+ * @param  [in] pstcCtx             Pointer to the context initialized by
+ *                                  HASH_CtxInit() or HMAC_CtxInit()
+ * @param  [in] pvSrcData           Pointer to the message chunk
+ * @param  [in] u32SrcDataSize      Length of the message chunk in bytes
+ * @retval Ok: Success
+ *         ErrorInvalidParameter: Parameter error
+ *         ErrorTimeout: Process timeout
+ * @note   Complete groups of a word aligned chunk are written to the HASH engine
+ *         directly from the chunk, only the incomplete group is kept in the context.
+ */
+en_result_t HASH_Update(stc_hash_ctx_t *pstcCtx,
+                        const void *pvSrcData,
+                        uint32_t u32SrcDataSize)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    const uint8_t *pu8Data = (const uint8_t *)pvSrcData;
+    uint32_t u32FillLen;
+
+    if ((pstcCtx != NULL) && ((pvSrcData != NULL) || (u32SrcDataSize == 0UL)))
+    {
+        enRet = Ok;
+        pstcCtx->u32MsgLenLow += u32SrcDataSize;
+        if (pstcCtx->u32MsgLenLow < u32SrcDataSize)
+        {
+            pstcCtx->u32MsgLenHigh++;
+        }
+
+        /* Complete the pending group first */
+        if ((pstcCtx->u32BufLen != 0UL) && (u32SrcDataSize != 0UL))
         {
-            if(u32TimeCount++ > HASH_TIMEOUT)
+            u32FillLen = HASH_GROUP_LEN - pstcCtx->u32BufLen;
+            if (u32FillLen > u32SrcDataSize)
             {
-                enRet = ErrorTimeout;
-                break;
+                u32FillLen = u32SrcDataSize;
+            }
+            (void)memcpy(&pstcCtx->au8Buf[pstcCtx->u32BufLen], pu8Data, u32FillLen);
+            pstcCtx->u32BufLen += u32FillLen;
+            pu8Data        = &pu8Data[u32FillLen];
+            u32SrcDataSize -= u32FillLen;
+            if (pstcCtx->u32BufLen == HASH_GROUP_LEN)
+            {
+                enRet = HASH_CtxGroup(pstcCtx, pstcCtx->au8Buf);
+                pstcCtx->u32BufLen = 0UL;
             }
         }
-        if (enRet == Ok)
+
+        /* Complete groups */
+        while ((enRet == Ok) && (u32SrcDataSize >= HASH_GROUP_LEN))
         {
-            u32Index = u32GroupCount * HASH_GROUP_LEN;
-            if((u32DataSize >= HASH_GROUP_LEN))
+            if (((uint32_t)pu8Data & 0x03UL) == 0UL)
             {
-                memset(au8FillBuffer, 0, HASH_GROUP_LEN);
-                memcpy(au8FillBuffer, &au8Data[u32Index], HASH_GROUP_LEN);
-                HASH_WriteData(au8FillBuffer);
-                u32GroupCount++;
-                u32DataSize -= HASH_GROUP_LEN;
+                enRet = HASH_CtxGroup(pstcCtx, pu8Data);
             }
             else
             {
-                memset(au8FillBuffer, 0, HASH_GROUP_LEN);
-                if(u32DataSize >= LAST_GROUP_MAX_LEN)
-                {
-                    if(u8FillFlag == 0U)
-                    {
-                        memcpy(au8FillBuffer, &au8Data[u32Index], u32DataSize);
-                        au8FillBuffer[u32DataSize] = 0x80U;
-                        u8FillFlag = 1U;
-                    }
-                    else
-                    {
-                        u32DataSize = 0UL;
-                    }
-                }
-                else
-                {
-                    memcpy(au8FillBuffer, &au8Data[u32Index], u32DataSize);
-                    au8FillBuffer[u32DataSize] = 0x80U;
-                    u32DataSize = 0UL;
-                }
-                if(0U == u32DataSize)
+                (void)memcpy(pstcCtx->au8Buf, pu8Data, HASH_GROUP_LEN);
+                enRet = HASH_CtxGroup(pstcCtx, pstcCtx->au8Buf);
+            }
+            pu8Data        = &pu8Data[HASH_GROUP_LEN];
+            u32SrcDataSize -= HASH_GROUP_LEN;
+        }
+
+        /* Keep the tail for the next update or the final */
+        if ((enRet == Ok) && (u32SrcDataSize != 0UL))
+        {
+            (void)memcpy(&pstcCtx->au8Buf[pstcCtx->u32BufLen], pu8Data, u32SrcDataSize);
+            pstcCtx->u32BufLen += u32SrcDataSize;
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Pad the message of a streaming context and get the digest.
+ * @param  [in] pstcCtx             Pointer to the context fed by HASH_Update()
+ * @param  [out] au8MsgDigest       Buffer of the digest. The size must be 32 bytes
+ * @retval Ok: Success
+ *         ErrorInvalidParameter: Parameter error
+ *         ErrorTimeout: Process timeout
+ */
+en_result_t HASH_Final(stc_hash_ctx_t *pstcCtx, uint8_t au8MsgDigest[])
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32TimeCount = 0UL;
+
+    if ((pstcCtx != NULL) && (au8MsgDigest != NULL))
+    {
+        enRet = HASH_CtxPadding(pstcCtx, Disable);
+        if ((enRet == Ok) && (pstcCtx->u32Mode == HASH_MODE_HMAC))
+        {
+            while(READ_REG32_BIT(M4_HASH->CR, HASH_CR_HMAC_END) == 0UL)
+            {
+                if (u32TimeCount++ > HASH_TIMEOUT)
                 {
-                    au8FillBuffer[63U] = (uint8_t)(u32BitLenLo);
-                    au8FillBuffer[62U] = (uint8_t)(u32BitLenLo >> 8U);
-                    au8FillBuffer[61U] = (uint8_t)(u32BitLenLo >> 16U);
-                    au8FillBuffer[60U] = (uint8_t)(u32BitLenLo >> 24U);
-                    au8FillBuffer[59U] = (uint8_t)(u32BitLenHi);
-                    au8FillBuffer[58U] = (uint8_t)(u32BitLenHi >> 8U);
-                    au8FillBuffer[57U] = (uint8_t)(u32BitLenHi >> 16U);
-                    au8FillBuffer[56U] = (uint8_t)(u32BitLenHi >> 24U);
-                    u8LastGroup = 1U;
+                    enRet = ErrorTimeout;
+                    break;
                 }
-                HASH_WriteData(au8FillBuffer);
             }
-            /* check if first group */
-            if (0U == u8FirstGroup)
+        }
+        if (enRet == Ok)
+        {
+            /* Clear operation completion flag */
+            CLEAR_REG32_BIT(M4_HASH->CR, HASH_CR_CYC_END | HASH_CR_HMAC_END);
+            /* Get the message digest result */
+            HASH_GetResult(au8MsgDigest);
+        }
+    }
+    return enRet;
+}
+
+#if (DDL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief  Initialize HASH DMA handle structure. Fill each member with default value.
+ * @param  [out] pstcHandle         Pointer to a @ref stc_hash_dma_handle_t structure
+ * @retval Ok: Success
+ *         ErrorInvalidParameter: pstcHandle == NULL
+ */
+en_result_t HASH_DMA_StructInit(stc_hash_dma_handle_t *pstcHandle)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcHandle != NULL)
+    {
+        pstcHandle->DMAx            = M4_DMA1;
+        pstcHandle->u8DmaCh         = DMA_CH0;
+        pstcHandle->pfnCpltCallback = NULL;
+        pstcHandle->enResult        = Ok;
+        pstcHandle->pu8MsgDigest    = NULL;
+        pstcHandle->pu32Tail        = NULL;
+        pstcHandle->stcCtx.u32Mode  = HASH_MODE_SHA_256;
+        enRet = Ok;
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Start a SHA-256 calculation fed by DMA.
+ * @param  [in] pstcHandle          Pointer to a @ref stc_hash_dma_handle_t structure
+ *                                  initialized by HASH_DMA_StructInit(), DMAx, u8DmaCh
+ *                                  and pfnCpltCallback must be set
+ * @param  [in] au32SrcData         Message words, in the word order of the HASH data
+ *                                  registers (big-endian, the first byte of the
+ *                                  message is bits 31~24 of the first word)
+ * @param  [in] u32SrcDataSize      Length of the message in bytes
+ * @param  [out] au8MsgDigest       Buffer of the digest. The size must be 32 bytes
+ * @retval Ok: Calculation started
+ *         ErrorInvalidParameter: Parameter error
+ *         ErrorOperationInProgress: The handle is still busy
+ *         ErrorInvalidMode: The DMA channel is owned by another user, see DMA_ChClaim()
+ *         ErrorTimeout: Process timeout
+ * @note   The complete groups are moved by the DMA channel, which is triggered by
+ *         EVT_HASH and triggers the HASH by its block transfer complete event.
+ *         The channel is claimed by DMA_ChClaim() for the groups and released at
+ *         their end. The padded last group(s) are written by HASH_DMA_TransCpltIrqHandler().
+ *         The clocks of HASH, DMA and AOS must be enabled. The transfer complete
+ *         interrupt of the DMA channel must call HASH_DMA_TransCpltIrqHandler() and
+ *         INT_HASH must call HASH_DMA_IrqHandler().
+ */
+en_result_t HASH_DMA_Start(stc_hash_dma_handle_t *pstcHandle,
+                           const uint32_t au32SrcData[],
+                           uint32_t u32SrcDataSize,
+                           uint8_t au8MsgDigest[])
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcHandle != NULL)   &&
+        (au32SrcData != NULL)  &&
+        (au8MsgDigest != NULL) &&
+        ((u32SrcDataSize / HASH_GROUP_LEN) <= HASH_DMA_MAX_GROUPS))
+    {
+        DDL_ASSERT((pstcHandle->DMAx == M4_DMA1) || (pstcHandle->DMAx == M4_DMA2));
+        DDL_ASSERT(pstcHandle->u8DmaCh <= DMA_CH7);
+
+        if (pstcHandle->enResult == OperationInProgress)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            pstcHandle->pu8MsgDigest = au8MsgDigest;
+            enRet = HASH_CtxReset(&pstcHandle->stcCtx, HASH_MODE_SHA_256);
+            if (enRet == Ok)
             {
-                u8FirstGroup = 1U;
-                /* Set first group. */
-                SET_REG32_BIT(M4_HASH->CR, HASH_CR_FST_GRP);
+                enRet = HASH_DMA_Run(pstcHandle, au32SrcData, u32SrcDataSize);
             }
-            /* check if last group */
-            if (1U == u8LastGroup)
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Start a HMAC calculation whose message is fed by DMA.
+ * @param  [in] pstcHandle          Pointer to a @ref stc_hash_dma_handle_t structure
+ *                                  initialized by HASH_DMA_StructInit(), DMAx, u8DmaCh
+ *                                  and pfnCpltCallback must be set
+ * @param  [in] au32SrcData         Message words, in the word order of the HASH data
+ *                                  registers, see HASH_DMA_Start()
+ * @param  [in] u32SrcDataSize      Length of the message in bytes
+ * @param  [in] au8Key              Buffer of the secret key
+ * @param  [in] u32KeyLength        Length of the input secret key in bytes
+ * @param  [out] au8MsgDigest       Buffer of the digest. The size must be 32 bytes
+ * @retval Ok: Calculation started
+ *         ErrorInvalidParameter: Parameter error
+ *         ErrorOperationInProgress: The handle is still busy
+ *         ErrorInvalidMode: The DMA channel is owned by another user, see DMA_ChClaim()
+ *         ErrorTimeout: Process timeout
+ * @note   The secret key is written by the CPU before the DMA is started.
+ */
+en_result_t HMAC_DMA_Start(stc_hash_dma_handle_t *pstcHandle,
+                           const uint32_t au32SrcData[],
+                           uint32_t u32SrcDataSize,
+                           const uint8_t au8Key[],
+                           uint32_t u32KeyLength,
+                           uint8_t au8MsgDigest[])
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcHandle != NULL)   &&
+        (au32SrcData != NULL)  &&
+        (au8MsgDigest != NULL) &&
+        ((u32SrcDataSize / HASH_GROUP_LEN) <= HASH_DMA_MAX_GROUPS))
+    {
+        DDL_ASSERT((pstcHandle->DMAx == M4_DMA1) || (pstcHandle->DMAx == M4_DMA2));
+        DDL_ASSERT(pstcHandle->u8DmaCh <= DMA_CH7);
+
+        if (pstcHandle->enResult == OperationInProgress)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            pstcHandle->pu8MsgDigest = au8MsgDigest;
+            enRet = HMAC_CtxInit(&pstcHandle->stcCtx, au8Key, u32KeyLength);
+            if (enRet == Ok)
             {
-                u8LastGroup = 0U;
-                /* Set last group. */
-                SET_REG32_BIT(M4_HASH->CR, HASH_CR_KMSG_END);
+                enRet = HASH_DMA_Run(pstcHandle, au32SrcData, u32SrcDataSize);
             }
-            /* Start hash calculating. */
-            SET_REG32_BIT(M4_HASH->CR, HASH_CR_START);
-            /* Wait for operation completion */
-            while(READ_REG32_BIT(M4_HASH->CR, HASH_CR_BUSY))
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  DMA transfer complete IRQ handler of the HASH DMA feed.
+ * @param  [in] pstcHandle          Pointer to the handle passed to HASH_DMA_Start()
+ *                                  or HMAC_DMA_Start()
+ * @retval None
+ * @note   Call it in the transfer complete interrupt callback of the DMA channel.
+ */
+void HASH_DMA_TransCpltIrqHandler(stc_hash_dma_handle_t *pstcHandle)
+{
+    if (pstcHandle != NULL)
+    {
+        DMA_ClearTransIntStatus(pstcHandle->DMAx, (DMA_TC_INT_CH0 << pstcHandle->u8DmaCh));
+        if (pstcHandle->enResult == OperationInProgress)
+        {
+            /* The groups are all moved, the channel is given back */
+            HASH_DMA_Release(pstcHandle);
+            HASH_DMA_Finish(pstcHandle);
+        }
+    }
+}
+
+/**
+ * @brief  HASH IRQ handler of the HASH DMA feed.
+ * @param  [in] pstcHandle          Pointer to the handle passed to HASH_DMA_Start()
+ *                                  or HMAC_DMA_Start()
+ * @retval None
+ * @note   Call it in the INT_HASH interrupt callback. The digest is copied to the
+ *         buffer of the calculation and pfnCpltCallback is called.
+ */
+void HASH_DMA_IrqHandler(stc_hash_dma_handle_t *pstcHandle)
+{
+    if (pstcHandle != NULL)
+    {
+        if ((pstcHandle->stcCtx.u32Mode == HASH_MODE_HMAC) &&
+            (READ_REG32_BIT(M4_HASH->CR, HASH_CR_HMAC_END) == 0UL))
+        {
+            /* Inner hash of HMAC completed, wait for the outer one */
+            CLEAR_REG32_BIT(M4_HASH->CR, HASH_CR_CYC_END);
+        }
+        else
+        {
+            CLEAR_REG32_BIT(M4_HASH->CR, HASH_INT_ALL);
+            CLEAR_REG32_BIT(M4_HASH->CR, HASH_CR_CYC_END | HASH_CR_HMAC_END);
+            if (pstcHandle->enResult == OperationInProgress)
             {
-                if(u32TimeCount++ > HASH_TIMEOUT)
+                HASH_GetResult(pstcHandle->pu8MsgDigest);
+                pstcHandle->enResult = Ok;
+                if (pstcHandle->pfnCpltCallback != NULL)
                 {
-                    enRet = ErrorTimeout;
-                    break;
+                    pstcHandle->pfnCpltCallback();
                 }
             }
         }
     }
+}
+#endif /* DDL_DMA_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup HASH_Local_Functions HASH Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Wait for the HASH to stop.
+ * @param  None
+ * @retval Ok: Success
+ *         ErrorTimeout: Process timeout
+ */
+static en_result_t HASH_WaitStop(void)
+{
+    en_result_t enRet = Ok;
+    uint32_t u32TimeCount = 0UL;
+
+    while(READ_REG32_BIT(M4_HASH->CR, HASH_CR_START))
+    {
+        if (u32TimeCount++ > HASH_TIMEOUT)
+        {
+            enRet = ErrorTimeout;
+            break;
+        }
+    }
     return enRet;
 }
 
+/**
+ * @brief  Wait for the HASH to finish the current group.
+ * @param  None
+ * @retval Ok: Success
+ *         ErrorTimeout: Process timeout
+ */
+static en_result_t HASH_WaitBusy(void)
+{
+    en_result_t enRet = Ok;
+    uint32_t u32TimeCount = 0UL;
+
+    while(READ_REG32_BIT(M4_HASH->CR, HASH_CR_BUSY))
+    {
+        if (u32TimeCount++ > HASH_TIMEOUT)
+        {
+            enRet = ErrorTimeout;
+            break;
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Calculate one group of message or key.
+ * @param  [in] au8Data              The group data, HASH_GROUP_LEN bytes
+ * @param  [in] u32GrpCtrl           Group control, 0 or a value of @ref HASH_Msg_Group
+ * @param  [in] enWait               Enable: wait for the group to be calculated.
+ *                                   Disable: return once the calculation is started.
+ * @retval Ok: Success
+ *         ErrorTimeout: Process timeout
+ */
+static en_result_t HASH_CalcGroup(const uint8_t au8Data[], uint32_t u32GrpCtrl,
+                                  en_functional_state_t enWait)
+{
+    en_result_t enRet;
+
+    enRet = HASH_WaitStop();
+    if (enRet == Ok)
+    {
+        HASH_WriteData(au8Data);
+        if (u32GrpCtrl != 0UL)
+        {
+            SET_REG32_BIT(M4_HASH->CR, u32GrpCtrl);
+        }
+        /* Start hash calculating. */
+        SET_REG32_BIT(M4_HASH->CR, HASH_CR_START);
+        if (enWait == Enable)
+        {
+            /* Wait for operation completion */
+            enRet = HASH_WaitBusy();
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Reset a streaming context and set the HASH mode.
+ * @param  [out] pstcCtx             Pointer to a @ref stc_hash_ctx_t structure
+ * @param  [in] u32Mode              A value of @ref HASH_Mode
+ * @retval Ok: Success
+ *         ErrorTimeout: Process timeout
+ */
+static en_result_t HASH_CtxReset(stc_hash_ctx_t *pstcCtx, uint32_t u32Mode)
+{
+    pstcCtx->u32Mode       = u32Mode;
+    pstcCtx->u32MsgLenLow  = 0UL;
+    pstcCtx->u32MsgLenHigh = 0UL;
+    pstcCtx->u32GrpCnt     = 0UL;
+    pstcCtx->u32BufLen     = 0UL;
+
+    return HASH_SetMode(u32Mode);
+}
+
+/**
+ * @brief  Calculate one complete message group of a streaming context.
+ * @param  [in] pstcCtx              Pointer to the context
+ * @param  [in] au8Data              The group data, HASH_GROUP_LEN bytes
+ * @retval Ok: Success
+ *         ErrorTimeout: Process timeout
+ */
+static en_result_t HASH_CtxGroup(stc_hash_ctx_t *pstcCtx, const uint8_t au8Data[])
+{
+    en_result_t enRet;
+
+    enRet = HASH_CalcGroup(au8Data, (pstcCtx->u32GrpCnt == 0UL) ? HASH_MSG_GRP_FIRST : 0UL, Enable);
+    pstcCtx->u32GrpCnt++;
+    return enRet;
+}
+
+/**
+ * @brief  Pad the pending bytes of a streaming context and calculate the
+ *         last group(s).
+ * @param  [in] pstcCtx              Pointer to the context
+ * @param  [in] enLastGrpInt         Enable: enable HASH_INT_ALL and return once
+ *                                   the last group is started.
+ *                                   Disable: wait for the last group.
+ * @retval Ok: Success
+ *         ErrorTimeout: Process timeout
+ */
+static en_result_t HASH_CtxPadding(stc_hash_ctx_t *pstcCtx,
+                                   en_functional_state_t enLastGrpInt)
+{
+    en_result_t enRet = Ok;
+    uint32_t u32GrpCtrl = HASH_MSG_GRP_END;
+    uint32_t u32BitLenHi;
+    uint32_t u32BitLenLo;
+    uint8_t *pu8Buf = pstcCtx->au8Buf;
+
+    u32BitLenHi = (pstcCtx->u32MsgLenHigh << 3UL) | (pstcCtx->u32MsgLenLow >> 29UL);
+    u32BitLenLo = (pstcCtx->u32MsgLenLow << 3UL);
+
+    pu8Buf[pstcCtx->u32BufLen] = 0x80U;
+    pstcCtx->u32BufLen++;
+    if (pstcCtx->u32BufLen > LAST_GROUP_MAX_LEN)
+    {
+        /* No room for the bit length, it goes to an extra group */
+        (void)memset(&pu8Buf[pstcCtx->u32BufLen], 0, HASH_GROUP_LEN - pstcCtx->u32BufLen);
+        enRet = HASH_CtxGroup(pstcCtx, pu8Buf);
+        pstcCtx->u32BufLen = 0UL;
+    }
+    if (enRet == Ok)
+    {
+        (void)memset(&pu8Buf[pstcCtx->u32BufLen], 0, LAST_GROUP_MAX_LEN - pstcCtx->u32BufLen);
+        pu8Buf[63U] = (uint8_t)(u32BitLenLo);
+        pu8Buf[62U] = (uint8_t)(u32BitLenLo >> 8U);
+        pu8Buf[61U] = (uint8_t)(u32BitLenLo >> 16U);
+        pu8Buf[60U] = (uint8_t)(u32BitLenLo >> 24U);
+        pu8Buf[59U] = (uint8_t)(u32BitLenHi);
+        pu8Buf[58U] = (uint8_t)(u32BitLenHi >> 8U);
+        pu8Buf[57U] = (uint8_t)(u32BitLenHi >> 16U);
+        pu8Buf[56U] = (uint8_t)(u32BitLenHi >> 24U);
+        if (pstcCtx->u32GrpCnt == 0UL)
+        {
+            u32GrpCtrl = HASH_MSG_GRP_ONLY_ONE;
+        }
+        if (enLastGrpInt == Enable)
+        {
+            SET_REG32_BIT(M4_HASH->CR, HASH_INT_ALL);
+        }
+        enRet = HASH_CalcGroup(pu8Buf, u32GrpCtrl, (enLastGrpInt == Enable) ? Disable : Enable);
+        pstcCtx->u32GrpCnt++;
+        pstcCtx->u32BufLen = 0UL;
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Calculate the secret key of HMAC.
+ * @param  [in] au8Key               Buffer of the secret key
+ * @param  [in] u32KeyLength         Length of the secret key in bytes
+ * @retval Ok: Success
+ *         ErrorTimeout: Process timeout
+ */
+static en_result_t HMAC_KeyCalc(const uint8_t au8Key[], uint32_t u32KeyLength)
+{
+    en_result_t enRet;
+    stc_hash_ctx_t stcKeyCtx;
+
+    if (u32KeyLength > HASH_GROUP_LEN)
+    {
+        enRet = HASH_SetKeyLength(HASH_KEY_LEN_LONG);
+        if (enRet == Ok)
+        {
+            /* The long key is hashed as a message */
+            stcKeyCtx.u32Mode       = HASH_MODE_HMAC;
+            stcKeyCtx.u32MsgLenLow  = 0UL;
+            stcKeyCtx.u32MsgLenHigh = 0UL;
+            stcKeyCtx.u32GrpCnt     = 0UL;
+            stcKeyCtx.u32BufLen     = 0UL;
+            enRet = HASH_Update(&stcKeyCtx, au8Key, u32KeyLength);
+        }
+        if (enRet == Ok)
+        {
+            enRet = HASH_CtxPadding(&stcKeyCtx, Disable);
+        }
+    }
+    else
+    {
+        enRet = HASH_SetKeyLength(HASH_KEY_LEN_SHORT);
+        if (enRet == Ok)
+        {
+            (void)memset(stcKeyCtx.au8Buf, 0, HASH_GROUP_LEN);
+            (void)memcpy(stcKeyCtx.au8Buf, au8Key, u32KeyLength);
+            enRet = HASH_CalcGroup(stcKeyCtx.au8Buf, HASH_MSG_GRP_ONLY_ONE, Enable);
+        }
+    }
+    /* Clear operation completion flag */
+    CLEAR_REG32_BIT(M4_HASH->CR, HASH_CR_CYC_END);
+    return enRet;
+}
+
+#if (DDL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief  Program the DMA channel for the complete groups of the message and
+ *         start the HASH, or finish at once if there is no complete group.
+ * @param  [in] pstcHandle          Pointer to the handle
+ * @param  [in] au32SrcData         Message words
+ * @param  [in] u32SrcDataSize      Length of the message in bytes
+ * @retval Ok: Calculation started
+ *         ErrorInvalidMode: The DMA channel is owned by another user
+ *         ErrorTimeout: Process timeout
+ */
+static en_result_t HASH_DMA_Run(stc_hash_dma_handle_t *pstcHandle,
+                                const uint32_t au32SrcData[],
+                                uint32_t u32SrcDataSize)
+{
+    en_result_t enRet = Ok;
+    stc_dma_init_t stcDmaInit;
+    stc_dma_rpt_init_t stcDmaRptInit;
+    uint32_t u32GrpNum = u32SrcDataSize / HASH_GROUP_LEN;
+    uint32_t u32BtcEvt;
+
+    pstcHandle->stcCtx.u32MsgLenLow = u32SrcDataSize;
+    pstcHandle->stcCtx.u32BufLen    = u32SrcDataSize % HASH_GROUP_LEN;
+    pstcHandle->pu32Tail            = &au32SrcData[u32GrpNum * HASH_GROUP_WORDS];
+    pstcHandle->enResult            = OperationInProgress;
+
+    if (u32GrpNum == 0UL)
+    {
+        HASH_DMA_Finish(pstcHandle);
+        enRet = pstcHandle->enResult;
+        if (enRet == OperationInProgress)
+        {
+            enRet = Ok;
+        }
+    }
+    else
+    {
+        pstcHandle->stcDmaCh.DMAx           = pstcHandle->DMAx;
+        pstcHandle->stcDmaCh.u8Ch           = pstcHandle->u8DmaCh;
+        pstcHandle->stcDmaCh.pfnTcCallback  = NULL;
+        pstcHandle->stcDmaCh.pfnBtcCallback = NULL;
+        pstcHandle->stcDmaCh.pfnErrCallback = NULL;
+        enRet = DMA_ChClaim(&pstcHandle->stcDmaCh, EVT_HASH);
+        if (enRet != Ok)
+        {
+            pstcHandle->enResult = enRet;
+        }
+        else
+        {
+            (void)DMA_StructInit(&stcDmaInit);
+            stcDmaInit.u32IntEn     = DMA_INT_ENABLE;
+            stcDmaInit.u32SrcAddr   = (uint32_t)(&au32SrcData[0U]);
+            stcDmaInit.u32DestAddr  = (uint32_t)(&M4_HASH->DR15);
+            stcDmaInit.u32DataWidth = DMA_DATAWIDTH_32BIT;
+            stcDmaInit.u32BlockSize = HASH_GROUP_WORDS;
+            stcDmaInit.u32TransCnt  = u32GrpNum;
+            stcDmaInit.u32SrcInc    = DMA_SRC_ADDR_INC;
+            stcDmaInit.u32DestInc   = DMA_DEST_ADDR_INC;
+            (void)DMA_Init(pstcHandle->DMAx, pstcHandle->u8DmaCh, &stcDmaInit);
+
+            /* Every block rewinds to DR15 */
+            (void)DMA_RepeatStructInit(&stcDmaRptInit);
+            stcDmaRptInit.u32DestRptEn   = DMA_DEST_RPT_ENABLE;
+            stcDmaRptInit.u32DestRptSize = HASH_GROUP_WORDS;
+            (void)DMA_RepeatInit(pstcHandle->DMAx, pstcHandle->u8DmaCh, &stcDmaRptInit);
+
+            /* Only the completion of the whole transfer is of interest */
+            DMA_ClearTransIntStatus(pstcHandle->DMAx,
+                                    ((DMA_TC_INT_CH0 | DMA_BTC_INT_CH0) << pstcHandle->u8DmaCh));
+            DMA_TransIntCmd(pstcHandle->DMAx, (DMA_BTC_INT_CH0 << pstcHandle->u8DmaCh), Disable);
+            DMA_TransIntCmd(pstcHandle->DMAx, (DMA_TC_INT_CH0 << pstcHandle->u8DmaCh), Enable);
+
+            /* HASH group done requests the next block (set by DMA_ChClaim()), block done starts the HASH.
+               Both selects are written, so that no trigger of an earlier user is left */
+            u32BtcEvt = ((pstcHandle->DMAx == M4_DMA1) ? (uint32_t)EVT_DMA1_BTC0 : (uint32_t)EVT_DMA2_BTC0) + \
+                        pstcHandle->u8DmaCh;
+            WRITE_REG32(M4_AOS->HASH_ITRGSELA, EVT_MAX);
+            WRITE_REG32(M4_AOS->HASH_ITRGSELB, EVT_MAX);
+            HASH_SetTriggerSrc((en_event_src_t)u32BtcEvt);
+
+            DMA_Cmd(pstcHandle->DMAx, Enable);
+            DMA_ChannelCmd(pstcHandle->DMAx, pstcHandle->u8DmaCh, Enable);
+
+            /* Groups written by the DMA, the first one is flagged here */
+            pstcHandle->stcCtx.u32GrpCnt = u32GrpNum;
+            enRet = HASH_MsgGrpConfig(HASH_MSG_GRP_FIRST);
+            if (enRet == Ok)
+            {
+                enRet = HASH_Start();
+            }
+            if (enRet != Ok)
+            {
+                HASH_DMA_Release(pstcHandle);
+                pstcHandle->enResult = enRet;
+            }
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Pad the trailing bytes of the message and start the last group(s),
+ *         the end is signalled by HASH_INT_ALL.
+ * @param  [in] pstcHandle          Pointer to the handle
+ * @retval None
+ */
+static void HASH_DMA_Finish(stc_hash_dma_handle_t *pstcHandle)
+{
+    en_result_t enRet;
+    uint32_t i;
+    stc_hash_ctx_t *pstcCtx = &pstcHandle->stcCtx;
+
+    /* The last DMA group may still be calculated */
+    enRet = HASH_WaitStop();
+    if (enRet == Ok)
+    {
+        enRet = HASH_WaitBusy();
+    }
+    if (enRet == Ok)
+    {
+        for (i = 0UL; i < pstcCtx->u32BufLen; i++)
+        {
+            pstcCtx->au8Buf[i] = (uint8_t)(pstcHandle->pu32Tail[i >> 2U] >> (24UL - ((i & 0x03UL) << 3U)));
+        }
+        enRet = HASH_CtxPadding(pstcCtx, Enable);
+    }
+    if (enRet != Ok)
+    {
+        CLEAR_REG32_BIT(M4_HASH->CR, HASH_INT_ALL);
+        pstcHandle->enResult = enRet;
+        if (pstcHandle->pfnCpltCallback != NULL)
+        {
+            pstcHandle->pfnCpltCallback();
+        }
+    }
+}
+
+/**
+ * @brief  Release the DMA channel of the HASH DMA feed and clear both HASH
+ *         trigger selects.
+ * @param  [in] pstcHandle          Pointer to the handle
+ * @retval None
+ * @note   DMA_ChFree() disables the channel and masks its interrupts.
+ */
+static void HASH_DMA_Release(stc_hash_dma_handle_t *pstcHandle)
+{
+    WRITE_REG32(M4_AOS->HASH_ITRGSELA, EVT_MAX);
+    WRITE_REG32(M4_AOS->HASH_ITRGSELB, EVT_MAX);
+    (void)DMA_ChFree(&pstcHandle->stcDmaCh);
+}
+#endif /* DDL_DMA_ENABLE */
+
 /**
  * @brief  Writes the input buffer in data register.
  * @param  [in] au8Data       The buffer for source data
  * @retval None
  */
-static void HASH_WriteData(uint8_t au8Data[])
+static void HASH_WriteData(const uint8_t au8Data[])
 {
     uint8_t  i;
     uint32_t u32Temp1;
@@ -8,6 +8,8 @@
    Date             Author          Notes
    2020-06-12       Wangmin         First version
    2020-08-31       Wangmin         Modify for MISRAC2012
+   2026-10-17       Wangmin         Add DMA transaction queue SPI_DmaInit/SPI_DmaTransfer/SPI_DmaIrqHandler
+   2026-10-17       Wangmin         Claim the DMA channels of the queue, add SPI_DmaAbort/SPI_DmaErrIrqHandler
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -273,6 +275,11 @@
 (   ((x) != 0UL)                            &&                                 \
     (((x) | SPI_CLR_STD_MASK) == SPI_CLR_STD_MASK))
 
+/*! Parameter valid check for SPI DMA transaction length */
+#define IS_SPI_DMA_XFER_LEN(x)                                                 \
+(   ((x) != 0UL)                            &&                                 \
+    ((x) <= 0xFFFFUL))
+
 /**
  * @}
  */
@@ -295,6 +302,12 @@
 
 static en_result_t SPI_TxRx(M4_SPI_TypeDef *SPIx, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Length);
 static en_result_t SPI_Tx(M4_SPI_TypeDef *SPIx, const void *pvTxBuf, uint32_t u32Length);
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_GPIO_ENABLE == DDL_ON)
+static void SPI_DmaGetEvent(const M4_SPI_TypeDef *SPIx, en_event_src_t *penTxEvt, en_event_src_t *penRxEvt);
+static void SPI_DmaCsCmd(const stc_spi_dma_dev_t *pstcDev, en_functional_state_t enNewState);
+static void SPI_DmaStart(stc_spi_dma_t *pstcSpiDma);
+static func_ptr_t SPI_DmaFinish(stc_spi_dma_t *pstcSpiDma, en_result_t enResult);
+#endif /* DDL_DMA_ENABLE && DDL_GPIO_ENABLE */
 
 /**
  * @}
@@ -935,6 +948,308 @@ en_result_t SPI_TransmitReceive(M4_SPI_TypeDef *SPIx, const void *pvTxBuf, void
     }
     return enRet;
 }
+
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_GPIO_ENABLE == DDL_ON)
+/**
+ * @brief  Set a default value for the SPI DMA transaction queue initialization structure.
+ * @param  [in]  pstcInit           Pointer to a stc_spi_dma_init_t structure that
+ *                                  contains configuration information.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:   pstcInit == NULL.
+ */
+en_result_t SPI_DmaStructInit(stc_spi_dma_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcInit)
+    {
+        pstcInit->TxDMAx       = M4_DMA1;
+        pstcInit->u8TxDmaCh    = DMA_CH0;
+        pstcInit->RxDMAx       = M4_DMA1;
+        pstcInit->u8RxDmaCh    = DMA_CH1;
+        pstcInit->pstcDev      = NULL;
+        pstcInit->u32DevNum    = 0UL;
+        pstcInit->pstcQueue    = NULL;
+        pstcInit->u32QueueSize = 0UL;
+        enRet = Ok;
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Initializes the DMA transaction queue of a SPI master shared by several devices.
+ * @param  [out] pstcSpiDma         Pointer to a stc_spi_dma_t structure, kept while the queue is used.
+ * @param  [in]  SPIx               SPI unit, initialized by SPI_Init() as a full duplex master
+ *                                  with u32FrameLevel = SPI_FRAME_1
+ *         @arg M4_SPI1
+ *         @arg M4_SPI2
+ *         @arg M4_SPI3
+ *         @arg M4_SPI4
+ *         @arg M4_SPI5
+ *         @arg M4_SPI6
+ * @param  [in]  pstcInit           Pointer to a stc_spi_dma_init_t structure that contains
+ *                                  the configuration information for the queue.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                      No errors occurred
+ *   @arg  ErrorInvalidParameter:   NULL pointer, u32DevNum == 0U or u32QueueSize < 2U
+ *   @arg  ErrorInvalidMode:        The TX or RX DMA channel is owned by another user, see DMA_ChClaim()
+ * @note   -The CS pins of the devices are driven by GPIO. Use SPI_WIRE_3 so that the SS pins
+ *          of the SPI are not driven.
+ *         -The CS pins are set inactive here. The DMA channels are claimed by DMA_ChClaim() and
+ *          kept while the queue is used. The clocks of the DMA units and AOS are enabled by
+ *          the application.
+ *         -Call SPI_DmaIrqHandler() from the transfer complete interrupt of the RX DMA channel,
+ *          and SPI_DmaErrIrqHandler() from the error interrupt of the SPI, enabled here.
+ *         -The frame level (CFG1.FTHLV) must be one frame: each TX buffer empty and RX buffer
+ *          full event then moves one data, as each DMA block is one data.
+ */
+en_result_t SPI_DmaInit(stc_spi_dma_t *pstcSpiDma, M4_SPI_TypeDef *SPIx, const stc_spi_dma_init_t *pstcInit)
+{
+    uint32_t i;
+    en_event_src_t enTxEvt;
+    en_event_src_t enRxEvt;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    DDL_ASSERT(IS_VALID_SPI_UNIT(SPIx));
+    DDL_ASSERT(SPI_FRAME_1 == READ_REG32_BIT(SPIx->CFG1, SPI_CFG1_FTHLV));
+
+    if ((NULL != pstcSpiDma) && (NULL != pstcInit) && (NULL != pstcInit->pstcDev) &&
+        (NULL != pstcInit->pstcQueue) && (0UL != pstcInit->u32DevNum) && (pstcInit->u32QueueSize >= 2UL))
+    {
+        SPI_DmaGetEvent(SPIx, &enTxEvt, &enRxEvt);
+
+        /* Claim the channels with their triggers, the RX one is released if the TX one is owned */
+        pstcSpiDma->stcRxDmaCh.DMAx = pstcInit->RxDMAx;
+        pstcSpiDma->stcRxDmaCh.u8Ch = pstcInit->u8RxDmaCh;
+        pstcSpiDma->stcRxDmaCh.pfnTcCallback = NULL;
+        pstcSpiDma->stcRxDmaCh.pfnBtcCallback = NULL;
+        pstcSpiDma->stcRxDmaCh.pfnErrCallback = NULL;
+        pstcSpiDma->stcTxDmaCh.DMAx = pstcInit->TxDMAx;
+        pstcSpiDma->stcTxDmaCh.u8Ch = pstcInit->u8TxDmaCh;
+        pstcSpiDma->stcTxDmaCh.pfnTcCallback = NULL;
+        pstcSpiDma->stcTxDmaCh.pfnBtcCallback = NULL;
+        pstcSpiDma->stcTxDmaCh.pfnErrCallback = NULL;
+        enRet = DMA_ChClaim(&pstcSpiDma->stcRxDmaCh, enRxEvt);
+        if (Ok == enRet)
+        {
+            enRet = DMA_ChClaim(&pstcSpiDma->stcTxDmaCh, enTxEvt);
+            if (Ok != enRet)
+            {
+                (void)DMA_ChFree(&pstcSpiDma->stcRxDmaCh);
+            }
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        pstcSpiDma->SPIx         = SPIx;
+        pstcSpiDma->pstcDev      = pstcInit->pstcDev;
+        pstcSpiDma->u32DevNum    = pstcInit->u32DevNum;
+        pstcSpiDma->pstcQueue    = pstcInit->pstcQueue;
+        pstcSpiDma->u32QueueSize = pstcInit->u32QueueSize;
+        pstcSpiDma->u32Head      = 0UL;
+        pstcSpiDma->u32Tail      = 0UL;
+        pstcSpiDma->u8Busy       = 0U;
+        pstcSpiDma->enXferResult = Ok;
+        pstcSpiDma->u32TxDummy   = 0xFFFFFFFFUL;
+        pstcSpiDma->u32RxDummy   = 0UL;
+
+        for (i = 0UL; i < pstcInit->u32DevNum; i++)
+        {
+            DDL_ASSERT(IS_SPI_SS_ACTIVE_LEVEL(pstcInit->pstcDev[i].u32CsActiveLevel));
+            SPI_DmaCsCmd(&pstcInit->pstcDev[i], Disable);
+        }
+
+        SPI_FunctionCmd(SPIx, Disable);
+
+        /* TX: started by the TX buffer empty event when the SPI is enabled */
+        DMA_Cmd(pstcSpiDma->stcTxDmaCh.DMAx, Enable);
+
+        /* RX: the end of the RX is the end of the transaction */
+        DMA_TransIntCmd(pstcSpiDma->stcRxDmaCh.DMAx, (1UL << pstcSpiDma->stcRxDmaCh.u8Ch), Enable);
+        DMA_Cmd(pstcSpiDma->stcRxDmaCh.DMAx, Enable);
+
+        /* An overload or a mode fault stops the RX, the transaction is aborted on it */
+        SPI_ClearFlag(SPIx, SPI_CLR_STD_MASK);
+        SPI_IntCmd(SPIx, SPI_INT_ERROR, Enable);
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Queue a transaction of the SPI DMA transaction queue, and start it if the bus is idle.
+ * @param  [in]  pstcSpiDma         Pointer to a stc_spi_dma_t structure
+ * @param  [in]  pstcXfer           Pointer to a stc_spi_dma_xfer_t structure, copied in the queue.
+ *                                  The buffers are kept until pfnCpltCallback is called.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                      The transaction is queued
+ *   @arg  ErrorBufferFull:         The queue is full
+ *   @arg  ErrorInvalidParameter:   NULL pointer, invalid u32DevId or u32Length
+ * @note   The slot is reserved and the transaction published with the interrupts masked, so the
+ *         thread and a pfnCpltCallback may both queue: a callback may queue the next transaction
+ *         of its device.
+ */
+en_result_t SPI_DmaTransfer(stc_spi_dma_t *pstcSpiDma, const stc_spi_dma_xfer_t *pstcXfer)
+{
+    uint32_t u32Tail;
+    uint32_t u32Primask;
+    uint8_t u8Start = 0U;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcSpiDma) && (NULL != pstcXfer))
+    {
+        if ((pstcXfer->u32DevId < pstcSpiDma->u32DevNum) && IS_SPI_DMA_XFER_LEN(pstcXfer->u32Length))
+        {
+            /* Reserve, fill and publish the slot, and take the idle bus, with the interrupts masked */
+            u32Primask = __get_PRIMASK();
+            __disable_irq();
+            u32Tail = pstcSpiDma->u32Tail + 1UL;
+            u32Tail = (u32Tail < pstcSpiDma->u32QueueSize) ? u32Tail : 0UL;
+            if (u32Tail == pstcSpiDma->u32Head)
+            {
+                enRet = ErrorBufferFull;
+            }
+            else
+            {
+                pstcSpiDma->pstcQueue[pstcSpiDma->u32Tail] = *pstcXfer;
+                pstcSpiDma->u32Tail = u32Tail;
+                if (0U == pstcSpiDma->u8Busy)
+                {
+                    pstcSpiDma->u8Busy = 1U;
+                    u8Start = 1U;
+                }
+                enRet = Ok;
+            }
+            __set_PRIMASK(u32Primask);
+
+            if (0U != u8Start)
+            {
+                SPI_DmaStart(pstcSpiDma);
+            }
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Get the busy status of the SPI DMA transaction queue.
+ * @param  [in]  pstcSpiDma         Pointer to a stc_spi_dma_t structure
+ * @retval An en_flag_status_t enumeration value:
+ *   @arg  Set:                     A transaction is in progress or queued
+ *   @arg  Reset:                   The queue is empty and the bus is idle
+ */
+en_flag_status_t SPI_DmaGetBusyStatus(const stc_spi_dma_t *pstcSpiDma)
+{
+    en_flag_status_t enFlag = Reset;
+
+    if (NULL != pstcSpiDma)
+    {
+        if (0U != pstcSpiDma->u8Busy)
+        {
+            enFlag = Set;
+        }
+    }
+    return enFlag;
+}
+
+/**
+ * @brief  SPI DMA transaction queue interrupt handler: release CS, start the next transaction
+ *         and call the callback of the finished one.
+ * @param  [in]  pstcSpiDma         Pointer to a stc_spi_dma_t structure
+ * @retval None
+ * @note   Call it from the transfer complete interrupt of the RX DMA channel.
+ */
+void SPI_DmaIrqHandler(stc_spi_dma_t *pstcSpiDma)
+{
+    func_ptr_t pfnCpltCallback = NULL;
+
+    if (NULL != pstcSpiDma)
+    {
+        if (Set == DMA_GetTransIntStatus(pstcSpiDma->stcRxDmaCh.DMAx, (1UL << pstcSpiDma->stcRxDmaCh.u8Ch)))
+        {
+            DMA_ClearTransIntStatus(pstcSpiDma->stcRxDmaCh.DMAx, (1UL << pstcSpiDma->stcRxDmaCh.u8Ch));
+            DMA_ClearTransIntStatus(pstcSpiDma->stcTxDmaCh.DMAx, (1UL << pstcSpiDma->stcTxDmaCh.u8Ch));
+            if (pstcSpiDma->u32Head != pstcSpiDma->u32Tail)
+            {
+                pfnCpltCallback = SPI_DmaFinish(pstcSpiDma, Ok);
+            }
+        }
+    }
+
+    if (NULL != pfnCpltCallback)
+    {
+        pfnCpltCallback();
+    }
+}
+
+/**
+ * @brief  Abort the transaction in progress of the SPI DMA transaction queue: stop both DMA
+ *         channels, release CS, start the next transaction and call the callback of the aborted one.
+ * @param  [in]  pstcSpiDma         Pointer to a stc_spi_dma_t structure
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                      The transaction in progress is aborted
+ *   @arg  ErrorInvalidParameter:   NULL pointer
+ *   @arg  ErrorInvalidMode:        No transaction in progress
+ * @note   -The pfnCpltCallback of the aborted transaction sees enXferResult == Error, the data
+ *          received so far is in pvRxBuf.
+ *         -The channels are stopped and the transaction removed with the interrupts masked, so
+ *          it may be called from the thread, e.g. on a timeout, while the RX DMA completes.
+ */
+en_result_t SPI_DmaAbort(stc_spi_dma_t *pstcSpiDma)
+{
+    uint32_t u32Primask;
+    func_ptr_t pfnCpltCallback = NULL;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcSpiDma)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        if ((0U == pstcSpiDma->u8Busy) || (pstcSpiDma->u32Head == pstcSpiDma->u32Tail))
+        {
+            enRet = ErrorInvalidMode;
+        }
+        else
+        {
+            /* A completion pending on the stopped channels is dropped with them */
+            DMA_ChannelCmd(pstcSpiDma->stcRxDmaCh.DMAx, pstcSpiDma->stcRxDmaCh.u8Ch, Disable);
+            DMA_ChannelCmd(pstcSpiDma->stcTxDmaCh.DMAx, pstcSpiDma->stcTxDmaCh.u8Ch, Disable);
+            DMA_ClearTransIntStatus(pstcSpiDma->stcRxDmaCh.DMAx, (1UL << pstcSpiDma->stcRxDmaCh.u8Ch));
+            DMA_ClearTransIntStatus(pstcSpiDma->stcTxDmaCh.DMAx, (1UL << pstcSpiDma->stcTxDmaCh.u8Ch));
+            pfnCpltCallback = SPI_DmaFinish(pstcSpiDma, Error);
+            enRet = Ok;
+        }
+        __set_PRIMASK(u32Primask);
+    }
+
+    if (NULL != pfnCpltCallback)
+    {
+        pfnCpltCallback();
+    }
+    return enRet;
+}
+
+/**
+ * @brief  SPI DMA transaction queue error interrupt handler: abort the transaction in progress
+ *         on an overload, a mode fault, a parity error or an underload.
+ * @param  [in]  pstcSpiDma         Pointer to a stc_spi_dma_t structure
+ * @retval None
+ * @note   Call it from the error interrupt of the SPI. An overload or a mode fault stops the
+ *         RX DMA, the RX transfer complete interrupt then never comes.
+ */
+void SPI_DmaErrIrqHandler(stc_spi_dma_t *pstcSpiDma)
+{
+    if (NULL != pstcSpiDma)
+    {
+        if (Set == SPI_GetStatus(pstcSpiDma->SPIx, SPI_CLR_STD_MASK))
+        {
+            SPI_ClearFlag(pstcSpiDma->SPIx, SPI_CLR_STD_MASK);
+            (void)SPI_DmaAbort(pstcSpiDma);
+        }
+    }
+}
+#endif /* DDL_DMA_ENABLE && DDL_GPIO_ENABLE */
 /**
  * @}
  */
@@ -1107,6 +1422,189 @@ static en_result_t SPI_Tx(M4_SPI_TypeDef *SPIx, const void *pvTxBuf, uint32_t u3
     return enRet;
 }
 
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_GPIO_ENABLE == DDL_ON)
+/**
+ * @brief  Get the TX and RX DMA trigger events of a SPI unit.
+ * @param  [in]  SPIx               SPI unit
+ *         @arg M4_SPI1
+ *         @arg M4_SPI2
+ *         @arg M4_SPI3
+ *         @arg M4_SPI4
+ *         @arg M4_SPI5
+ *         @arg M4_SPI6
+ * @param  [out] penTxEvt           TX buffer empty event
+ * @param  [out] penRxEvt           RX buffer full event
+ * @retval None
+ */
+static void SPI_DmaGetEvent(const M4_SPI_TypeDef *SPIx, en_event_src_t *penTxEvt, en_event_src_t *penRxEvt)
+{
+    if (M4_SPI1 == SPIx)
+    {
+        *penTxEvt = EVT_SPI1_SPTI;
+        *penRxEvt = EVT_SPI1_SPRI;
+    }
+    else if (M4_SPI2 == SPIx)
+    {
+        *penTxEvt = EVT_SPI2_SPTI;
+        *penRxEvt = EVT_SPI2_SPRI;
+    }
+    else if (M4_SPI3 == SPIx)
+    {
+        *penTxEvt = EVT_SPI3_SPTI;
+        *penRxEvt = EVT_SPI3_SPRI;
+    }
+    else if (M4_SPI4 == SPIx)
+    {
+        *penTxEvt = EVT_SPI4_SPTI;
+        *penRxEvt = EVT_SPI4_SPRI;
+    }
+    else if (M4_SPI5 == SPIx)
+    {
+        *penTxEvt = EVT_SPI5_SPTI;
+        *penRxEvt = EVT_SPI5_SPRI;
+    }
+    else
+    {
+        *penTxEvt = EVT_SPI6_SPTI;
+        *penRxEvt = EVT_SPI6_SPRI;
+    }
+}
+
+/**
+ * @brief  Drive the CS pin of a device of the SPI DMA transaction queue.
+ * @param  [in]  pstcDev            Pointer to the device
+ * @param  [in]  enNewState         An en_functional_state_t enumeration value.
+ *   @arg  Enable:                  CS active
+ *   @arg  Disable:                 CS inactive
+ * @retval None
+ */
+static void SPI_DmaCsCmd(const stc_spi_dma_dev_t *pstcDev, en_functional_state_t enNewState)
+{
+    if ((SPI_SS_ACTIVE_HIGH == pstcDev->u32CsActiveLevel) == (Enable == enNewState))
+    {
+        GPIO_SetPins(pstcDev->u8CsPort, pstcDev->u16CsPin);
+    }
+    else
+    {
+        GPIO_ResetPins(pstcDev->u8CsPort, pstcDev->u16CsPin);
+    }
+}
+
+/**
+ * @brief  Start the transaction at the head of the SPI DMA transaction queue.
+ * @param  [in]  pstcSpiDma         Pointer to a stc_spi_dma_t structure
+ * @retval None
+ * @note   The bus settings of the device are loaded with the SPI disabled, and the SPI is
+ *         enabled last: its TX buffer empty event starts the TX DMA.
+ */
+static void SPI_DmaStart(stc_spi_dma_t *pstcSpiDma)
+{
+    uint32_t u32DataWidth;
+    stc_dma_init_t stcDmaInit;
+    const stc_spi_dma_xfer_t *pstcXfer = &pstcSpiDma->pstcQueue[pstcSpiDma->u32Head];
+    const stc_spi_dma_dev_t *pstcDev = &pstcSpiDma->pstcDev[pstcXfer->u32DevId];
+    M4_SPI_TypeDef *SPIx = pstcSpiDma->SPIx;
+
+    DDL_ASSERT(IS_SPI_SPI_MODE(pstcDev->u32SpiMode));
+    DDL_ASSERT(IS_SPI_BIT_RATE_DIV(pstcDev->u32BaudRatePrescaler));
+    DDL_ASSERT(IS_SPI_DATA_SIZE(pstcDev->u32DataBits));
+    DDL_ASSERT(IS_SPI_FIRST_BIT(pstcDev->u32FirstBit));
+
+    SPI_FunctionCmd(SPIx, Disable);
+    /* Only the bus settings of the device, the other fields of CFG2 are kept from SPI_Init() */
+    MODIFY_REG32(SPIx->CFG2,
+                 (SPI_CFG2_CPHA | SPI_CFG2_CPOL | SPI_CFG2_MBR | SPI_CFG2_DSIZE | SPI_CFG2_LSBF),
+                 (pstcDev->u32SpiMode | pstcDev->u32BaudRatePrescaler | pstcDev->u32DataBits | pstcDev->u32FirstBit));
+    SPI_ClearFlag(SPIx, SPI_CLR_STD_MASK);
+
+    if (pstcDev->u32DataBits <= SPI_DATA_SIZE_8BIT)
+    {
+        u32DataWidth = DMA_DATAWIDTH_8BIT;
+    }
+    else if (pstcDev->u32DataBits <= SPI_DATA_SIZE_16BIT)
+    {
+        u32DataWidth = DMA_DATAWIDTH_16BIT;
+    }
+    else
+    {
+        u32DataWidth = DMA_DATAWIDTH_32BIT;
+    }
+
+    (void)DMA_StructInit(&stcDmaInit);
+    stcDmaInit.u32BlockSize = 1UL;
+    stcDmaInit.u32TransCnt  = pstcXfer->u32Length;
+    stcDmaInit.u32DataWidth = u32DataWidth;
+
+    /* RX: the data register to the RX buffer or to the dummy */
+    stcDmaInit.u32IntEn     = DMA_INT_ENABLE;
+    stcDmaInit.u32SrcAddr   = (uint32_t)(&SPIx->DR);
+    stcDmaInit.u32SrcInc    = DMA_SRC_ADDR_FIX;
+    if (NULL != pstcXfer->pvRxBuf)
+    {
+        stcDmaInit.u32DestAddr = (uint32_t)pstcXfer->pvRxBuf;
+        stcDmaInit.u32DestInc  = DMA_DEST_ADDR_INC;
+    }
+    else
+    {
+        stcDmaInit.u32DestAddr = (uint32_t)(&pstcSpiDma->u32RxDummy);
+        stcDmaInit.u32DestInc  = DMA_DEST_ADDR_FIX;
+    }
+    (void)DMA_Init(pstcSpiDma->stcRxDmaCh.DMAx, pstcSpiDma->stcRxDmaCh.u8Ch, &stcDmaInit);
+
+    /* TX: the TX buffer or the dummy to the data register */
+    stcDmaInit.u32IntEn     = DMA_INT_DISABLE;
+    stcDmaInit.u32DestAddr  = (uint32_t)(&SPIx->DR);
+    stcDmaInit.u32DestInc   = DMA_DEST_ADDR_FIX;
+    if (NULL != pstcXfer->pvTxBuf)
+    {
+        stcDmaInit.u32SrcAddr = (uint32_t)pstcXfer->pvTxBuf;
+        stcDmaInit.u32SrcInc  = DMA_SRC_ADDR_INC;
+    }
+    else
+    {
+        stcDmaInit.u32SrcAddr = (uint32_t)(&pstcSpiDma->u32TxDummy);
+        stcDmaInit.u32SrcInc  = DMA_SRC_ADDR_FIX;
+    }
+    (void)DMA_Init(pstcSpiDma->stcTxDmaCh.DMAx, pstcSpiDma->stcTxDmaCh.u8Ch, &stcDmaInit);
+
+    DMA_ChannelCmd(pstcSpiDma->stcRxDmaCh.DMAx, pstcSpiDma->stcRxDmaCh.u8Ch, Enable);
+    DMA_ChannelCmd(pstcSpiDma->stcTxDmaCh.DMAx, pstcSpiDma->stcTxDmaCh.u8Ch, Enable);
+
+    SPI_DmaCsCmd(pstcDev, Enable);
+    SPI_FunctionCmd(SPIx, Enable);
+}
+
+/**
+ * @brief  End the transaction at the head of the SPI DMA transaction queue: release CS,
+ *         remove it and start the next transaction, or mark the bus idle.
+ * @param  [in]  pstcSpiDma         Pointer to a stc_spi_dma_t structure, the queue is not empty
+ * @param  [in]  enResult           Result of the transaction, stored in enXferResult
+ * @retval The pfnCpltCallback of the ended transaction, called by the caller, may be NULL
+ */
+static func_ptr_t SPI_DmaFinish(stc_spi_dma_t *pstcSpiDma, en_result_t enResult)
+{
+    uint32_t u32Head = pstcSpiDma->u32Head;
+    func_ptr_t pfnCpltCallback = pstcSpiDma->pstcQueue[u32Head].pfnCpltCallback;
+
+    SPI_DmaCsCmd(&pstcSpiDma->pstcDev[pstcSpiDma->pstcQueue[u32Head].u32DevId], Disable);
+    SPI_FunctionCmd(pstcSpiDma->SPIx, Disable);
+    pstcSpiDma->enXferResult = enResult;
+
+    u32Head++;
+    pstcSpiDma->u32Head = (u32Head < pstcSpiDma->u32QueueSize) ? u32Head : 0UL;
+    if (pstcSpiDma->u32Head != pstcSpiDma->u32Tail)
+    {
+        SPI_DmaStart(pstcSpiDma);
+    }
+    else
+    {
+        pstcSpiDma->u8Busy = 0U;
+    }
+
+    return pfnCpltCallback;
+}
+#endif /* DDL_DMA_ENABLE && DDL_GPIO_ENABLE */
+
 /**
  * @}
  */
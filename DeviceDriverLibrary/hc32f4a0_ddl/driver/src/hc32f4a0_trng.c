@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2020-06-12       Heqb          First version
+   2026-10-17       Heqb          Add the entropy pool and the CTR_DRBG
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -56,6 +57,7 @@
  ******************************************************************************/
 #include "hc32f4a0_trng.h"
 #include "hc32f4a0_utility.h"
+#include <string.h>
 
 /**
  * @addtogroup HC32F4A0_DDL_Driver
@@ -83,6 +85,11 @@
  */
 #define TRNG_TIMEOUT                        (20000UL)
 
+/* Bytes of a TRNG sample (DR0 and DR1). */
+#define TRNG_SAMPLE_BYTES                   (8UL)
+/* Words of raw pool data folded into the seed material of the CTR_DRBG. */
+#define TRNG_DRBG_RAW_WORDS                 ((TRNG_DRBG_SEED_LEN * 2UL) / 4UL)
+
 /**
  * @defgroup TRNG_Check_Parameters_Validity TRNG Check Parameters Validity
  * @{
@@ -112,7 +119,20 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
-
+/**
+ * @addtogroup TRNG_Local_Functions
+ * @{
+ */
+static void TRNG_PoolStart(stc_trng_pool_t *pstcPool);
+static en_result_t TRNG_HealthTest(stc_trng_pool_t *pstcPool, const uint32_t au32Sample[]);
+#if (DDL_AES_ENABLE == DDL_ON)
+static void TRNG_DRBG_CounterInc(uint8_t au8Block[]);
+static en_result_t TRNG_DRBG_Update(stc_trng_drbg_t *pstcDrbg, const uint8_t au8Data[]);
+static en_result_t TRNG_DRBG_Request(stc_trng_drbg_t *pstcDrbg, uint8_t au8Random[], uint32_t u32Size);
+#endif /* DDL_AES_ENABLE */
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Local variable definitions ('static')
@@ -163,6 +183,7 @@ void TRNG_ReloadCmd(uint32_t u32ReloadCmd)
  *         ErrorTimeout: Process timeout
  *         ErrorInvalidParameter: Parameter error
  * @note   Please pass in an array of 64 bits or more
+ * @note   Do not use this function while an entropy pool is running.
  */
 en_result_t TRNG_Generate(uint32_t au32Random[])
 {
@@ -196,6 +217,494 @@ en_result_t TRNG_Generate(uint32_t au32Random[])
     return enRet;
 }
 
+/**
+ * @brief  Initialize an entropy pool and start filling it in the background.
+ *         Each TRNG end interrupt adds 64 bits that passed the health tests,
+ *         the TRNG is stopped while the pool is full and restarted by
+ *         TRNG_PoolRead().
+ * @param  [in] pstcPool           Pointer to the pool.
+ * @param  [in] au32Buf            Buffer of the pool.
+ * @param  [in] u32Size            Size of au32Buf in words, a power of 2 not less
+ *                                 than 2. A pool used by TRNG_DRBG_Init() needs 32
+ *                                 words or more.
+ * @retval An en_result_t enumeration value:
+ *         Ok: The pool has been started.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         ErrorOperationInProgress: The pool is running
+ * @note   TRNG_PoolIrqHandler() must be called from the IRQ handler of INT_TRNG_END,
+ *         and the shift count and reload settings are taken as they are. The first
+ *         TRNG_HEALTH_STARTUP samples are only tested, see @ref TRNG_Health_Test.
+ */
+en_result_t TRNG_PoolInit(stc_trng_pool_t *pstcPool, uint32_t au32Buf[], uint32_t u32Size)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcPool != NULL) && (au32Buf != NULL) && \
+        (u32Size >= 2UL) && ((u32Size & (u32Size - 1UL)) == 0UL))
+    {
+        if (pstcPool->u32Running != 0UL)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            pstcPool->pu32Buf    = au32Buf;
+            pstcPool->u32Size    = u32Size;
+            pstcPool->u32Head    = 0UL;
+            pstcPool->u32Tail    = 0UL;
+            pstcPool->enResult   = Ok;
+            pstcPool->u32FailCnt = 0UL;
+            pstcPool->u32FailRun = 0UL;
+            pstcPool->u32Startup = TRNG_HEALTH_STARTUP;
+            pstcPool->u32RctCnt  = 0UL;
+            pstcPool->u32AptCnt  = 0UL;
+            pstcPool->u32AptIdx  = 0UL;
+            pstcPool->u8RctLast  = 0U;
+            pstcPool->u8AptRef   = 0U;
+            TRNG_PoolStart(pstcPool);
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Collect the sample of the finished generation into the pool, and start
+ *         the next one while there is room for it.
+ * @param  [in] pstcPool           Pointer to the pool.
+ * @retval None
+ * @note   Call it from the IRQ handler of INT_TRNG_END.
+ */
+void TRNG_PoolIrqHandler(stc_trng_pool_t *pstcPool)
+{
+    uint32_t au32Sample[2U];
+    uint32_t u32Head;
+
+    if ((pstcPool != NULL) && (pstcPool->u32Running != 0UL))
+    {
+        au32Sample[0U] = READ_REG32(M4_TRNG->DR0);
+        au32Sample[1U] = READ_REG32(M4_TRNG->DR1);
+
+        if (TRNG_HealthTest(pstcPool, au32Sample) == Ok)
+        {
+            pstcPool->u32FailRun = 0UL;
+            if (pstcPool->u32Startup > 0UL)
+            {
+                pstcPool->u32Startup--;
+            }
+            else
+            {
+                u32Head = pstcPool->u32Head;
+                pstcPool->pu32Buf[u32Head & (pstcPool->u32Size - 1UL)] = au32Sample[0U];
+                pstcPool->pu32Buf[(u32Head + 1UL) & (pstcPool->u32Size - 1UL)] = au32Sample[1U];
+                pstcPool->u32Head = u32Head + 2UL;
+            }
+        }
+        else
+        {
+            pstcPool->u32FailCnt++;
+            pstcPool->u32FailRun++;
+            if (pstcPool->u32FailRun >= TRNG_HEALTH_FAIL_LIMIT)
+            {
+                pstcPool->enResult = Error;
+            }
+        }
+
+        if ((pstcPool->enResult == Ok) && \
+            ((pstcPool->u32Size - (pstcPool->u32Head - pstcPool->u32Tail)) >= 2UL))
+        {
+            SET_REG32_BIT(M4_TRNG->CR, TRNG_CR_RUN);
+        }
+        else
+        {
+            pstcPool->u32Running = 0UL;
+            CLEAR_REG32_BIT(M4_TRNG->CR, TRNG_CR_EN);
+        }
+    }
+}
+
+/**
+ * @brief  Get the number of words available in the pool.
+ * @param  [in] pstcPool           Pointer to the pool.
+ * @retval Number of words.
+ */
+uint32_t TRNG_PoolGetCount(const stc_trng_pool_t *pstcPool)
+{
+    uint32_t u32Count = 0UL;
+
+    if (pstcPool != NULL)
+    {
+        u32Count = pstcPool->u32Head - pstcPool->u32Tail;
+    }
+
+    return u32Count;
+}
+
+/**
+ * @brief  Take random words from the pool without waiting for the TRNG.
+ *         The words read are cleared in the pool and the refill is restarted.
+ * @param  [in] pstcPool           Pointer to the pool.
+ * @param  [out] au32Random        Buffer of the random words.
+ * @param  [in] u32Count           Number of words to read.
+ * @retval An en_result_t enumeration value:
+ *         Ok: u32Count words have been read.
+ *         ErrorBufferEmpty: Less than u32Count words in the pool, nothing is read.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         Error: The pool has been stopped by the health tests
+ * @note   The pool has a single reader, it must not be read from several
+ *         contexts at the same time.
+ */
+en_result_t TRNG_PoolRead(stc_trng_pool_t *pstcPool, uint32_t au32Random[], uint32_t u32Count)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Tail;
+    uint32_t u32Pos;
+    uint32_t i;
+
+    if ((pstcPool != NULL) && (au32Random != NULL) && (pstcPool->pu32Buf != NULL))
+    {
+        if (pstcPool->enResult != Ok)
+        {
+            enRet = Error;
+        }
+        else if ((pstcPool->u32Head - pstcPool->u32Tail) < u32Count)
+        {
+            enRet = ErrorBufferEmpty;
+        }
+        else
+        {
+            u32Tail = pstcPool->u32Tail;
+            for (i = 0UL; i < u32Count; i++)
+            {
+                u32Pos = (u32Tail + i) & (pstcPool->u32Size - 1UL);
+                au32Random[i] = pstcPool->pu32Buf[u32Pos];
+                pstcPool->pu32Buf[u32Pos] = 0UL;
+            }
+            pstcPool->u32Tail = u32Tail + u32Count;
+            enRet = Ok;
+        }
+
+        /* The TRNG end interrupt only comes while running, so there is no race here. */
+        if ((pstcPool->u32Running == 0UL) && (pstcPool->enResult == Ok))
+        {
+            TRNG_PoolStart(pstcPool);
+        }
+    }
+
+    return enRet;
+}
+
+#if (DDL_AES_ENABLE == DDL_ON)
+/**
+ * @brief  Instantiate a CTR_DRBG seeded from an entropy pool. The generate
+ *         requests are served by the AES from RAM, the pool is only read
+ *         again to reseed.
+ * @param  [in] pstcDrbg           Pointer to the DRBG.
+ * @param  [in] pstcPool           Pointer to the pool started by TRNG_PoolInit().
+ * @param  [in] au8Pers            Personalization string, may be NULL.
+ * @param  [in] u32PersLength      Length of au8Pers in bytes, up to TRNG_DRBG_SEED_LEN.
+ * @retval An en_result_t enumeration value:
+ *         Ok: The DRBG is ready.
+ *         ErrorBufferEmpty: Not enough entropy in the pool yet, call TRNG_DRBG_Reseed() later.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         Error: The pool has been stopped by the health tests
+ *         ErrorTimeout, ErrorOperationInProgress: See AES_CtxEncrypt()
+ * @note   The DRBG is only instantiated by a successful seeding: until then
+ *         TRNG_DRBG_Generate() returns ErrorUninitialized, as the unseeded state is public.
+ * @note   The reseed interval can be changed in pstcDrbg->u32ReseedInterval
+ *         afterwards, it is TRNG_DRBG_RESEED_INTERVAL by default.
+ */
+en_result_t TRNG_DRBG_Init(stc_trng_drbg_t *pstcDrbg,
+                           stc_trng_pool_t *pstcPool,
+                           const uint8_t au8Pers[],
+                           uint32_t u32PersLength)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    const uint8_t au8Key[32U] = {0U};
+    uint8_t au8V[AES_BLOCK_LEN] = {0U};
+
+    if ((pstcDrbg != NULL) && (pstcPool != NULL))
+    {
+        /* Key = 0, V = 0, kept as V + 1 in the CTR context. */
+        TRNG_DRBG_CounterInc(au8V);
+        (void)AES_CtxInit(&pstcDrbg->stcAes, AES_MODE_CTR, au8Key, 32U, au8V);
+        pstcDrbg->pstcPool          = pstcPool;
+        pstcDrbg->u32ReseedInterval = TRNG_DRBG_RESEED_INTERVAL;
+        pstcDrbg->u32ReseedCnt      = 0UL;
+        pstcDrbg->u32Seeded         = 0UL;
+        enRet = TRNG_DRBG_Reseed(pstcDrbg, au8Pers, u32PersLength);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Reseed the DRBG from its entropy pool.
+ * @param  [in] pstcDrbg           Pointer to the DRBG initialized by TRNG_DRBG_Init().
+ * @param  [in] au8Add             Additional input, may be NULL.
+ * @param  [in] u32AddLength       Length of au8Add in bytes, up to TRNG_DRBG_SEED_LEN.
+ * @retval An en_result_t enumeration value:
+ *         Ok: Reseeded, the DRBG is instantiated.
+ *         ErrorBufferEmpty: Not enough entropy in the pool, the DRBG is unchanged.
+ *         ErrorInvalidParameter: Invalid parameter
+ *         Error: The pool has been stopped by the health tests
+ *         ErrorTimeout, ErrorOperationInProgress: See AES_CtxEncrypt()
+ * @note   2 words of the pool are XORed into each word of seed material.
+ */
+en_result_t TRNG_DRBG_Reseed(stc_trng_drbg_t *pstcDrbg,
+                             const uint8_t au8Add[],
+                             uint32_t u32AddLength)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t au32Raw[TRNG_DRBG_RAW_WORDS];
+    uint8_t au8Seed[TRNG_DRBG_SEED_LEN];
+    uint32_t i;
+
+    if ((pstcDrbg != NULL) && (pstcDrbg->pstcPool != NULL) && \
+        ((au8Add != NULL) || (u32AddLength == 0UL)) && (u32AddLength <= TRNG_DRBG_SEED_LEN))
+    {
+        enRet = TRNG_PoolRead(pstcDrbg->pstcPool, au32Raw, TRNG_DRBG_RAW_WORDS);
+        if (enRet == Ok)
+        {
+            for (i = 0UL; i < (TRNG_DRBG_RAW_WORDS / 2UL); i++)
+            {
+                au32Raw[i] ^= au32Raw[i + (TRNG_DRBG_RAW_WORDS / 2UL)];
+            }
+            (void)memcpy(au8Seed, au32Raw, TRNG_DRBG_SEED_LEN);
+            for (i = 0UL; i < u32AddLength; i++)
+            {
+                au8Seed[i] ^= au8Add[i];
+            }
+            enRet = TRNG_DRBG_Update(pstcDrbg, au8Seed);
+            if (enRet == Ok)
+            {
+                pstcDrbg->u32ReseedCnt = 0UL;
+                pstcDrbg->u32Seeded    = 1UL;
+            }
+            (void)memset(au8Seed, 0, sizeof(au8Seed));
+            (void)memset(au32Raw, 0, sizeof(au32Raw));
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Generate random bytes. Requests longer than TRNG_DRBG_MAX_REQUEST
+ *         are split. After u32ReseedInterval requests the DRBG is reseeded
+ *         from the pool; if the pool is short it carries on with the current
+ *         seed and tries again on the next request, up to TRNG_DRBG_RESEED_LIMIT.
+ * @param  [in] pstcDrbg           Pointer to the DRBG initialized by TRNG_DRBG_Init().
+ * @param  [out] au8Random         Buffer of the random bytes.
+ * @param  [in] u32Size            Number of bytes.
+ * @retval An en_result_t enumeration value:
+ *         Ok: au8Random has been filled.
+ *         ErrorBufferEmpty: The reseed limit is reached and the pool is empty.
+ *         ErrorUninitialized: The DRBG has not been seeded yet, see TRNG_DRBG_Init()
+ *         ErrorInvalidParameter: Invalid parameter
+ *         Error: The pool has been stopped by the health tests
+ *         ErrorTimeout, ErrorOperationInProgress: See AES_CtxEncrypt()
+ * @note   au8Random is cleared when an error is returned.
+ */
+en_result_t TRNG_DRBG_Generate(stc_trng_drbg_t *pstcDrbg,
+                               uint8_t au8Random[],
+                               uint32_t u32Size)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Len;
+    uint32_t u32Done = 0UL;
+
+    if ((pstcDrbg != NULL) && (pstcDrbg->pstcPool != NULL) && (au8Random != NULL))
+    {
+        enRet = (pstcDrbg->u32Seeded == 1UL) ? Ok : ErrorUninitialized;
+        while ((u32Done < u32Size) && (enRet == Ok))
+        {
+            u32Len = u32Size - u32Done;
+            if (u32Len > TRNG_DRBG_MAX_REQUEST)
+            {
+                u32Len = TRNG_DRBG_MAX_REQUEST;
+            }
+            enRet = TRNG_DRBG_Request(pstcDrbg, &au8Random[u32Done], u32Len);
+            u32Done += u32Len;
+        }
+
+        if (enRet != Ok)
+        {
+            (void)memset(au8Random, 0, u32Size);
+        }
+    }
+
+    return enRet;
+}
+#endif /* DDL_AES_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TRNG_Local_Functions TRNG Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Start a generation for the pool.
+ * @param  [in] pstcPool           Pointer to the pool.
+ * @retval None
+ */
+static void TRNG_PoolStart(stc_trng_pool_t *pstcPool)
+{
+    pstcPool->u32Running = 1UL;
+    SET_REG32_BIT(M4_TRNG->CR, TRNG_CR_EN);
+    SET_REG32_BIT(M4_TRNG->CR, TRNG_CR_RUN);
+}
+
+/**
+ * @brief  Continuous health tests on the bytes of a raw sample: the repetition
+ *         count test and the adaptive proportion test of NIST SP 800-90B.
+ * @param  [in] pstcPool           Pointer to the pool which holds the test state.
+ * @param  [in] au32Sample         The 64-bit sample.
+ * @retval An en_result_t enumeration value:
+ *         Ok: The sample passed.
+ *         Error: A test failed, the sample must be dropped.
+ */
+static en_result_t TRNG_HealthTest(stc_trng_pool_t *pstcPool, const uint32_t au32Sample[])
+{
+    en_result_t enRet = Ok;
+    uint8_t u8Byte;
+    uint32_t i;
+
+    for (i = 0UL; i < TRNG_SAMPLE_BYTES; i++)
+    {
+        u8Byte = (uint8_t)(au32Sample[i / 4UL] >> ((i % 4UL) * 8UL));
+
+        /* Repetition count test. */
+        if ((u8Byte == pstcPool->u8RctLast) && (pstcPool->u32RctCnt > 0UL))
+        {
+            pstcPool->u32RctCnt++;
+            if (pstcPool->u32RctCnt >= TRNG_HEALTH_RCT_CUTOFF)
+            {
+                enRet = Error;
+            }
+        }
+        else
+        {
+            pstcPool->u8RctLast = u8Byte;
+            pstcPool->u32RctCnt = 1UL;
+        }
+
+        /* Adaptive proportion test. */
+        if (pstcPool->u32AptIdx == 0UL)
+        {
+            pstcPool->u8AptRef = u8Byte;
+            pstcPool->u32AptCnt = 1UL;
+        }
+        else
+        {
+            if (u8Byte == pstcPool->u8AptRef)
+            {
+                pstcPool->u32AptCnt++;
+                if (pstcPool->u32AptCnt >= TRNG_HEALTH_APT_CUTOFF)
+                {
+                    enRet = Error;
+                }
+            }
+        }
+        pstcPool->u32AptIdx = (pstcPool->u32AptIdx + 1UL) % TRNG_HEALTH_APT_WINDOW;
+    }
+
+    return enRet;
+}
+
+#if (DDL_AES_ENABLE == DDL_ON)
+/**
+ * @brief  Increment a 128-bit big-endian block.
+ * @param  [in] au8Block           The block.
+ * @retval None
+ */
+static void TRNG_DRBG_CounterInc(uint8_t au8Block[])
+{
+    uint32_t i = AES_BLOCK_LEN;
+
+    do
+    {
+        i--;
+        au8Block[i]++;
+    } while ((au8Block[i] == 0U) && (i > 0UL));
+}
+
+/**
+ * @brief  CTR_DRBG_Update(): new (Key, V) from three counter blocks XORed with
+ *         the provided data. V + 1 is stored as the counter of the CTR context,
+ *         so the key stream of the context gives E(Key, V + 1), E(Key, V + 2)...
+ * @param  [in] pstcDrbg           Pointer to the DRBG.
+ * @param  [in] au8Data            TRNG_DRBG_SEED_LEN bytes of provided data, NULL for zeros.
+ * @retval An en_result_t enumeration value, see AES_CtxEncrypt().
+ */
+static en_result_t TRNG_DRBG_Update(stc_trng_drbg_t *pstcDrbg, const uint8_t au8Data[])
+{
+    en_result_t enRet;
+    uint8_t au8Temp[TRNG_DRBG_SEED_LEN] = {0U};
+    uint32_t i;
+
+    /* Drop the key stream left over by the previous request. */
+    pstcDrbg->stcAes.u8StreamPos = 0U;
+    enRet = AES_CtxEncrypt(&pstcDrbg->stcAes, au8Temp, TRNG_DRBG_SEED_LEN, au8Temp);
+    if (enRet == Ok)
+    {
+        if (au8Data != NULL)
+        {
+            for (i = 0UL; i < TRNG_DRBG_SEED_LEN; i++)
+            {
+                au8Temp[i] ^= au8Data[i];
+            }
+        }
+        TRNG_DRBG_CounterInc(&au8Temp[32U]);
+        enRet = AES_CtxInit(&pstcDrbg->stcAes, AES_MODE_CTR, au8Temp, 32U, &au8Temp[32U]);
+    }
+    (void)memset(au8Temp, 0, sizeof(au8Temp));
+
+    return enRet;
+}
+
+/**
+ * @brief  One CTR_DRBG generate request, with the reseed check.
+ * @param  [in] pstcDrbg           Pointer to the DRBG.
+ * @param  [out] au8Random         Buffer of the random bytes.
+ * @param  [in] u32Size            Number of bytes, up to TRNG_DRBG_MAX_REQUEST.
+ * @retval An en_result_t enumeration value, see TRNG_DRBG_Generate().
+ */
+static en_result_t TRNG_DRBG_Request(stc_trng_drbg_t *pstcDrbg, uint8_t au8Random[], uint32_t u32Size)
+{
+    en_result_t enRet = Ok;
+
+    if (pstcDrbg->u32ReseedCnt >= pstcDrbg->u32ReseedInterval)
+    {
+        enRet = TRNG_DRBG_Reseed(pstcDrbg, NULL, 0UL);
+        if ((enRet == ErrorBufferEmpty) && (pstcDrbg->u32ReseedCnt < TRNG_DRBG_RESEED_LIMIT))
+        {
+            enRet = Ok;
+        }
+    }
+
+    if (enRet == Ok)
+    {
+        /* The output is the key stream of V + 1, V + 2... */
+        (void)memset(au8Random, 0, u32Size);
+        pstcDrbg->stcAes.u8StreamPos = 0U;
+        enRet = AES_CtxEncrypt(&pstcDrbg->stcAes, au8Random, u32Size, au8Random);
+        if (enRet == Ok)
+        {
+            enRet = TRNG_DRBG_Update(pstcDrbg, NULL);
+            pstcDrbg->u32ReseedCnt++;
+        }
+    }
+
+    return enRet;
+}
+#endif /* DDL_AES_ENABLE */
+
 /**
  * @}
  */
@@ -10,6 +10,9 @@
    2020-07-03       Hongjh          Add doxygen group:USART_Local_Functions
    2020-08-25       Hongjh          The variable f32Err un-initializes an 
                                     unnecessary assignment
+   2026-10-17       Hongjh          Add buffered UART USART_BufInit/USART_BufWrite/USART_BufRead
+                                    and the interrupt handlers of the buffered UART
+   2026-10-17       Hongjh          Add precomputed baudrate configuration USART_BaudCfgCalc/USART_SetBaudCfg
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -58,6 +61,7 @@
  * Include files
  ******************************************************************************/
 #include "hc32f4a0_usart.h"
+#include "hc32f4a0_tmr0.h"
 #include "hc32f4a0_utility.h"
 
 /**
@@ -246,6 +250,31 @@
     (USART_LIN_SEND_BREAK_13BIT == (x))         ||                             \
     (USART_LIN_SEND_BREAK_14BIT == (x)))
 
+#define IS_USART_BUF_RING_SIZE(x)                                              \
+(   ((x) >= 2UL)                                &&                             \
+    ((x) <= USART_BUF_RING_SIZE_MAX)            &&                             \
+    (0UL == ((x) & ((x) - 1UL))))
+
+#define IS_USART_BAUD_FACTOR(x)                                                \
+(   (USART_BAUD_FACTOR_UART_OVER16 == (x))      ||                             \
+    (USART_BAUD_FACTOR_UART_OVER8 == (x))       ||                             \
+    (USART_BAUD_FACTOR_CLKSYNC == (x))          ||                             \
+    (USART_BAUD_FACTOR_SC_ETU_32 == (x))        ||                             \
+    (USART_BAUD_FACTOR_SC_ETU_64 == (x))        ||                             \
+    (USART_BAUD_FACTOR_SC_ETU_128 == (x))       ||                             \
+    (USART_BAUD_FACTOR_SC_ETU_256 == (x))       ||                             \
+    (USART_BAUD_FACTOR_SC_ETU_372 == (x)))
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup USART_Buf_Ring_Size USART buffered UART ring size definition
+ * @note The DMA transfer count is 16 bits: a RX half ring or a TX span after its first byte
+ * @{
+ */
+#define USART_BUF_RING_SIZE_MAX             (0x10000UL)
 /**
  * @}
  */
@@ -388,6 +417,16 @@ static en_result_t CalcSmartcardBaudrate(const M4_USART_TypeDef *USARTx,
                                             uint32_t *pu32BrrVal,
                                             uint32_t *pu32FractEn,
                                             float32_t *pf32Err);
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_TMR0_ENABLE == DDL_ON)
+static void USART_BufGetEvent(const M4_USART_TypeDef *USARTx,
+                                en_event_src_t *penRxEvt,
+                                en_event_src_t *penTxEvt);
+static en_result_t USART_BufGetRtoTmr0(const M4_USART_TypeDef *USARTx,
+                                        M4_TMR0_TypeDef **ppstcTmr0,
+                                        uint8_t *pu8Tmr0Ch);
+static uint32_t USART_BufGetRxIn(const stc_usart_buf_t *pstcBuf);
+static void USART_BufRxSync(stc_usart_buf_t *pstcBuf);
+#endif /* DDL_DMA_ENABLE && DDL_TMR0_ENABLE */
 
 /**
  * @}
@@ -2391,6 +2430,605 @@ en_result_t USART_SetBaudrate(M4_USART_TypeDef *USARTx,
     return enRet;
 }
 
+/**
+ * @brief  Precompute the USART baudrate configuration.
+ * @param  [in] u32Pclk                 PCLK1 frequency(Hz) before the USART PCLK division
+ * @param  [in] u32Baudrate             Baudrate
+ * @param  [in] u32Factor               USART clock factor of the USART mode
+ *         This parameter can be one of the following values:
+ *           @arg USART_BAUD_FACTOR_UART_OVER16: UART/LIN mode, oversampling by 16 bits
+ *           @arg USART_BAUD_FACTOR_UART_OVER8: UART/LIN mode, oversampling by 8 bits
+ *           @arg USART_BAUD_FACTOR_CLKSYNC: Clock synchronization mode
+ *           @arg USART_BAUD_FACTOR_SC_ETU_32: Smartcard mode, 1 etu = 32/f
+ *           @arg USART_BAUD_FACTOR_SC_ETU_64: Smartcard mode, 1 etu = 64/f
+ *           @arg USART_BAUD_FACTOR_SC_ETU_128: Smartcard mode, 1 etu = 128/f
+ *           @arg USART_BAUD_FACTOR_SC_ETU_256: Smartcard mode, 1 etu = 256/f
+ *           @arg USART_BAUD_FACTOR_SC_ETU_372: Smartcard mode, 1 etu = 372/f
+ * @param  [in] enFraction              Baudrate fraction function state
+ *         This parameter can be one of the following values:
+ *           @arg Enable:               The target instance supports the baudrate fraction
+ *           @arg Disable:              Integer divider only
+ * @param  [out] pstcCfg                Pointer to a @ref stc_usart_baud_cfg_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Calculate successfully
+ *           - ErrorInvalidParameter: u32Pclk == 0 or u32Baudrate == 0 or pstcCfg == NULL,
+ *                                    or the baudrate is out of range for every PCLK division
+ * @note   The smallest PCLK division that keeps DIV_Integer <= 0xFF is selected. Integer arithmetic
+ *         only, and the result is identical to the compile-time initializer USART_BAUD_CFG().
+ */
+en_result_t USART_BaudCfgCalc(uint32_t u32Pclk,
+                                    uint32_t u32Baudrate,
+                                    uint32_t u32Factor,
+                                    en_functional_state_t enFraction,
+                                    stc_usart_baud_cfg_t *pstcCfg)
+{
+    uint32_t u32Psc = 0UL;
+    uint32_t DIV_Fraction = 0UL;
+    uint64_t u64K;
+    uint64_t u64Clk;
+    uint64_t u64Div;
+    uint64_t u64Dividend;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    /* Check parameters */
+    DDL_ASSERT(IS_USART_BAUD_FACTOR(u32Factor));
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enFraction));
+
+    if ((u32Pclk > 0UL) && (u32Baudrate > 0UL) && (NULL != pstcCfg))
+    {
+        /* B = (C / PSC) / (K * (DIV_Integer + 1)), K = u32Factor */
+        u64K = (uint64_t)u32Baudrate * (uint64_t)u32Factor;
+        u64Clk = (uint64_t)u32Pclk;
+        u64Div = u64Clk / u64K;
+        while ((u64Div > 256ULL) && (u32Psc < 3UL))
+        {
+            u32Psc++;
+            u64Clk = (uint64_t)u32Pclk >> (u32Psc * 2UL);
+            u64Div = u64Clk / u64K;
+        }
+
+        if ((u64Div >= 1ULL) && (u64Div <= 256ULL))
+        {
+            if ((Enable == enFraction) && (0ULL != (u64Clk % u64K)))
+            {
+                /* DIV_Fraction = (256 * K * (DIV_Integer + 1) * B / C) - 128 */
+                DIV_Fraction = (uint32_t)((256ULL * u64K * u64Div) / u64Clk - 128ULL);
+            }
+
+            /* E(ppm) = C * (128 + DIV_Fraction) / (256 * K * (DIV_Integer + 1) * B) - 1 */
+            u64Dividend = u64Clk * ((0UL == DIV_Fraction) ? 256ULL : (128ULL + (uint64_t)DIV_Fraction));
+            pstcCfg->i32Err = (int32_t)((int64_t)((u64Dividend * 1000000ULL) / (256ULL * u64K * u64Div)) - 1000000LL);
+
+            pstcCfg->u32PclkDiv = (u32Psc << USART_PR_PSC_POS);
+            pstcCfg->u32Brr = DIV_Fraction + ((uint32_t)(u64Div - 1ULL) << USART_BRR_DIV_INTEGER_POS);
+            pstcCfg->u32FractEn = (DIV_Fraction > 0UL) ? USART_CR1_FBME : 0UL;
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Apply a precomputed USART baudrate configuration.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M4_USART1:            USART unit 1 instance register base
+ *           @arg M4_USART2:            USART unit 2 instance register base
+ *           @arg M4_USART3:            USART unit 3 instance register base
+ *           @arg M4_USART4:            USART unit 4 instance register base
+ *           @arg M4_USART5:            USART unit 5 instance register base
+ *           @arg M4_USART6:            USART unit 6 instance register base
+ *           @arg M4_USART7:            USART unit 7 instance register base
+ *           @arg M4_USART8:            USART unit 8 instance register base
+ *           @arg M4_USART9:            USART unit 9 instance register base
+ *           @arg M4_USART10:           USART unit 10 instance register base
+ * @param  [in] pstcCfg                 Pointer to a @ref stc_usart_baud_cfg_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Set successfully
+ *           - Error: The configuration uses the baudrate fraction and USARTx doesn't support it
+ *           - ErrorInvalidParameter: pstcCfg == NULL
+ * @note   The configuration must be computed for the mode(and oversampling/ETU) of USARTx and
+ *         PCLK1 frequency. Apply it while the transmitter and receiver are idle.
+ */
+en_result_t USART_SetBaudCfg(M4_USART_TypeDef *USARTx,
+                                    const stc_usart_baud_cfg_t *pstcCfg)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    /* Check parameter */
+    DDL_ASSERT(IS_USART_INSTANCE(USARTx));
+
+    if (NULL != pstcCfg)
+    {
+        DDL_ASSERT(IS_USART_PCLK_DIV(pstcCfg->u32PclkDiv));
+
+        if ((!IS_USART_FRACTION_INSTANCE(USARTx)) && (pstcCfg->u32FractEn > 0UL))
+        {
+            enRet = Error;
+        }
+        else
+        {
+            MODIFY_REG32(USARTx->PR, USART_PR_PSC, pstcCfg->u32PclkDiv);
+            MODIFY_REG32(USARTx->CR1, USART_CR1_FBME, pstcCfg->u32FractEn);
+            WRITE_REG32(USARTx->BRR, pstcCfg->u32Brr);
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_TMR0_ENABLE == DDL_ON)
+/**
+ * @brief  Set the default value of the buffered UART initialization structure.
+ * @param  [in] pstcInit                Pointer to a @ref stc_usart_buf_init_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize successfully
+ *           - ErrorInvalidParameter: pstcInit = NULL
+ */
+en_result_t USART_BufStructInit(stc_usart_buf_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcInit)
+    {
+        pstcInit->RxDMAx = M4_DMA1;
+        pstcInit->u8RxDmaCh = DMA_CH0;
+        pstcInit->TxDMAx = M4_DMA1;
+        pstcInit->u8TxDmaCh = DMA_CH1;
+        pstcInit->pu8RxBuf = NULL;
+        pstcInit->u32RxBufSize = 0UL;
+        pstcInit->pu8TxBuf = NULL;
+        pstcInit->u32TxBufSize = 0UL;
+        pstcInit->u32RtoClkSrc = TMR0_CLK_SRC_XTAL32;
+        pstcInit->u32RtoClkDiv = TMR0_CLK_DIV1;
+        pstcInit->u16RtoCmpValue = 0U;
+        pstcInit->pfnRxCallback = NULL;
+        pstcInit->pfnTxCallback = NULL;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the buffered UART on an USART in UART mode.
+ * @param  [out] pstcBuf                Pointer to a @ref stc_usart_buf_t structure, kept while the UART runs
+ * @param  [in] USARTx                  Pointer to USART instance register base, initialized by USART_UartInit()
+ *         This parameter can be one of the following values:
+ *           @arg M4_USART1:            USART unit 1 instance register base
+ *           @arg M4_USART2:            USART unit 2 instance register base
+ *           @arg M4_USART3:            USART unit 3 instance register base
+ *           @arg M4_USART4:            USART unit 4 instance register base
+ *           @arg M4_USART5:            USART unit 5 instance register base
+ *           @arg M4_USART6:            USART unit 6 instance register base
+ *           @arg M4_USART7:            USART unit 7 instance register base
+ *           @arg M4_USART8:            USART unit 8 instance register base
+ *           @arg M4_USART9:            USART unit 9 instance register base
+ *           @arg M4_USART10:           USART unit 10 instance register base
+ * @param  [in] pstcInit                Pointer to a @ref stc_usart_buf_init_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize successfully, RX and TX are enabled
+ *           - ErrorInvalidParameter: NULL pointer, ring size invalid or RX timeout on an USART without it
+ *           - ErrorInvalidMode: The RX or TX DMA channel is owned by another user, see DMA_ChClaim()
+ * @note   Each port takes two DMA channels, claimed by DMA_ChClaim() and kept while the UART runs. The
+ *         chip has 16 channels in two units, so at most 8 ports can be buffered when no other driver
+ *         uses DMA.
+ * @note   The RX DMA fills the RX ring endlessly: two LLP descriptors, one per half of the ring, linked
+ *         to each other. The TX DMA sends the contiguous span of the TX ring from its first byte.
+ *         The clocks of the USART, the DMA units, AOS and TMR0 must be enabled, and the interrupts
+ *         routed to the handlers:
+ *           - RX DMA channel transfer completed: USART_BufRxDmaIrqHandler()
+ *           - TX DMA channel transfer completed: USART_BufTxDmaIrqHandler()
+ *           - USART TI: USART_BufTxEmptyIrqHandler()
+ *           - USART EI: USART_BufRxErrIrqHandler()
+ *           - USART RTO: USART_BufRxTimeoutIrqHandler(), when u16RtoCmpValue is not 0
+ */
+en_result_t USART_BufInit(stc_usart_buf_t *pstcBuf,
+                            M4_USART_TypeDef *USARTx,
+                            const stc_usart_buf_init_t *pstcInit)
+{
+    uint32_t i;
+    en_event_src_t enRxEvt;
+    en_event_src_t enTxEvt;
+    M4_TMR0_TypeDef *TMR0x = NULL;
+    uint8_t u8Tmr0Ch = 0U;
+    stc_dma_llp_chain_t stcChain;
+    stc_dma_llp_seg_t astcSeg[2U];
+    stc_dma_init_t stcDmaInit;
+    stc_tmr0_init_t stcTmr0Init;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    /* Check parameters */
+    DDL_ASSERT(IS_USART_INSTANCE(USARTx));
+
+    if ((NULL != pstcBuf) && (NULL != pstcInit) && \
+        (NULL != pstcInit->pu8RxBuf) && (NULL != pstcInit->pu8TxBuf) && \
+        IS_USART_BUF_RING_SIZE(pstcInit->u32RxBufSize) && \
+        IS_USART_BUF_RING_SIZE(pstcInit->u32TxBufSize))
+    {
+        enRet = Ok;
+        if (0U != pstcInit->u16RtoCmpValue)
+        {
+            enRet = USART_BufGetRtoTmr0(USARTx, &TMR0x, &u8Tmr0Ch);
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        USART_BufGetEvent(USARTx, &enRxEvt, &enTxEvt);
+
+        /* Claim the channels with their triggers, the RX one is released if the TX one is owned */
+        pstcBuf->stcRxDmaCh.DMAx = pstcInit->RxDMAx;
+        pstcBuf->stcRxDmaCh.u8Ch = pstcInit->u8RxDmaCh;
+        pstcBuf->stcRxDmaCh.pfnTcCallback = NULL;
+        pstcBuf->stcRxDmaCh.pfnBtcCallback = NULL;
+        pstcBuf->stcRxDmaCh.pfnErrCallback = NULL;
+        pstcBuf->stcTxDmaCh.DMAx = pstcInit->TxDMAx;
+        pstcBuf->stcTxDmaCh.u8Ch = pstcInit->u8TxDmaCh;
+        pstcBuf->stcTxDmaCh.pfnTcCallback = NULL;
+        pstcBuf->stcTxDmaCh.pfnBtcCallback = NULL;
+        pstcBuf->stcTxDmaCh.pfnErrCallback = NULL;
+        enRet = DMA_ChClaim(&pstcBuf->stcRxDmaCh, enRxEvt);
+        if (Ok == enRet)
+        {
+            enRet = DMA_ChClaim(&pstcBuf->stcTxDmaCh, enTxEvt);
+            if (Ok != enRet)
+            {
+                (void)DMA_ChFree(&pstcBuf->stcRxDmaCh);
+            }
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        pstcBuf->USARTx = USARTx;
+        pstcBuf->stcRx.pu8Buf = pstcInit->pu8RxBuf;
+        pstcBuf->stcRx.u32Size = pstcInit->u32RxBufSize;
+        pstcBuf->stcRx.u32In = 0UL;
+        pstcBuf->stcRx.u32Out = 0UL;
+        pstcBuf->stcTx.pu8Buf = pstcInit->pu8TxBuf;
+        pstcBuf->stcTx.u32Size = pstcInit->u32TxBufSize;
+        pstcBuf->stcTx.u32In = 0UL;
+        pstcBuf->stcTx.u32Out = 0UL;
+        pstcBuf->u32RxHalfIn = 0UL;
+        pstcBuf->u32TxSpan = 0UL;
+        pstcBuf->u8TxBusy = 0U;
+        pstcBuf->u32RxOverrunCnt = 0UL;
+        pstcBuf->u32RxErrCnt = 0UL;
+        pstcBuf->pfnRxCallback = pstcInit->pfnRxCallback;
+        pstcBuf->pfnTxCallback = pstcInit->pfnTxCallback;
+
+        USART_FuncCmd(USARTx, (USART_RX | USART_TX | USART_INT_RX | USART_INT_TXE), Disable);
+        if (IS_USART_TIMEOUT_INSTANCE(USARTx))
+        {
+            USART_FuncCmd(USARTx, (USART_RTO | USART_INT_RTO), Disable);
+        }
+
+        /* RX: the data register to each half of the RX ring, the halves linked to each other */
+        for (i = 0UL; i < 2UL; i++)
+        {
+            (void)DMA_LlpSegStructInit(&astcSeg[i]);
+            astcSeg[i].u32SrcAddr = (uint32_t)(&USARTx->DR) + 2UL;
+            astcSeg[i].u32DestAddr = (uint32_t)&pstcInit->pu8RxBuf[i * (pstcInit->u32RxBufSize / 2UL)];
+            astcSeg[i].u32Length = pstcInit->u32RxBufSize / 2UL;
+            astcSeg[i].u32DataWidth = DMA_DATAWIDTH_8BIT;
+            astcSeg[i].u32SrcInc = DMA_SRC_ADDR_FIX;
+        }
+        (void)DMA_LlpChainInit(&stcChain, pstcBuf->astcRxDesc, 2UL, DMA_LLP_WAIT);
+        (void)DMA_LlpChainBuild(&stcChain, astcSeg, 2UL, DMA_INT_ENABLE, Enable);
+        pstcBuf->astcRxDesc[0U].CHCTLx |= DMA_INT_ENABLE;
+
+        DMA_ChannelCmd(pstcBuf->stcRxDmaCh.DMAx, pstcBuf->stcRxDmaCh.u8Ch, Disable);
+        DMA_TransIntCmd(pstcBuf->stcRxDmaCh.DMAx, (1UL << pstcBuf->stcRxDmaCh.u8Ch), Enable);
+        (void)DMA_LlpChainLoad(pstcBuf->stcRxDmaCh.DMAx, pstcBuf->stcRxDmaCh.u8Ch, &stcChain);
+        DMA_Cmd(pstcBuf->stcRxDmaCh.DMAx, Enable);
+        DMA_ChannelCmd(pstcBuf->stcRxDmaCh.DMAx, pstcBuf->stcRxDmaCh.u8Ch, Enable);
+
+        /* TX: a span of the TX ring to the data register, started by USART_BufTxEmptyIrqHandler() */
+        DMA_ChannelCmd(pstcBuf->stcTxDmaCh.DMAx, pstcBuf->stcTxDmaCh.u8Ch, Disable);
+        (void)DMA_StructInit(&stcDmaInit);
+        stcDmaInit.u32IntEn = DMA_INT_ENABLE;
+        stcDmaInit.u32BlockSize = 1UL;
+        stcDmaInit.u32TransCnt = 1UL;
+        stcDmaInit.u32DataWidth = DMA_DATAWIDTH_8BIT;
+        stcDmaInit.u32DestAddr = (uint32_t)(&USARTx->DR);
+        stcDmaInit.u32SrcAddr = (uint32_t)pstcInit->pu8TxBuf;
+        stcDmaInit.u32SrcInc = DMA_SRC_ADDR_INC;
+        stcDmaInit.u32DestInc = DMA_DEST_ADDR_FIX;
+        (void)DMA_Init(pstcBuf->stcTxDmaCh.DMAx, pstcBuf->stcTxDmaCh.u8Ch, &stcDmaInit);
+        DMA_TransIntCmd(pstcBuf->stcTxDmaCh.DMAx, (1UL << pstcBuf->stcTxDmaCh.u8Ch), Enable);
+        DMA_Cmd(pstcBuf->stcTxDmaCh.DMAx, Enable);
+
+        /* RX timeout: TMR0 started and cleared by each received data */
+        if (NULL != TMR0x)
+        {
+            (void)TMR0_StructInit(&stcTmr0Init);
+            stcTmr0Init.u32ClockSource = pstcInit->u32RtoClkSrc;
+            stcTmr0Init.u32ClockDivision = pstcInit->u32RtoClkDiv;
+            stcTmr0Init.u32HwTrigFunc = (TMR0_BT_HWTRG_FUNC_START | TMR0_BT_HWTRG_FUNC_CLEAR);
+            stcTmr0Init.u16CmpValue = pstcInit->u16RtoCmpValue;
+            TMR0_SetCntVal(TMR0x, u8Tmr0Ch, 0U);
+            (void)TMR0_Init(TMR0x, u8Tmr0Ch, &stcTmr0Init);
+            TMR0_ClearStatus(TMR0x, u8Tmr0Ch);
+            USART_ClearStatus(USARTx, USART_CLEAR_FLAG_RTOF);
+            USART_FuncCmd(USARTx, (USART_RTO | USART_INT_RTO), Enable);
+        }
+
+        USART_ClearStatus(USARTx, (USART_CLEAR_FLAG_PE | USART_CLEAR_FLAG_FE | USART_CLEAR_FLAG_ORE));
+        /* The RX interrupt enable also gates the RI event of the RX DMA */
+        USART_FuncCmd(USARTx, (USART_RX | USART_INT_RX | USART_TX), Enable);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Put data in the TX ring of the buffered UART, and start the TX if it is idle.
+ * @param  [in] pstcBuf                 Pointer to a @ref stc_usart_buf_t structure
+ * @param  [in] au8Data                 Data
+ * @param  [in] u32Len                  Bytes of the data
+ * @retval Bytes put in the TX ring, less than u32Len when the ring is full
+ * @note   The only producer of the TX ring: call it from one context.
+ */
+uint32_t USART_BufWrite(stc_usart_buf_t *pstcBuf,
+                            const uint8_t au8Data[],
+                            uint32_t u32Len)
+{
+    uint32_t i;
+    uint32_t u32In;
+    uint32_t u32Cnt = 0UL;
+    uint32_t u32Mask;
+
+    if ((NULL != pstcBuf) && (NULL != au8Data))
+    {
+        u32In = pstcBuf->stcTx.u32In;
+        u32Mask = pstcBuf->stcTx.u32Size - 1UL;
+        u32Cnt = pstcBuf->stcTx.u32Size - (u32In - pstcBuf->stcTx.u32Out);
+        u32Cnt = (u32Len < u32Cnt) ? u32Len : u32Cnt;
+        for (i = 0UL; i < u32Cnt; i++)
+        {
+            pstcBuf->stcTx.pu8Buf[(u32In + i) & u32Mask] = au8Data[i];
+        }
+        /* Publish the data, then look at the consumer */
+        pstcBuf->stcTx.u32In = u32In + u32Cnt;
+
+        if ((0UL != u32Cnt) && (0U == pstcBuf->u8TxBusy))
+        {
+            pstcBuf->u8TxBusy = 1U;
+            USART_FuncCmd(pstcBuf->USARTx, USART_INT_TXE, Enable);
+        }
+    }
+
+    return u32Cnt;
+}
+
+/**
+ * @brief  Take data from the RX ring of the buffered UART.
+ * @param  [in] pstcBuf                 Pointer to a @ref stc_usart_buf_t structure
+ * @param  [out] au8Data                Buffer of the data
+ * @param  [in] u32Len                  Size of the buffer
+ * @retval Bytes taken, 0 when the RX ring is empty
+ * @note   The only consumer of the RX ring: call it from one context. The data written by the DMA
+ *         so far is returned, without waiting for the RX timeout. When the DMA has overwritten data
+ *         not read yet, the oldest half of the ring is dropped and u32RxOverrunCnt is increased.
+ */
+uint32_t USART_BufRead(stc_usart_buf_t *pstcBuf,
+                            uint8_t au8Data[],
+                            uint32_t u32Len)
+{
+    uint32_t i;
+    uint32_t u32In;
+    uint32_t u32Out;
+    uint32_t u32Cnt = 0UL;
+    uint32_t u32Mask;
+
+    if ((NULL != pstcBuf) && (NULL != au8Data))
+    {
+        u32In = USART_BufGetRxIn(pstcBuf);
+        u32Out = pstcBuf->stcRx.u32Out;
+        u32Mask = pstcBuf->stcRx.u32Size - 1UL;
+        if ((u32In - u32Out) > pstcBuf->stcRx.u32Size)
+        {
+            /* Keep the last half, the other one is being written */
+            u32Out = u32In - (pstcBuf->stcRx.u32Size / 2UL);
+            pstcBuf->u32RxOverrunCnt++;
+        }
+        u32Cnt = u32In - u32Out;
+        u32Cnt = (u32Len < u32Cnt) ? u32Len : u32Cnt;
+        for (i = 0UL; i < u32Cnt; i++)
+        {
+            au8Data[i] = pstcBuf->stcRx.pu8Buf[(u32Out + i) & u32Mask];
+        }
+        pstcBuf->stcRx.u32Out = u32Out + u32Cnt;
+    }
+
+    return u32Cnt;
+}
+
+/**
+ * @brief  Get the bytes ready in the RX ring of the buffered UART.
+ * @param  [in] pstcBuf                 Pointer to a @ref stc_usart_buf_t structure
+ * @retval Bytes ready, up to the RX ring size
+ */
+uint32_t USART_BufGetRxCount(const stc_usart_buf_t *pstcBuf)
+{
+    uint32_t u32Cnt = 0UL;
+
+    if (NULL != pstcBuf)
+    {
+        u32Cnt = USART_BufGetRxIn(pstcBuf) - pstcBuf->stcRx.u32Out;
+        u32Cnt = (u32Cnt < pstcBuf->stcRx.u32Size) ? u32Cnt : pstcBuf->stcRx.u32Size;
+    }
+
+    return u32Cnt;
+}
+
+/**
+ * @brief  Get the free bytes of the TX ring of the buffered UART.
+ * @param  [in] pstcBuf                 Pointer to a @ref stc_usart_buf_t structure
+ * @retval Free bytes
+ */
+uint32_t USART_BufGetTxFree(const stc_usart_buf_t *pstcBuf)
+{
+    uint32_t u32Cnt = 0UL;
+
+    if (NULL != pstcBuf)
+    {
+        u32Cnt = pstcBuf->stcTx.u32Size - (pstcBuf->stcTx.u32In - pstcBuf->stcTx.u32Out);
+    }
+
+    return u32Cnt;
+}
+
+/**
+ * @brief  Buffered UART RX DMA transfer completed interrupt handler: a half of the RX ring is filled.
+ * @param  [in] pstcBuf                 Pointer to a @ref stc_usart_buf_t structure
+ * @retval None
+ */
+void USART_BufRxDmaIrqHandler(stc_usart_buf_t *pstcBuf)
+{
+    if (NULL != pstcBuf)
+    {
+        if (Set == DMA_GetTransIntStatus(pstcBuf->stcRxDmaCh.DMAx, (1UL << pstcBuf->stcRxDmaCh.u8Ch)))
+        {
+            DMA_ClearTransIntStatus(pstcBuf->stcRxDmaCh.DMAx, (1UL << pstcBuf->stcRxDmaCh.u8Ch));
+            pstcBuf->u32RxHalfIn += pstcBuf->stcRx.u32Size / 2UL;
+            USART_BufRxSync(pstcBuf);
+            if (NULL != pstcBuf->pfnRxCallback)
+            {
+                pstcBuf->pfnRxCallback();
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Buffered UART RX timeout interrupt handler: the line is idle after a partial burst.
+ * @param  [in] pstcBuf                 Pointer to a @ref stc_usart_buf_t structure
+ * @retval None
+ */
+void USART_BufRxTimeoutIrqHandler(stc_usart_buf_t *pstcBuf)
+{
+    M4_TMR0_TypeDef *TMR0x;
+    uint8_t u8Tmr0Ch;
+
+    if (NULL != pstcBuf)
+    {
+        if (Set == USART_GetStatus(pstcBuf->USARTx, USART_FLAG_RTOF))
+        {
+            /* Stopped until the next received data starts it again */
+            if (Ok == USART_BufGetRtoTmr0(pstcBuf->USARTx, &TMR0x, &u8Tmr0Ch))
+            {
+                TMR0_Cmd(TMR0x, u8Tmr0Ch, Disable);
+            }
+            USART_ClearStatus(pstcBuf->USARTx, USART_CLEAR_FLAG_RTOF);
+            USART_BufRxSync(pstcBuf);
+            if (NULL != pstcBuf->pfnRxCallback)
+            {
+                pstcBuf->pfnRxCallback();
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Buffered UART RX error interrupt handler.
+ * @param  [in] pstcBuf                 Pointer to a @ref stc_usart_buf_t structure
+ * @retval None
+ * @note   The errors are counted in u32RxErrCnt and cleared, so that the reception goes on.
+ */
+void USART_BufRxErrIrqHandler(stc_usart_buf_t *pstcBuf)
+{
+    if (NULL != pstcBuf)
+    {
+        if (Set == USART_GetStatus(pstcBuf->USARTx, (USART_FLAG_PE | USART_FLAG_FE | USART_FLAG_ORE)))
+        {
+            pstcBuf->u32RxErrCnt++;
+            if (Set == USART_GetStatus(pstcBuf->USARTx, (USART_FLAG_PE | USART_FLAG_FE)))
+            {
+                /* The faulty data raises no RI event, drop it */
+                (void)USART_RecData(pstcBuf->USARTx);
+            }
+            USART_ClearStatus(pstcBuf->USARTx, (USART_CLEAR_FLAG_PE | \
+                                                USART_CLEAR_FLAG_FE | \
+                                                USART_CLEAR_FLAG_ORE));
+        }
+    }
+}
+
+/**
+ * @brief  Buffered UART TX data register empty interrupt handler: start the next span of the TX ring.
+ * @param  [in] pstcBuf                 Pointer to a @ref stc_usart_buf_t structure
+ * @retval None
+ * @note   The first byte of the span is written here, each TI event of the following bytes triggers
+ *         the TX DMA, so no event is missed whatever the TX state when the span starts.
+ */
+void USART_BufTxEmptyIrqHandler(stc_usart_buf_t *pstcBuf)
+{
+    uint32_t u32Out;
+    uint32_t u32Cnt;
+    uint32_t u32Idx;
+
+    if (NULL != pstcBuf)
+    {
+        USART_FuncCmd(pstcBuf->USARTx, USART_INT_TXE, Disable);
+        u32Out = pstcBuf->stcTx.u32Out;
+        u32Cnt = pstcBuf->stcTx.u32In - u32Out;
+        if (0UL == u32Cnt)
+        {
+            pstcBuf->u8TxBusy = 0U;
+            if (NULL != pstcBuf->pfnTxCallback)
+            {
+                pstcBuf->pfnTxCallback();
+            }
+        }
+        else
+        {
+            /* Contiguous span up to the end of the ring */
+            u32Idx = u32Out & (pstcBuf->stcTx.u32Size - 1UL);
+            u32Cnt = ((pstcBuf->stcTx.u32Size - u32Idx) < u32Cnt) ? (pstcBuf->stcTx.u32Size - u32Idx) : u32Cnt;
+            if (1UL == u32Cnt)
+            {
+                USART_SendData(pstcBuf->USARTx, (uint16_t)pstcBuf->stcTx.pu8Buf[u32Idx]);
+                pstcBuf->stcTx.u32Out = u32Out + 1UL;
+                USART_FuncCmd(pstcBuf->USARTx, USART_INT_TXE, Enable);
+            }
+            else
+            {
+                pstcBuf->u32TxSpan = u32Cnt;
+                DMA_SetSrcAddr(pstcBuf->stcTxDmaCh.DMAx, pstcBuf->stcTxDmaCh.u8Ch,
+                               (uint32_t)&pstcBuf->stcTx.pu8Buf[u32Idx + 1UL]);
+                DMA_SetTransCnt(pstcBuf->stcTxDmaCh.DMAx, pstcBuf->stcTxDmaCh.u8Ch, (uint16_t)(u32Cnt - 1UL));
+                DMA_ChannelCmd(pstcBuf->stcTxDmaCh.DMAx, pstcBuf->stcTxDmaCh.u8Ch, Enable);
+                USART_SendData(pstcBuf->USARTx, (uint16_t)pstcBuf->stcTx.pu8Buf[u32Idx]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Buffered UART TX DMA transfer completed interrupt handler: the span is sent.
+ * @param  [in] pstcBuf                 Pointer to a @ref stc_usart_buf_t structure
+ * @retval None
+ */
+void USART_BufTxDmaIrqHandler(stc_usart_buf_t *pstcBuf)
+{
+    if (NULL != pstcBuf)
+    {
+        if (Set == DMA_GetTransIntStatus(pstcBuf->stcTxDmaCh.DMAx, (1UL << pstcBuf->stcTxDmaCh.u8Ch)))
+        {
+            DMA_ClearTransIntStatus(pstcBuf->stcTxDmaCh.DMAx, (1UL << pstcBuf->stcTxDmaCh.u8Ch));
+            pstcBuf->stcTx.u32Out += pstcBuf->u32TxSpan;
+            pstcBuf->u32TxSpan = 0UL;
+            /* Next span, or idle, once the data register is empty */
+            USART_FuncCmd(pstcBuf->USARTx, USART_INT_TXE, Enable);
+        }
+    }
+}
+#endif /* DDL_DMA_ENABLE && DDL_TMR0_ENABLE */
+
 /**
  * @}
  */
@@ -2722,6 +3360,152 @@ static en_result_t CalcSmartcardBaudrate(const M4_USART_TypeDef *USARTx,
     return enRet;
 }
 
+#if (DDL_DMA_ENABLE == DDL_ON) && (DDL_TMR0_ENABLE == DDL_ON)
+/**
+ * @brief  Get the RI and TI events of an USART.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ * @param  [out] penRxEvt               RI event, triggers the RX DMA
+ * @param  [out] penTxEvt               TI event, triggers the TX DMA
+ * @retval None
+ */
+static void USART_BufGetEvent(const M4_USART_TypeDef *USARTx,
+                                en_event_src_t *penRxEvt,
+                                en_event_src_t *penTxEvt)
+{
+    if (M4_USART1 == USARTx)
+    {
+        *penRxEvt = EVT_USART1_RI;
+        *penTxEvt = EVT_USART1_TI;
+    }
+    else if (M4_USART2 == USARTx)
+    {
+        *penRxEvt = EVT_USART2_RI;
+        *penTxEvt = EVT_USART2_TI;
+    }
+    else if (M4_USART3 == USARTx)
+    {
+        *penRxEvt = EVT_USART3_RI;
+        *penTxEvt = EVT_USART3_TI;
+    }
+    else if (M4_USART4 == USARTx)
+    {
+        *penRxEvt = EVT_USART4_RI;
+        *penTxEvt = EVT_USART4_TI;
+    }
+    else if (M4_USART5 == USARTx)
+    {
+        *penRxEvt = EVT_USART5_RI;
+        *penTxEvt = EVT_USART5_TI;
+    }
+    else if (M4_USART6 == USARTx)
+    {
+        *penRxEvt = EVT_USART6_RI;
+        *penTxEvt = EVT_USART6_TI;
+    }
+    else if (M4_USART7 == USARTx)
+    {
+        *penRxEvt = EVT_USART7_RI;
+        *penTxEvt = EVT_USART7_TI;
+    }
+    else if (M4_USART8 == USARTx)
+    {
+        *penRxEvt = EVT_USART8_RI;
+        *penTxEvt = EVT_USART8_TI;
+    }
+    else if (M4_USART9 == USARTx)
+    {
+        *penRxEvt = EVT_USART9_RI;
+        *penTxEvt = EVT_USART9_TI;
+    }
+    else
+    {
+        *penRxEvt = EVT_USART10_RI;
+        *penTxEvt = EVT_USART10_TI;
+    }
+}
+
+/**
+ * @brief  Get the TMR0 channel of the RX timeout of an USART.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ * @param  [out] ppstcTmr0              TMR0 unit
+ * @param  [out] pu8Tmr0Ch              TMR0 channel
+ * @retval An en_result_t enumeration value:
+ *           - Ok: The USART has the RX timeout
+ *           - ErrorInvalidParameter: The USART has no RX timeout
+ */
+static en_result_t USART_BufGetRtoTmr0(const M4_USART_TypeDef *USARTx,
+                                        M4_TMR0_TypeDef **ppstcTmr0,
+                                        uint8_t *pu8Tmr0Ch)
+{
+    en_result_t enRet = Ok;
+
+    if (M4_USART1 == USARTx)
+    {
+        *ppstcTmr0 = M4_TMR0_1;
+        *pu8Tmr0Ch = TMR0_CH_A;
+    }
+    else if (M4_USART2 == USARTx)
+    {
+        *ppstcTmr0 = M4_TMR0_1;
+        *pu8Tmr0Ch = TMR0_CH_B;
+    }
+    else if (M4_USART5 == USARTx)
+    {
+        *ppstcTmr0 = M4_TMR0_2;
+        *pu8Tmr0Ch = TMR0_CH_A;
+    }
+    else if (M4_USART6 == USARTx)
+    {
+        *ppstcTmr0 = M4_TMR0_2;
+        *pu8Tmr0Ch = TMR0_CH_B;
+    }
+    else
+    {
+        enRet = ErrorInvalidParameter;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the free running count of the bytes written in the RX ring by the DMA.
+ * @param  [in] pstcBuf                 Pointer to a @ref stc_usart_buf_t structure
+ * @retval RX count
+ * @note   Between the end of a half and its interrupt, the DMA may already write the other half while
+ *         u32RxHalfIn is not increased yet: the count then looks smaller than the last one known, kept
+ *         in u32In by the interrupts or in u32Out by the reader, which is returned instead.
+ */
+static uint32_t USART_BufGetRxIn(const stc_usart_buf_t *pstcBuf)
+{
+    uint32_t u32In;
+    uint32_t u32Last = pstcBuf->stcRx.u32In;
+    uint32_t u32Out = pstcBuf->stcRx.u32Out;
+
+    if ((int32_t)(u32Out - u32Last) > 0)
+    {
+        u32Last = u32Out;
+    }
+    u32In = pstcBuf->u32RxHalfIn + (pstcBuf->stcRx.u32Size / 2UL) - \
+            DMA_GetTransCnt(pstcBuf->stcRxDmaCh.DMAx, pstcBuf->stcRxDmaCh.u8Ch);
+    if ((int32_t)(u32In - u32Last) < 0)
+    {
+        u32In = u32Last;
+    }
+
+    return u32In;
+}
+
+/**
+ * @brief  Keep the RX count in u32In, from the interrupt handlers only.
+ * @param  [in] pstcBuf                 Pointer to a @ref stc_usart_buf_t structure
+ * @retval None
+ */
+static void USART_BufRxSync(stc_usart_buf_t *pstcBuf)
+{
+    pstcBuf->stcRx.u32In = USART_BufGetRxIn(pstcBuf);
+}
+#endif /* DDL_DMA_ENABLE && DDL_TMR0_ENABLE */
+
 /**
  * @}
  */
@@ -290,10 +290,28 @@ en_result_t low_level_output(struct netif *netif, struct pbuf *p)
     uint32_t frameLength = 0UL;
     uint32_t bufferOffset;
     uint32_t payloadOffset;
+    uint32_t checkLength;
+
+    /* Check that all buffers of the frame are available, so that a full ring costs no copy */
+    for (q = p; q != NULL; q = q->next)
+    {
+        frameLength = frameLength + q->len;
+    }
+    DmaTxDesc = EthHandle.stcTxDesc;
+    for (checkLength = 0UL; checkLength < frameLength; checkLength += ETH_TXBUF_SIZE)
+    {
+        if (Reset != (DmaTxDesc->u32ControlStatus & ETH_DMATXDESC_OWN))
+        {
+            enRet = Error;
+            goto error;
+        }
+        DmaTxDesc = (stc_eth_dma_desc_t *)(DmaTxDesc->u32Buffer2NextDescAddr);
+    }
 
     DmaTxDesc = EthHandle.stcTxDesc;
     txBuffer = (uint8_t *)((EthHandle.stcTxDesc)->u32Buffer1Addr);
     bufferOffset = 0UL;
+    frameLength = 0UL;
 
     /* Copy frame from pbufs to driver buffers */
     for (q = p; q != NULL; q = q->next)
@@ -0,0 +1,736 @@
+/**
+ *******************************************************************************
+ * @file  test/eth_sim/eth_sim.c
+ * @brief Host model of the ETH register block and DMA engines.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       Yangjp          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+#include "hc32_ddl.h"
+
+/**
+ * @defgroup ETH_SIM ETH DMA Host Model
+ * @brief Host model of the ETH register block and of the DMA engines in
+ *        chained descriptor mode.
+ * @note  The model has no thread of its own: it runs on every ETH register
+ *        access made through the hc32_common.h register macros, which
+ *        eth_sim.h routes to ETH_SIM_BusAccess(). Each run moves every frame
+ *        the descriptor rings allow, so a frame queued by the driver has been
+ *        sent, and looped back into the Rx ring, when the next register read
+ *        returns.
+ *        Modelled behaviour:
+ *          - DMA software reset, Tx FIFO flush and MMC counter reset complete
+ *            at once.
+ *          - SMI accesses go to a PHY with link up and auto-negotiation done
+ *            at 100M full duplex; PHY_LOOPBACK in PHY_BCR, or MAC_CONFIGR.LM,
+ *            returns every transmitted frame to the receiver.
+ *          - The Tx DMA fetches frames from the descriptors it owns, from
+ *            first to last segment, and suspends with TUS set at the first
+ *            descriptor owned by the CPU until DMA_TXPOLLR is written.
+ *          - The Rx DMA writes a frame only when it owns enough descriptors
+ *            for it, and otherwise suspends with RUS set until DMA_RXPOLLR is
+ *            written. The frame waits in the MAC meanwhile and holds back the
+ *            transmitter, so no frame is lost.
+ *          - DMA_DMASTSR status bits are write-1-to-clear.
+ *        Descriptor and buffer addresses are 32-bit, so the program is linked
+ *        without PIE to keep its data below 4 GiB.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ETH_SIM_Local_Types ETH Model Local Types
+ * @{
+ */
+
+/**
+ * @brief ETH DMA engine state
+ */
+typedef enum
+{
+    EthSimStop    = 0U,                 /*!< Stopped by STT/STR or reset */
+    EthSimRun     = 1U,                 /*!< Fetching descriptors */
+    EthSimSuspend = 2U,                 /*!< Waiting for a poll demand */
+} en_eth_sim_state_t;
+
+/**
+ * @brief ETH model state structure definition
+ */
+typedef struct
+{
+    uint16_t            au16PhyReg[32U];    /*!< PHY registers */
+    uint32_t            u32DmaStatus;       /*!< Value of DMA_DMASTSR */
+    uint32_t            u32OprMode;         /*!< Last seen DMA_OPRMODR */
+    en_eth_sim_state_t  enTxState;          /*!< Tx DMA state */
+    en_eth_sim_state_t  enRxState;          /*!< Rx DMA state */
+    stc_eth_dma_desc_t  *pstcTxDesc;        /*!< Current Tx descriptor */
+    stc_eth_dma_desc_t  *pstcRxDesc;        /*!< Current Rx descriptor */
+    uint32_t            u32WireLen;         /*!< Length of the frame waiting for the receiver */
+    uint8_t             u8Busy;             /*!< The model is running */
+    uint64_t            u64ModelTicks;      /*!< Time spent in the model */
+    stc_eth_sim_stat_t  stcStat;            /*!< Statistics */
+} stc_eth_sim_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ETH_SIM_Local_Macros ETH Model Local Macros
+ * @{
+ */
+
+/* Register block of the CMU: ETH_Init() reads the PCLK1 divider */
+#define ETH_SIM_CMU_BASE                ((uintptr_t)M4_CMU & ~(uintptr_t)0xFFFUL)
+#define ETH_SIM_PAGE_SIZE               (0x1000UL)
+#define ETH_SIM_PAGE_ALIGN(size)        (((size) + ETH_SIM_PAGE_SIZE - 1UL) & ~(ETH_SIM_PAGE_SIZE - 1UL))
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE             (0x100000)
+#endif
+
+/* Longest frame on the wire, FCS included */
+#define ETH_SIM_WIRE_SIZE               (ETH_PACKET_MAX_SIZE)
+#define ETH_SIM_FCS_SIZE                (4UL)
+#define ETH_SIM_RX_FRAME_LEN_POS        (16UL)
+
+/* PHY reset values: auto-negotiation on, 100M full duplex, link up */
+#define ETH_SIM_PHY_BCR_RESET           (PHY_AUTONEGOTIATION | PHY_FULLDUPLEX_100M)
+#define ETH_SIM_PHY_BSR_RESET           (PHY_100BASE_TX_FD | PHY_100BASE_TX_HD | PHY_10BASE_T_FD | \
+                                         PHY_10BASE_T_HD | PHY_AUTONEGO_COMPLETE | PHY_LINK_STATUS | 0x0009U)
+
+/* DMA status bits which software clears by writing 1 */
+#define ETH_SIM_DMA_STATUS_W1C          (0x0001E7FFUL)
+
+/* Self-clearing control bits */
+#define ETH_SIM_PTP_SELF_CLEAR          (ETH_PTP_TSPCTLR_TSPINI | ETH_PTP_TSPCTLR_TSPUP | ETH_PTP_TSPCTLR_TSPADUP)
+
+#define ETH_SIM_REG(member)             (*(__IO uint32_t *)&M4_ETH->member)
+#define ETH_SIM_REG_OFFSET(member)      ((uintptr_t)&M4_ETH->member - ETH_SIM_REG_BASE)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+uint32_t SystemCoreClock = 120000000UL;
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void ETH_SIM_Reset(void);
+static void ETH_SIM_RegWrite(uintptr_t uOffset);
+static void ETH_SIM_SmiAccess(void);
+static uint8_t ETH_SIM_TxRun(void);
+static uint8_t ETH_SIM_RxRun(void);
+static void ETH_SIM_Run(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_eth_sim_t m_stcEthSim;
+static uint8_t m_au8Wire[ETH_SIM_WIRE_SIZE + ETH_SIM_FCS_SIZE];
+
+/* Copies made by the DMA engines do not count as CPU copies */
+extern void *__real_memcpy(void *pvDst, const void *pvSrc, size_t uSize);
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ETH_SIM_Global_Functions ETH Model Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Map the register blocks at their device addresses and reset the model.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Map success
+ *           - Error: An address range is already in use
+ */
+en_result_t ETH_SIM_Init(void)
+{
+    void *pvCmu;
+    void *pvBitBand;
+    en_result_t enRet = Error;
+    const size_t uRegSize = ETH_SIM_PAGE_ALIGN(ETH_SIM_REG_BASE + ETH_SIM_REG_SIZE - ETH_SIM_CMU_BASE);
+
+    /* CMU and ETH share one mapping, the bit-band alias has its own */
+    pvCmu = mmap((void *)ETH_SIM_CMU_BASE, uRegSize, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    pvBitBand = mmap((void *)ETH_SIM_BB_BASE, ETH_SIM_PAGE_ALIGN(ETH_SIM_BB_SIZE), PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (((void *)ETH_SIM_CMU_BASE == pvCmu) && ((void *)ETH_SIM_BB_BASE == pvBitBand))
+    {
+        (void)memset(&m_stcEthSim, 0, sizeof(m_stcEthSim));
+        ETH_SIM_Reset();
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Register access made through the register macros.
+ * @param  [in] pvAddr                  Register or bit-band alias address
+ * @param  [in] u8Write                 1: the register has just been written
+ *                                      0: the register is about to be read
+ * @retval None
+ */
+void ETH_SIM_BusAccess(const volatile void *pvAddr, uint8_t u8Write)
+{
+    uintptr_t uAddr = (uintptr_t)pvAddr;
+    uintptr_t uOffset;
+    uint32_t u32Bit;
+    __IO uint32_t *pu32Reg;
+    uint64_t u64Start;
+
+    /* Register accesses made by the model itself */
+    if (0U == m_stcEthSim.u8Busy)
+    {
+        m_stcEthSim.u8Busy = 1U;
+        u64Start = ETH_SIM_GetTicks();
+        m_stcEthSim.stcStat.u64BusAccess++;
+
+        if ((uAddr - ETH_SIM_BB_BASE) < ETH_SIM_BB_SIZE)
+        {
+            /* Each bit of a register has a word in the alias region */
+            uOffset = ((uAddr - ETH_SIM_BB_BASE) >> 5U) & ~(uintptr_t)3UL;
+            u32Bit  = (uint32_t)((uAddr - ETH_SIM_BB_BASE) >> 2U) & 0x1FUL;
+            pu32Reg = (__IO uint32_t *)(ETH_SIM_REG_BASE + uOffset);
+            if (0U != u8Write)
+            {
+                if (0UL != (*(__IO uint32_t *)uAddr & 1UL))
+                {
+                    *pu32Reg |= (1UL << u32Bit);
+                }
+                else
+                {
+                    *pu32Reg &= ~(1UL << u32Bit);
+                }
+                ETH_SIM_RegWrite(uOffset);
+                ETH_SIM_Run();
+            }
+            else
+            {
+                ETH_SIM_Run();
+                *(__IO uint32_t *)uAddr = (*pu32Reg >> u32Bit) & 1UL;
+            }
+        }
+        else
+        {
+            if (0U != u8Write)
+            {
+                ETH_SIM_RegWrite(uAddr - ETH_SIM_REG_BASE);
+            }
+            ETH_SIM_Run();
+        }
+
+        m_stcEthSim.u64ModelTicks += ETH_SIM_GetTicks() - u64Start;
+        m_stcEthSim.u8Busy = 0U;
+    }
+}
+
+/**
+ * @brief  Get the model statistics.
+ * @param  [out] pstcStat               Pointer to a @ref stc_eth_sim_stat_t structure
+ * @retval None
+ */
+void ETH_SIM_GetStat(stc_eth_sim_stat_t *pstcStat)
+{
+    *pstcStat = m_stcEthSim.stcStat;
+}
+
+/**
+ * @brief  Get the time spent in the model.
+ * @param  None
+ * @retval Time stamp counter ticks
+ */
+uint64_t ETH_SIM_GetModelTicks(void)
+{
+    return m_stcEthSim.u64ModelTicks;
+}
+
+/**
+ * @brief  Get the time stamp counter.
+ * @param  None
+ * @retval Time stamp counter ticks
+ */
+uint64_t ETH_SIM_GetTicks(void)
+{
+    return __builtin_ia32_rdtsc();
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ETH_SIM_Local_Functions ETH Model Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Reset the DMA engines and the PHY.
+ * @param  None
+ * @retval None
+ */
+static void ETH_SIM_Reset(void)
+{
+    (void)memset(m_stcEthSim.au16PhyReg, 0, sizeof(m_stcEthSim.au16PhyReg));
+    m_stcEthSim.au16PhyReg[PHY_BCR] = ETH_SIM_PHY_BCR_RESET;
+    m_stcEthSim.au16PhyReg[PHY_BSR] = ETH_SIM_PHY_BSR_RESET;
+    m_stcEthSim.u32DmaStatus = 0UL;
+    m_stcEthSim.u32OprMode   = 0UL;
+    m_stcEthSim.enTxState    = EthSimStop;
+    m_stcEthSim.enRxState    = EthSimStop;
+    m_stcEthSim.pstcTxDesc   = NULL;
+    m_stcEthSim.pstcRxDesc   = NULL;
+    m_stcEthSim.u32WireLen   = 0UL;
+    ETH_SIM_REG(DMA_DMASTSR) = 0UL;
+    ETH_SIM_REG(DMA_OPRMODR) = 0UL;
+    ETH_SIM_REG(DMA_TXDLADR) = 0UL;
+    ETH_SIM_REG(DMA_RXDLADR) = 0UL;
+}
+
+/**
+ * @brief  Apply the side effects of a register write.
+ * @param  [in] uOffset                 Register offset in the ETH block
+ * @retval None
+ */
+static void ETH_SIM_RegWrite(uintptr_t uOffset)
+{
+    uint32_t u32Value;
+
+    if (ETH_SIM_REG_OFFSET(DMA_BUSMODR) == uOffset)
+    {
+        if (0UL != (ETH_SIM_REG(DMA_BUSMODR) & ETH_DMA_BUSMODR_SWR))
+        {
+            ETH_SIM_Reset();
+            ETH_SIM_REG(DMA_BUSMODR) &= ~ETH_DMA_BUSMODR_SWR;
+        }
+    }
+    else if (ETH_SIM_REG_OFFSET(DMA_DMASTSR) == uOffset)
+    {
+        /* The register holds the value written: clear those status bits */
+        u32Value = ETH_SIM_REG(DMA_DMASTSR);
+        m_stcEthSim.u32DmaStatus &= ~(u32Value & ETH_SIM_DMA_STATUS_W1C);
+        ETH_SIM_REG(DMA_DMASTSR) = m_stcEthSim.u32DmaStatus;
+    }
+    else if (ETH_SIM_REG_OFFSET(DMA_OPRMODR) == uOffset)
+    {
+        u32Value = ETH_SIM_REG(DMA_OPRMODR);
+        /* The descriptor list address is taken when an engine starts */
+        if (0UL != ((u32Value & ~m_stcEthSim.u32OprMode) & ETH_DMA_OPRMODR_STT))
+        {
+            m_stcEthSim.pstcTxDesc = (stc_eth_dma_desc_t *)(uintptr_t)ETH_SIM_REG(DMA_TXDLADR);
+            m_stcEthSim.enTxState  = EthSimRun;
+        }
+        else if (0UL == (u32Value & ETH_DMA_OPRMODR_STT))
+        {
+            m_stcEthSim.enTxState = EthSimStop;
+        }
+        else
+        {
+            /* Tx DMA state unchanged */
+        }
+        if (0UL != ((u32Value & ~m_stcEthSim.u32OprMode) & ETH_DMA_OPRMODR_STR))
+        {
+            m_stcEthSim.pstcRxDesc = (stc_eth_dma_desc_t *)(uintptr_t)ETH_SIM_REG(DMA_RXDLADR);
+            m_stcEthSim.enRxState  = EthSimRun;
+        }
+        else if (0UL == (u32Value & ETH_DMA_OPRMODR_STR))
+        {
+            m_stcEthSim.enRxState = EthSimStop;
+        }
+        else
+        {
+            /* Rx DMA state unchanged */
+        }
+        /* The Tx FIFO is always empty */
+        u32Value &= ~ETH_DMA_OPRMODR_FTF;
+        ETH_SIM_REG(DMA_OPRMODR) = u32Value;
+        m_stcEthSim.u32OprMode = u32Value;
+    }
+    else if (ETH_SIM_REG_OFFSET(DMA_TXPOLLR) == uOffset)
+    {
+        m_stcEthSim.stcStat.u32TxPollDemand++;
+        if (EthSimSuspend == m_stcEthSim.enTxState)
+        {
+            m_stcEthSim.enTxState = EthSimRun;
+        }
+    }
+    else if (ETH_SIM_REG_OFFSET(DMA_RXPOLLR) == uOffset)
+    {
+        m_stcEthSim.stcStat.u32RxPollDemand++;
+        if (EthSimSuspend == m_stcEthSim.enRxState)
+        {
+            m_stcEthSim.enRxState = EthSimRun;
+        }
+    }
+    else if (ETH_SIM_REG_OFFSET(MAC_SMIADDR) == uOffset)
+    {
+        if (0UL != (ETH_SIM_REG(MAC_SMIADDR) & ETH_MAC_SMIADDR_SMIB))
+        {
+            ETH_SIM_SmiAccess();
+        }
+    }
+    else if (ETH_SIM_REG_OFFSET(MMC_MMCCTLR) == uOffset)
+    {
+        ETH_SIM_REG(MMC_MMCCTLR) &= ~ETH_MMC_MMCCTLR_CRST;
+    }
+    else if (ETH_SIM_REG_OFFSET(PTP_TSPCTLR) == uOffset)
+    {
+        ETH_SIM_REG(PTP_TSPCTLR) &= ~ETH_SIM_PTP_SELF_CLEAR;
+    }
+    else
+    {
+        /* Plain storage */
+    }
+}
+
+/**
+ * @brief  Complete the SMI transaction set up in MAC_SMIADDR.
+ * @param  None
+ * @retval None
+ */
+static void ETH_SIM_SmiAccess(void)
+{
+    const uint32_t u32Addr = ETH_SIM_REG(MAC_SMIADDR);
+    const uint32_t u32Reg  = (u32Addr & ETH_MAC_SMIADDR_SMIR) >> ETH_MAC_SMIADDR_SMIR_POS;
+    uint16_t u16Value;
+
+    if (0UL != (u32Addr & ETH_MAC_SMIADDR_SMIW))
+    {
+        u16Value = (uint16_t)ETH_SIM_REG(MAC_SMIDATR);
+        if (PHY_BCR == u32Reg)
+        {
+            if (0U != (u16Value & PHY_SOFT_RESET))
+            {
+                /* Soft reset is self-clearing */
+                u16Value = ETH_SIM_PHY_BCR_RESET;
+            }
+            m_stcEthSim.au16PhyReg[PHY_BCR] = u16Value;
+        }
+        else if (PHY_BSR != u32Reg)
+        {
+            m_stcEthSim.au16PhyReg[u32Reg] = u16Value;
+        }
+        else
+        {
+            /* PHY_BSR is read-only */
+        }
+    }
+    else
+    {
+        ETH_SIM_REG(MAC_SMIDATR) = m_stcEthSim.au16PhyReg[u32Reg];
+    }
+    ETH_SIM_REG(MAC_SMIADDR) = u32Addr & ~ETH_MAC_SMIADDR_SMIB;
+}
+
+/**
+ * @brief  Fetch one frame from the Tx descriptor ring.
+ * @param  None
+ * @retval 1: A frame has been sent
+ *         0: No progress
+ */
+static uint8_t ETH_SIM_TxRun(void)
+{
+    stc_eth_dma_desc_t *pstcDesc = m_stcEthSim.pstcTxDesc;
+    uint32_t u32Len = 0UL;
+    uint32_t u32Size;
+    uint32_t u32Status;
+    uint32_t u32DescCnt = 0UL;
+    uint8_t u8Progress = 0U;
+
+    if ((EthSimRun != m_stcEthSim.enTxState) || (NULL == pstcDesc) || (0UL != m_stcEthSim.u32WireLen))
+    {
+        /* Stopped, suspended, or the last frame still waits for the receiver */
+    }
+    else if (0UL == (__atomic_load_n(&pstcDesc->u32ControlStatus, __ATOMIC_ACQUIRE) & ETH_DMATXDESC_OWN))
+    {
+        m_stcEthSim.enTxState = EthSimSuspend;
+        m_stcEthSim.u32DmaStatus |= ETH_DMA_DMASTSR_TUS;
+        m_stcEthSim.stcStat.u32TxSuspend++;
+    }
+    else
+    {
+        /* Gather the segments of the frame */
+        for (;;)
+        {
+            u32Status = __atomic_load_n(&pstcDesc->u32ControlStatus, __ATOMIC_ACQUIRE);
+            if (0UL == (u32Status & ETH_DMATXDESC_OWN))
+            {
+                /* The CPU is still handing over the next segment */
+                u32Len = 0UL;
+                break;
+            }
+            u32Size = pstcDesc->u32ControlBufferSize & ETH_DMATXDESC_TBS1;
+            if (((0UL == u32DescCnt) && (0UL == (u32Status & ETH_DMATXDESC_TFS))) ||
+                ((u32Len + u32Size) > ETH_SIM_WIRE_SIZE))
+            {
+                m_stcEthSim.stcStat.u32DescError++;
+                m_stcEthSim.enTxState = EthSimStop;
+                u32Len = 0UL;
+                break;
+            }
+            __real_memcpy(&m_au8Wire[u32Len], (const void *)(uintptr_t)pstcDesc->u32Buffer1Addr, u32Size);
+            u32Len += u32Size;
+            u32DescCnt++;
+            if (0UL != (u32Status & ETH_DMATXDESC_TLS))
+            {
+                break;
+            }
+            pstcDesc = (stc_eth_dma_desc_t *)(uintptr_t)pstcDesc->u32Buffer2NextDescAddr;
+        }
+
+        if (0UL != u32Len)
+        {
+            /* Give the descriptors back to the CPU */
+            pstcDesc = m_stcEthSim.pstcTxDesc;
+            while (0UL != u32DescCnt)
+            {
+                u32Status = pstcDesc->u32ControlStatus & ~ETH_DMATXDESC_OWN;
+                __atomic_store_n(&pstcDesc->u32ControlStatus, u32Status, __ATOMIC_RELEASE);
+                pstcDesc = (stc_eth_dma_desc_t *)(uintptr_t)pstcDesc->u32Buffer2NextDescAddr;
+                m_stcEthSim.stcStat.u32TxDesc++;
+                u32DescCnt--;
+            }
+            m_stcEthSim.pstcTxDesc = pstcDesc;
+            m_stcEthSim.u32DmaStatus |= (ETH_DMA_DMASTSR_TIS | ETH_DMA_DMASTSR_NIS);
+            m_stcEthSim.stcStat.u32TxFrames++;
+            m_stcEthSim.stcStat.u64WireBytes += u32Len;
+
+            if ((0U != (m_stcEthSim.au16PhyReg[PHY_BCR] & PHY_LOOPBACK)) ||
+                (0UL != (ETH_SIM_REG(MAC_CONFIGR) & ETH_MAC_CONFIGR_LM)))
+            {
+                /* The model does not compute the FCS */
+                (void)memset(&m_au8Wire[u32Len], 0, ETH_SIM_FCS_SIZE);
+                m_stcEthSim.u32WireLen = u32Len + ETH_SIM_FCS_SIZE;
+            }
+            else
+            {
+                m_stcEthSim.stcStat.u32Dropped++;
+            }
+            u8Progress = 1U;
+        }
+    }
+
+    return u8Progress;
+}
+
+/**
+ * @brief  Write the frame waiting in the MAC to the Rx descriptor ring.
+ * @param  None
+ * @retval 1: A frame has been received
+ *         0: No progress
+ */
+static uint8_t ETH_SIM_RxRun(void)
+{
+    stc_eth_dma_desc_t *pstcDesc = m_stcEthSim.pstcRxDesc;
+    uint32_t u32Len = m_stcEthSim.u32WireLen;
+    uint32_t u32Offset = 0UL;
+    uint32_t u32Size;
+    uint32_t u32Status;
+    uint8_t u8Progress = 0U;
+
+    if ((EthSimRun != m_stcEthSim.enRxState) || (NULL == pstcDesc) || (0UL == u32Len) ||
+        (0UL == (ETH_SIM_REG(MAC_CONFIGR) & ETH_MAC_CONFIGR_RE)))
+    {
+        /* Stopped, suspended, or nothing to receive */
+    }
+    else
+    {
+        /* The whole frame must fit in the descriptors owned by the DMA */
+        while (u32Offset < u32Len)
+        {
+            if (0UL == (__atomic_load_n(&pstcDesc->u32ControlStatus, __ATOMIC_ACQUIRE) & ETH_DMARXDESC_OWN))
+            {
+                break;
+            }
+            u32Offset += pstcDesc->u32ControlBufferSize & ETH_DMARXDESC_RBS1;
+            pstcDesc = (stc_eth_dma_desc_t *)(uintptr_t)pstcDesc->u32Buffer2NextDescAddr;
+        }
+
+        if (u32Offset < u32Len)
+        {
+            m_stcEthSim.enRxState = EthSimSuspend;
+            m_stcEthSim.u32DmaStatus |= ETH_DMA_DMASTSR_RUS;
+            m_stcEthSim.stcStat.u32RxSuspend++;
+        }
+        else
+        {
+            pstcDesc = m_stcEthSim.pstcRxDesc;
+            u32Offset = 0UL;
+            u32Status = ETH_DMARXDESC_RFS;
+            while (u32Offset < u32Len)
+            {
+                u32Size = pstcDesc->u32ControlBufferSize & ETH_DMARXDESC_RBS1;
+                if (u32Size >= (u32Len - u32Offset))
+                {
+                    u32Size = u32Len - u32Offset;
+                    u32Status |= ETH_DMARXDESC_RLS | (u32Len << ETH_SIM_RX_FRAME_LEN_POS);
+                }
+                __real_memcpy((void *)(uintptr_t)pstcDesc->u32Buffer1Addr, &m_au8Wire[u32Offset], u32Size);
+                pstcDesc->u32ExtendStatus = 0UL;
+                /* Clearing OWN hands the segment to the CPU */
+                __atomic_store_n(&pstcDesc->u32ControlStatus, u32Status, __ATOMIC_RELEASE);
+                pstcDesc = (stc_eth_dma_desc_t *)(uintptr_t)pstcDesc->u32Buffer2NextDescAddr;
+                m_stcEthSim.stcStat.u32RxDesc++;
+                u32Offset += u32Size;
+                u32Status = 0UL;
+            }
+            m_stcEthSim.pstcRxDesc = pstcDesc;
+            m_stcEthSim.u32WireLen = 0UL;
+            m_stcEthSim.u32DmaStatus |= (ETH_DMA_DMASTSR_RIS | ETH_DMA_DMASTSR_NIS);
+            m_stcEthSim.stcStat.u32RxFrames++;
+            m_stcEthSim.stcStat.u64WireBytes += u32Len;
+            u8Progress = 1U;
+        }
+    }
+
+    return u8Progress;
+}
+
+/**
+ * @brief  Run the DMA engines until neither can make progress.
+ * @param  None
+ * @retval None
+ */
+static void ETH_SIM_Run(void)
+{
+    uint8_t u8Progress;
+
+    do
+    {
+        u8Progress  = ETH_SIM_RxRun();
+        u8Progress |= ETH_SIM_TxRun();
+    } while (0U != u8Progress);
+
+    ETH_SIM_REG(DMA_DMASTSR) = m_stcEthSim.u32DmaStatus;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ETH_SIM_Board_Stubs ETH Model Board Stubs
+ * @brief Host versions of the board and system functions the glue calls.
+ * @{
+ */
+void DDL_DelayMS(uint32_t u32Cnt)
+{
+    (void)u32Cnt;
+}
+
+void SysTick_Delay(uint32_t u32Delay)
+{
+    (void)u32Delay;
+}
+
+uint32_t SysTick_GetTick(void)
+{
+    struct timespec stcTime;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stcTime);
+    return (uint32_t)((stcTime.tv_sec * 1000L) + (stcTime.tv_nsec / 1000000L));
+}
+
+void BSP_IO_ConfigPortPin(uint8_t u8Port, uint8_t u8Pin, uint8_t u8Dir)
+{
+    (void)u8Port;
+    (void)u8Pin;
+    (void)u8Dir;
+}
+
+void BSP_IO_WritePortPin(uint8_t u8Port, uint8_t u8Pin, uint8_t u8PinState)
+{
+    (void)u8Port;
+    (void)u8Pin;
+    (void)u8PinState;
+}
+
+void GPIO_SetFunc(uint8_t u8Port, uint16_t u16Pin, uint8_t u8Func, uint16_t u16BFE)
+{
+    (void)u8Port;
+    (void)u16Pin;
+    (void)u8Func;
+    (void)u16BFE;
+}
+
+void PWC_Fcg1PeriphClockCmd(uint32_t u32Fcg1Periph, en_functional_state_t enNewState)
+{
+    (void)u32Fcg1Periph;
+    (void)enNewState;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
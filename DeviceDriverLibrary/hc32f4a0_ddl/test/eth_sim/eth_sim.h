@@ -0,0 +1,197 @@
+/**
+ *******************************************************************************
+ * @file  test/eth_sim/eth_sim.h
+ * @brief Host model of the ETH DMA engine: register access hooks and API.
+ *        Force-included ahead of every source of the benchmark.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       Yangjp          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+#ifndef __ETH_SIM_H__
+#define __ETH_SIM_H__
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdint.h>
+#include "hc32_common.h"
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @addtogroup ETH_SIM
+ * @{
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ETH_SIM_Global_Types ETH Model Global Types
+ * @{
+ */
+
+/**
+ * @brief ETH model statistics structure definition
+ */
+typedef struct
+{
+    uint32_t u32TxFrames;                   /*!< Frames fetched by the Tx DMA */
+    uint32_t u32TxDesc;                     /*!< Tx descriptors given back to the CPU */
+    uint32_t u32RxFrames;                   /*!< Frames written by the Rx DMA */
+    uint32_t u32RxDesc;                     /*!< Rx descriptors given back to the CPU */
+    uint32_t u32TxPollDemand;               /*!< Writes to DMA_TXPOLLR */
+    uint32_t u32RxPollDemand;               /*!< Writes to DMA_RXPOLLR */
+    uint32_t u32TxSuspend;                  /*!< Tx DMA suspended on a CPU owned descriptor */
+    uint32_t u32RxSuspend;                  /*!< Rx DMA suspended on a CPU owned descriptor */
+    uint32_t u32Dropped;                    /*!< Frames sent with loopback disabled */
+    uint32_t u32DescError;                  /*!< Malformed Tx descriptor chains */
+    uint64_t u64WireBytes;                  /*!< Bytes moved by the DMA engines */
+    uint64_t u64BusAccess;                  /*!< Register accesses that clocked the model */
+} stc_eth_sim_stat_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ETH_SIM_Global_Macros ETH Model Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup ETH_SIM_Bus_Window ETH Model Bus Window
+ * @brief The register block and its bit-band alias sit at their device
+ *        addresses, mapped by ETH_SIM_Init().
+ * @{
+ */
+#define ETH_SIM_REG_BASE                (0x40050000UL)
+#define ETH_SIM_REG_SIZE                (sizeof(M4_ETH_TypeDef))
+#define ETH_SIM_BB_BASE                 (0x42A00000UL)
+#define ETH_SIM_BB_SIZE                 (sizeof(bM4_ETH_TypeDef))
+
+#define ETH_SIM_IS_BUS_ADDR(addr)                                              \
+(   (((uintptr_t)(addr) - ETH_SIM_REG_BASE) < ETH_SIM_REG_SIZE)             || \
+    (((uintptr_t)(addr) - ETH_SIM_BB_BASE) < ETH_SIM_BB_SIZE))
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ETH_SIM_Bus_Access ETH Model Bus Access
+ * @brief Register macros of hc32_common.h, routed through the model.
+ * @note  A read lets the model run before the value is sampled, a write lets
+ *        it act on the new value. Accesses outside the ETH window, such as
+ *        descriptor updates, cost one address compare.
+ * @{
+ */
+#define ETH_SIM_BUS(REG, WR)                                                   \
+(   ETH_SIM_IS_BUS_ADDR(&(REG)) ? ETH_SIM_BusAccess(&(REG), (WR)) : (void)0)
+
+#undef  READ_REG32
+#define READ_REG32(REG)                 (ETH_SIM_BUS((REG), 0U), (REG))
+
+#undef  READ_REG32_BIT
+#define READ_REG32_BIT(REG, BIT)        (ETH_SIM_BUS((REG), 0U), ((REG) & ((uint32_t)(BIT))))
+
+#undef  WRITE_REG32
+#define WRITE_REG32(REG, VAL)           ((REG) = ((uint32_t)(VAL)), ETH_SIM_BUS((REG), 1U))
+
+#undef  SET_REG32_BIT
+#define SET_REG32_BIT(REG, BIT)         ((REG) |= ((uint32_t)(BIT)), ETH_SIM_BUS((REG), 1U))
+
+#undef  CLEAR_REG32_BIT
+#define CLEAR_REG32_BIT(REG, BIT)       ((REG) &= ((uint32_t)(~((uint32_t)(BIT)))), ETH_SIM_BUS((REG), 1U))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ETH_SIM_Global_Functions
+ * @{
+ */
+en_result_t ETH_SIM_Init(void);
+void ETH_SIM_BusAccess(const volatile void *pvAddr, uint8_t u8Write);
+void ETH_SIM_GetStat(stc_eth_sim_stat_t *pstcStat);
+uint64_t ETH_SIM_GetModelTicks(void);
+uint64_t ETH_SIM_GetTicks(void);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ETH_SIM_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,307 @@
+/**
+ *******************************************************************************
+ * @file  test/eth_sim/main.c
+ * @brief ETH DMA throughput benchmark over the ethernetif.c glue.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       Yangjp          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "hc32_ddl.h"
+#include "ethernetif.h"
+
+/**
+ * @defgroup ETH_SIM_Bench ETH DMA Throughput Benchmark
+ * @brief Loop frames through ethernetif.c and the ETH driver against the host
+ *        model, check every received frame and report the cost per frame.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* Frames per size when no count is given on the command line */
+#define BENCH_FRAME_NUM                 (200000UL)
+
+/* A frame that makes no progress for this many polls has been lost */
+#define BENCH_STALL_LIMIT               (1000UL)
+
+#define BENCH_HEADER_SIZE               (14UL)
+#define BENCH_SEQ_SIZE                  (4UL)
+#define BENCH_FRAME_MAX                 (1514UL)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static struct netif m_stcNetif;
+static uint8_t m_au8TxFrame[BENCH_FRAME_MAX];
+static uint32_t m_u32FrameLen;
+static uint32_t m_u32RxSeq;
+static uint32_t m_u32RxError;
+
+/* CPU copies made by the glue and the driver */
+static uint64_t m_u64CopyBytes;
+static uint64_t m_u64CopyCalls;
+
+static const uint32_t m_au32FrameLen[] = {60UL, 590UL, 1514UL};
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Count the CPU copies, the link is made with --wrap=memcpy.
+ */
+extern void *__real_memcpy(void *pvDst, const void *pvSrc, size_t uSize);
+void *__wrap_memcpy(void *pvDst, const void *pvSrc, size_t uSize)
+{
+    m_u64CopyBytes += uSize;
+    m_u64CopyCalls++;
+    return __real_memcpy(pvDst, pvSrc, uSize);
+}
+
+/**
+ * @brief  Check a received frame against the frame that was sent.
+ * @param  [in] netif                   Network interface structure
+ * @param  [in] p                       Received frame
+ * @retval None
+ */
+void EthernetIF_InputDataCallback(struct netif *netif, struct pbuf *p)
+{
+    const uint8_t *pu8Data = (const uint8_t *)p->payload;
+    uint32_t u32Seq;
+
+    (void)netif;
+    u32Seq = ((uint32_t)pu8Data[BENCH_HEADER_SIZE] << 24U) | ((uint32_t)pu8Data[BENCH_HEADER_SIZE + 1UL] << 16U) |
+             ((uint32_t)pu8Data[BENCH_HEADER_SIZE + 2UL] << 8U) | (uint32_t)pu8Data[BENCH_HEADER_SIZE + 3UL];
+    if ((p->len != m_u32FrameLen) || (u32Seq != m_u32RxSeq) ||
+        (0 != memcmp(pu8Data, m_au8TxFrame, BENCH_HEADER_SIZE)) ||
+        (0 != memcmp(&pu8Data[BENCH_HEADER_SIZE + BENCH_SEQ_SIZE], &m_au8TxFrame[BENCH_HEADER_SIZE + BENCH_SEQ_SIZE],
+                     m_u32FrameLen - BENCH_HEADER_SIZE - BENCH_SEQ_SIZE)))
+    {
+        m_u32RxError++;
+    }
+    m_u32RxSeq++;
+}
+
+/**
+ * @brief  Send and receive a number of frames of one size.
+ * @param  [in] u32Len                  Frame length without FCS
+ * @param  [in] u32Num                  Number of frames
+ * @retval 0: All frames received intact, otherwise the number of failures
+ */
+static uint32_t Bench_Run(uint32_t u32Len, uint32_t u32Num)
+{
+    struct pbuf stcHeader;
+    struct pbuf stcPayload;
+    stc_eth_sim_stat_t stcStart;
+    stc_eth_sim_stat_t stcEnd;
+    struct timespec stcT0;
+    struct timespec stcT1;
+    uint64_t u64Ticks;
+    uint64_t u64ModelTicks;
+    uint32_t u32Sent = 0UL;
+    uint32_t u32Stall = 0UL;
+    uint32_t u32Last = 0UL;
+    uint32_t u32Busy = 0UL;
+    uint32_t i;
+    double dSec;
+    double dDriverSec;
+
+    /* Broadcast header, local experimental EtherType, then sequence and pattern */
+    (void)memset(m_au8TxFrame, 0xFF, 6U);
+    for (i = 6UL; i < 12UL; i++)
+    {
+        m_au8TxFrame[i] = m_stcNetif.hwaddr[i - 6UL];
+    }
+    m_au8TxFrame[12] = 0x88U;
+    m_au8TxFrame[13] = 0xB5U;
+    for (i = BENCH_HEADER_SIZE; i < u32Len; i++)
+    {
+        m_au8TxFrame[i] = (uint8_t)((i * 7UL) + u32Len);
+    }
+    m_u32FrameLen = u32Len;
+    m_u32RxSeq    = 0UL;
+    m_u32RxError  = 0UL;
+
+    /* Header and payload in two pbufs, as a stack hands them down */
+    stcHeader.next     = &stcPayload;
+    stcHeader.payload  = m_au8TxFrame;
+    stcHeader.len      = BENCH_HEADER_SIZE;
+    stcPayload.next    = NULL;
+    stcPayload.payload = &m_au8TxFrame[BENCH_HEADER_SIZE];
+    stcPayload.len     = u32Len - BENCH_HEADER_SIZE;
+
+    ETH_SIM_GetStat(&stcStart);
+    m_u64CopyBytes = 0UL;
+    m_u64CopyCalls = 0UL;
+    u64ModelTicks = ETH_SIM_GetModelTicks();
+    u64Ticks = ETH_SIM_GetTicks();
+    (void)clock_gettime(CLOCK_MONOTONIC, &stcT0);
+
+    while ((m_u32RxSeq < u32Num) && (u32Stall < BENCH_STALL_LIMIT))
+    {
+        if (u32Sent < u32Num)
+        {
+            m_au8TxFrame[BENCH_HEADER_SIZE]       = (uint8_t)(u32Sent >> 24U);
+            m_au8TxFrame[BENCH_HEADER_SIZE + 1UL] = (uint8_t)(u32Sent >> 16U);
+            m_au8TxFrame[BENCH_HEADER_SIZE + 2UL] = (uint8_t)(u32Sent >> 8U);
+            m_au8TxFrame[BENCH_HEADER_SIZE + 3UL] = (uint8_t)u32Sent;
+            if (Ok == low_level_output(&m_stcNetif, &stcHeader))
+            {
+                u32Sent++;
+            }
+            else
+            {
+                /* Tx ring full: the copies made so far are repeated */
+                u32Busy++;
+            }
+        }
+        ethernetif_input(&m_stcNetif);
+        if (u32Last != m_u32RxSeq)
+        {
+            u32Last  = m_u32RxSeq;
+            u32Stall = 0UL;
+        }
+        else
+        {
+            u32Stall++;
+        }
+    }
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stcT1);
+    u64Ticks = ETH_SIM_GetTicks() - u64Ticks;
+    u64ModelTicks = ETH_SIM_GetModelTicks() - u64ModelTicks;
+    ETH_SIM_GetStat(&stcEnd);
+
+    dSec = (double)(stcT1.tv_sec - stcT0.tv_sec) + ((double)(stcT1.tv_nsec - stcT0.tv_nsec) / 1e9);
+    dDriverSec = dSec * (1.0 - ((double)u64ModelTicks / (double)u64Ticks));
+    printf("%5lu B  %9.0f frames/s  %9.0f frames/s driver+glue  %7.1f B copied/frame  %5.2f memcpy/frame  %4.2f busy/frame  "
+           "desc tx %4.2f rx %4.2f  poll tx %4.2f rx %4.2f  %s\n",
+           (unsigned long)u32Len,
+           (double)m_u32RxSeq / dSec,
+           (double)m_u32RxSeq / dDriverSec,
+           (double)m_u64CopyBytes / (double)u32Num,
+           (double)m_u64CopyCalls / (double)u32Num,
+           (double)u32Busy / (double)u32Num,
+           (double)(stcEnd.u32TxDesc - stcStart.u32TxDesc) / (double)u32Num,
+           (double)(stcEnd.u32RxDesc - stcStart.u32RxDesc) / (double)u32Num,
+           (double)(stcEnd.u32TxPollDemand - stcStart.u32TxPollDemand) / (double)u32Num,
+           (double)(stcEnd.u32RxPollDemand - stcStart.u32RxPollDemand) / (double)u32Num,
+           ((m_u32RxSeq == u32Num) && (0UL == m_u32RxError)) ? "ok" : "FAIL");
+
+    if (m_u32RxSeq != u32Num)
+    {
+        printf("       stalled after %lu of %lu frames\n", (unsigned long)m_u32RxSeq, (unsigned long)u32Num);
+    }
+
+    return (u32Num - m_u32RxSeq) + m_u32RxError;
+}
+
+/**
+ * @brief  Main function of the ETH DMA benchmark.
+ * @param  [in] argc                    Argument count
+ * @param  [in] argv                    Optional number of frames per size
+ * @retval 0: Pass, 1: Fail
+ */
+int main(int argc, char *argv[])
+{
+    uint32_t u32Num = BENCH_FRAME_NUM;
+    uint32_t u32Fail = 0UL;
+    uint32_t i;
+
+    if (argc > 1)
+    {
+        u32Num = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+
+    if (Ok != ETH_SIM_Init())
+    {
+        printf("ETH model: cannot map the register blocks\n");
+        return 1;
+    }
+    if (Ok != ethernetif_init(&m_stcNetif))
+    {
+        printf("ethernetif_init failed\n");
+        return 1;
+    }
+
+    printf("ETH DMA model: %lu x %lu B Tx buffers, %lu x %lu B Rx buffers, %lu frames per size\n",
+           (unsigned long)ETH_TXBUF_NUMBER, (unsigned long)ETH_TXBUF_SIZE,
+           (unsigned long)ETH_RXBUF_NUMBER, (unsigned long)ETH_RXBUF_SIZE, (unsigned long)u32Num);
+    for (i = 0UL; i < ARRAY_SZ(m_au32FrameLen); i++)
+    {
+        u32Fail += Bench_Run(m_au32FrameLen[i], u32Num);
+    }
+
+    return (0UL == u32Fail) ? 0 : 1;
+}
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
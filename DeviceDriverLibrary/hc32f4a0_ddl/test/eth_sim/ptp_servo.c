@@ -0,0 +1,271 @@
+/**
+ *******************************************************************************
+ * @file  test/eth_sim/ptp_servo.c
+ * @brief PTP clock servo test against recorded offset traces.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       Yangjp          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdio.h>
+#include "hc32_ddl.h"
+
+/**
+ * @defgroup ETH_SIM_PtpServo PTP Clock Servo Test
+ * @brief Close the servo loop over a host model of the local clock: step, ramp
+ *        and drift offset traces, the time step and the addend clamp.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* Nominal addend: 2^32 * 50MHz / 60MHz */
+#define SERVO_BASE_ADDEND               (0xD5555555UL)
+
+/* Samples run for a trace and samples allowed to settle */
+#define SERVO_TRACE_LEN                 (200UL)
+#define SERVO_SETTLE_LEN                (60UL)
+
+/* Offset(ns) a settled servo stays within */
+#define SERVO_LOCK_BOUND                (10LL)
+#define SERVO_DRIFT_BOUND               (500LL)
+
+#define SERVO_CHECK(cond)               Servo_Check((cond), #cond, __LINE__)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t m_u32Fail;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  The model is linked with --wrap=memcpy, nothing is counted here.
+ */
+extern void *__real_memcpy(void *pvDst, const void *pvSrc, size_t uSize);
+void *__wrap_memcpy(void *pvDst, const void *pvSrc, size_t uSize)
+{
+    return __real_memcpy(pvDst, pvSrc, uSize);
+}
+
+/**
+ * @brief  Record a failed check.
+ * @param  [in] u8Cond                  Check result
+ * @param  [in] pcExpr                  Checked expression
+ * @param  [in] u32Line                 Source line
+ * @retval None
+ */
+static void Servo_Check(uint8_t u8Cond, const char *pcExpr, uint32_t u32Line)
+{
+    if (0U == u8Cond)
+    {
+        printf("  line %lu: %s\n", (unsigned long)u32Line, pcExpr);
+        m_u32Fail++;
+    }
+}
+
+/**
+ * @brief  Initialize a servo with the default gains on the nominal addend.
+ * @param  [out] pstcServo              Servo
+ * @retval None
+ */
+static void Servo_Start(stc_eth_ptp_servo_t *pstcServo)
+{
+    stc_eth_ptp_servo_init_t stcServoInit;
+
+    (void)ETH_PTP_ServoStructInit(&stcServoInit);
+    stcServoInit.u32BaseAddend = SERVO_BASE_ADDEND;
+    (void)ETH_PTP_ServoInit(pstcServo, &stcServoInit);
+    WRITE_REG32(M4_ETH->PTP_TSPADDR, SERVO_BASE_ADDEND);
+}
+
+/**
+ * @brief  Addend expected for a frequency adjustment.
+ * @param  [in] u32Base                 Nominal addend
+ * @param  [in] i32Freq                 Frequency adjustment(ppb)
+ * @retval Addend
+ */
+static uint32_t Servo_Addend(uint32_t u32Base, int32_t i32Freq)
+{
+    return (uint32_t)((int64_t)u32Base + (((int64_t)u32Base * i32Freq) / 1000000000LL));
+}
+
+/**
+ * @brief  Run the servo over one second samples of a local clock.
+ * @param  [in] pstcServo               Servo
+ * @param  [in] i64Offset               Initial offset(ns) of the local clock
+ * @param  [in] i32Drift                Initial frequency error(ppb) of the local clock
+ * @param  [in] i32Wander               Change of the frequency error(ppb) per sample
+ * @param  [in] i64Bound                Offset(ns) the servo must stay within once settled
+ * @retval Largest offset(ns) after settling
+ */
+static int64_t Servo_Trace(stc_eth_ptp_servo_t *pstcServo, int64_t i64Offset,
+                           int32_t i32Drift, int32_t i32Wander, int64_t i64Bound)
+{
+    int64_t i64Worst = 0;
+    int64_t i64Abs;
+    uint32_t u32Addend;
+    uint32_t i;
+
+    for (i = 0UL; i < SERVO_TRACE_LEN; i++)
+    {
+        SERVO_CHECK(Ok == ETH_PTP_ServoUpdate(pstcServo, i64Offset));
+        if (ETH_PTP_SERVO_STATE_JUMP == pstcServo->u32State)
+        {
+            i64Offset = 0;
+        }
+        u32Addend = READ_REG32(M4_ETH->PTP_TSPADDR);
+        if (u32Addend != Servo_Addend(pstcServo->stcInit.u32BaseAddend, pstcServo->i32Freq))
+        {
+            printf("  sample %lu: addend 0x%08lx for %ld ppb\n", (unsigned long)i,
+                   (unsigned long)u32Addend, (long)pstcServo->i32Freq);
+            m_u32Fail++;
+        }
+        /* The local clock runs at its own error plus the applied adjustment */
+        i64Offset += (int64_t)i32Drift + pstcServo->i32Freq;
+        i32Drift  += i32Wander;
+
+        if (i >= SERVO_SETTLE_LEN)
+        {
+            i64Abs = (i64Offset < 0) ? -i64Offset : i64Offset;
+            if (i64Abs > i64Worst)
+            {
+                i64Worst = i64Abs;
+            }
+        }
+    }
+    SERVO_CHECK(i64Worst <= i64Bound);
+
+    return i64Worst;
+}
+
+/**
+ * @brief  Main function of the PTP servo test.
+ * @param  None
+ * @retval 0: Pass, 1: Fail
+ */
+int main(void)
+{
+    stc_eth_ptp_servo_t stcServo;
+    int64_t i64Worst;
+    int32_t i32Freq;
+
+    if (Ok != ETH_SIM_Init())
+    {
+        printf("ETH model: cannot map the register blocks\n");
+        return 1;
+    }
+
+    /* Phase step below the step threshold: slewed out */
+    Servo_Start(&stcServo);
+    i64Worst = Servo_Trace(&stcServo, 800000LL, 0L, 0L, SERVO_LOCK_BOUND);
+    printf("step   800 us           settled within %lld ns\n", (long long)i64Worst);
+    SERVO_CHECK(ETH_PTP_SERVO_STATE_LOCKED == stcServo.u32State);
+
+    /* Frequency error: the integral term learns it */
+    Servo_Start(&stcServo);
+    i64Worst = Servo_Trace(&stcServo, 0LL, 20000L, 0L, SERVO_LOCK_BOUND);
+    printf("ramp   20000 ppb        settled within %lld ns, %ld ppb\n", (long long)i64Worst, (long)stcServo.i32Freq);
+    SERVO_CHECK((stcServo.i32Freq >= -20001L) && (stcServo.i32Freq <= -19999L));
+
+    /* Phase step above the threshold on a locked servo: stepped, integral term cleared */
+    SERVO_CHECK(Ok == ETH_PTP_ServoUpdate(&stcServo, 5000000LL));
+    SERVO_CHECK(ETH_PTP_SERVO_STATE_JUMP == stcServo.u32State);
+    SERVO_CHECK(0 == stcServo.i64Drift);
+    SERVO_CHECK(0L == stcServo.i32Freq);
+    SERVO_CHECK(SERVO_BASE_ADDEND == READ_REG32(M4_ETH->PTP_TSPADDR));
+    i64Worst = Servo_Trace(&stcServo, 0LL, 20000L, 0L, SERVO_LOCK_BOUND);
+    printf("jump   5 ms at 20000 ppb settled within %lld ns\n", (long long)i64Worst);
+
+    /* Frequency error wandering by 20 ppb per sample */
+    Servo_Start(&stcServo);
+    i64Worst = Servo_Trace(&stcServo, 0LL, -5000L, 20L, SERVO_DRIFT_BOUND);
+    printf("drift  20 ppb/sample    tracked within %lld ns\n", (long long)i64Worst);
+
+    /* Frequency error beyond the maximum adjustment, always slewed: held at the limit */
+    Servo_Start(&stcServo);
+    stcServo.stcInit.u32StepThreshold = 0UL;
+    (void)Servo_Trace(&stcServo, 0LL, 800000L, 0L, 0x7FFFFFFFFFFFFFFFLL);
+    SERVO_CHECK(-500000L == stcServo.i32Freq);
+    SERVO_CHECK(-(500000LL << 16U) == stcServo.i64Drift);
+
+    /* Addend clamp at both ends of the register */
+    SERVO_CHECK(Ok == ETH_PTP_AdjustFreq(0xFFFF0000UL, 500000L));
+    SERVO_CHECK(0xFFFFFFFFUL == READ_REG32(M4_ETH->PTP_TSPADDR));
+    i32Freq = (int32_t)(-2000000000L);
+    SERVO_CHECK(Ok == ETH_PTP_AdjustFreq(0x1000UL, i32Freq));
+    SERVO_CHECK(0UL == READ_REG32(M4_ETH->PTP_TSPADDR));
+    printf("clamp  addend held at 0xFFFFFFFF and 0\n");
+
+    printf("%s\n", (0UL == m_u32Fail) ? "ok" : "FAIL");
+
+    return (0UL == m_u32Fail) ? 0 : 1;
+}
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/